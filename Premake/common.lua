@@ -41,6 +41,10 @@ function default_settings(app_name)
 		borderless = true,
 		allowdropfiles = false,
 		autoregisterassets = true,
+		parallelsceneupdate = false,
+		workerthreads = 0,
+		simulationrate = 0,
+		maxsimulationsteps = 5,
 	}
 end
 
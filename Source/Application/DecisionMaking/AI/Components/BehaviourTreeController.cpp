@@ -175,7 +175,7 @@ public:
 		float myCurrentDeathTime = blackboard->getFloat("myCurrentDeathTime");
 		float myDeathTimer = blackboard->getFloat("myDeathTimer");
 
-		float dt = Engine::Get().GetTimer().GetDeltaTime();
+		float dt = Engine::Get().GetTimer().GetFixedDeltaTime();
 		myCurrentDeathTime += dt;
 		blackboard->setFloat("myCurrentDeathTime", myCurrentDeathTime);
 
@@ -211,7 +211,7 @@ public:
 	{
 		float myHPS = blackboard->getFloat("myHPS");
 
-		float dt = Engine::Get().GetTimer().GetDeltaTime();
+		float dt = Engine::Get().GetTimer().GetFixedDeltaTime();
 
 		auto self = Engine::Get().GetSceneHandler().FindGameObjectByName(blackboard->getString("myName"));
 		auto healthComp = self->GetComponent<HealthComponent>();
@@ -261,7 +261,7 @@ public:
 		float myCurrentRotationTime = blackboard->getFloat("myCurrentRotationTime");
 		float myMaxRotationTime = blackboard->getFloat("myMaxRotationTime");
 
-		float dt = Engine::Get().GetTimer().GetDeltaTime();
+		float dt = Engine::Get().GetTimer().GetFixedDeltaTime();
 		auto self = Engine::Get().GetSceneHandler().FindGameObjectByName(blackboard->getString("myName"));
 		auto& transform = self->GetComponent<Transform>();
 
@@ -323,7 +323,7 @@ public:
 
 			float rotTimeDelta = myCurrentRotationTime / myMaxRotationTime;
 			Math::Quatf rot = Math::Quatf::Slerp(myCurrentRotation, myGoalRotation, rotTimeDelta);
-			self->GetComponent<Transform>()->SetRotation(rot.GetEulerAnglesDegrees());
+			self->GetComponent<Transform>()->SetRotationQuaternion(rot);
 		}
 
 		myVelocity = myVelocity * (1 - myDeceleration);
@@ -378,7 +378,7 @@ public:
 		Math::Vector3f targetPos = target->GetComponent<Transform>()->GetTranslation();
 		Math::Vector3f directionToTarget = targetPos - pos;
 
-		float dt = Engine::Get().GetTimer().GetDeltaTime();
+		float dt = Engine::Get().GetTimer().GetFixedDeltaTime();
 
 		myCurrentRotationTime += dt;
 		blackboard->setFloat("myCurrentRotationTime", myCurrentRotationTime);
@@ -400,7 +400,7 @@ public:
 
 		float rotTimeDelta = myCurrentRotationTime / myMaxRotationTime;
 		Math::Quatf rot = Math::Quatf::Slerp(myCurrentRotation, myGoalRotation, rotTimeDelta);
-		transform->SetRotation(rot.GetEulerAnglesDegrees());
+		transform->SetRotationQuaternion(rot);
 		float dot = transform->GetForwardVector().Dot(directionToTarget.GetNormalized());
 		myTimeSinceLastShot += dt;
 		blackboard->setFloat("myTimeSinceLastShot", myTimeSinceLastShot);
@@ -443,7 +443,10 @@ public:
 
 			if (healthComp->GetHealth() <= 0)
 			{
-				blackboard->setString("myTarget", PollingStation::Get().GetRandomAIActor(self)->GetName());
+				if (GameObject* newTarget = Engine::Get().GetSceneHandler().Resolve(PollingStation::Get().GetRandomAIActor(self->GetHandle())))
+				{
+					blackboard->setString("myTarget", newTarget->GetName());
+				}
 			}
 
 			self->GetComponent<ParticleSystem>()->SetActive(true);
@@ -493,7 +496,7 @@ public:
 		float myMaxRotationTime = blackboard->getFloat("myMaxRotationTime");
 		float myShootingRange = blackboard->getFloat("myShootingRange");
 
-		float dt = Engine::Get().GetTimer().GetDeltaTime();
+		float dt = Engine::Get().GetTimer().GetFixedDeltaTime();
 
 		auto self = Engine::Get().GetSceneHandler().FindGameObjectByName(blackboard->getString("myName"));
 		auto target = Engine::Get().GetSceneHandler().FindGameObjectByName(blackboard->getString("myTarget"));
@@ -562,7 +565,7 @@ public:
 
 			float rotTimeDelta = myCurrentRotationTime / myMaxRotationTime;
 			Math::Quatf rot = Math::Quatf::Slerp(myCurrentRotation, myGoalRotation, rotTimeDelta);
-			self->GetComponent<Transform>()->SetRotation(rot.GetEulerAnglesDegrees());
+			self->GetComponent<Transform>()->SetRotationQuaternion(rot);
 		}
 
 		myVelocity = myVelocity * (1 - myDeceleration);
@@ -645,7 +648,7 @@ void BehaviourTreeController::Update()
 {
 	myTree.update();
 
-	float dt = Engine::Get().GetTimer().GetDeltaTime();
+	float dt = Engine::Get().GetTimer().GetFixedDeltaTime();
 	myCurrentParticleActiveTime = myBlackboard->getFloat("myCurrentParticleActiveTime");
 	myCurrentParticleActiveTime += dt;
 	myBlackboard->setFloat("myCurrentParticleActiveTime", myCurrentParticleActiveTime);
@@ -658,8 +661,11 @@ void BehaviourTreeController::Update()
 	}
 }
 
-void BehaviourTreeController::SetTarget(std::shared_ptr<GameObject> aGameObject)
+void BehaviourTreeController::SetTarget(const EntityHandle aHandle)
 {
-	myTarget = aGameObject;
-	myBlackboard->setString("myTarget", myTarget->GetName());
+	myTarget = aHandle;
+	if (GameObject* target = Engine::Get().GetSceneHandler().Resolve(myTarget))
+	{
+		myBlackboard->setString("myTarget", target->GetName());
+	}
 }
@@ -1,5 +1,6 @@
 #pragma once
 #include "GameEngine/ComponentSystem/Component.h"
+#include "GameEngine/ComponentSystem/EntityHandle.h"
 #include "DecisionMaking/BrainTree.h"
 
 class BehaviourTreeController : public Component
@@ -8,13 +9,13 @@ public:
 	void Start() override;
 	void Update() override;
 
-	void SetTarget(std::shared_ptr<GameObject> aGameObject);
+	void SetTarget(const EntityHandle aHandle);
 private:
 	BrainTree::Blackboard::Ptr myBlackboard;
 	BrainTree::BehaviorTree myTree;
 
 	float myDamage = 25.0f;
-	std::shared_ptr<GameObject> myTarget;
+	EntityHandle myTarget;
 
 	float mySightAngle = 0.2f;
 	float myShootingAngle = 0.6f;
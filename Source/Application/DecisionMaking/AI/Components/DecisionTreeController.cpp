@@ -16,7 +16,7 @@ void DecisionTreeController::Start()
 
 void DecisionTreeController::Update()
 {
-	float dt = Engine::Get().GetTimer().GetDeltaTime();
+	float dt = Engine::Get().GetTimer().GetFixedDeltaTime();
 	myCurrentParticleActiveTime += dt;
 	if (myIsShooting && myCurrentParticleActiveTime > myMaxParticleActiveTime)
 	{
@@ -24,19 +24,20 @@ void DecisionTreeController::Update()
 		myIsShooting = false;
 	}
 
-	if (!myTarget) return;
+	GameObject* target = Engine::Get().GetSceneHandler().Resolve(myTarget);
+	if (!target) return;
 
 	auto transform = gameObject->GetComponent<Transform>();
 	Math::Vector3f pos = transform->GetTranslation();
 
-	Math::Vector3f targetPos = myTarget->GetComponent<Transform>()->GetTranslation();
+	Math::Vector3f targetPos = target->GetComponent<Transform>()->GetTranslation();
 	Math::Vector3f directionToTarget = targetPos - pos;
 
 	auto healthComp = gameObject->GetComponent<HealthComponent>();
 
 	if (healthComp->GetHealth() / healthComp->GetMaxHealth() > 0.5f)
 	{
-		SetTarget(PollingStation::Get().GetRandomAIActor(Engine::Get().GetSceneHandler().FindGameObjectByName(gameObject->GetName())));
+		SetTarget(PollingStation::Get().GetRandomAIActor(gameObject->GetHandle()));
 		float dot = transform->GetForwardVector().Dot(directionToTarget.GetNormalized());
 		if (directionToTarget.LengthSqr() < myShootingRange * myShootingRange && dot >= mySightAngle && IsLineOfSightClear(pos, directionToTarget))
 		{
@@ -44,12 +45,12 @@ void DecisionTreeController::Update()
 			if (dot >= myShootingAngle && myTimeSinceLastShot > myShootingCooldown)
 			{
 				myTimeSinceLastShot = 0;
-				auto targetHealthComp = myTarget->GetComponent<HealthComponent>();
+				auto targetHealthComp = target->GetComponent<HealthComponent>();
 				targetHealthComp->TakeDamage(myDamage);
 
 				if (targetHealthComp->GetHealth() <= 0)
 				{
-					SetTarget(PollingStation::Get().GetRandomAIActor(Engine::Get().GetSceneHandler().FindGameObjectByName(gameObject->GetName())));
+					SetTarget(PollingStation::Get().GetRandomAIActor(gameObject->GetHandle()));
 				}
 
 				gameObject->GetComponent<ParticleSystem>()->SetActive(true);
@@ -68,7 +69,7 @@ void DecisionTreeController::Update()
 
 				float rotTimeDelta = myCurrentRotationTime / myMaxRotationTime;
 				Math::Quatf rot = Math::Quatf::Slerp(myCurrentRot, myGoalRot, rotTimeDelta);
-				transform->SetRotation(rot.GetEulerAnglesDegrees());
+				transform->SetRotationQuaternion(rot);
 			}
 		}
 		else
@@ -80,7 +81,7 @@ void DecisionTreeController::Update()
 	{
 		if (healthComp->GetHealth() > 0)
 		{
-			SetTarget(Engine::Get().GetSceneHandler().FindGameObjectByName("HWell"));
+			SetTarget(PollingStation::Get().GetHealingWell());
 			if (directionToTarget.LengthSqr() < myHealRadius * myHealRadius)
 			{
 				healthComp->Heal(myHPS * dt);
@@ -99,7 +100,10 @@ void DecisionTreeController::Update()
 				myCurrentDeathTime = 0.0f;
 				transform->SetTranslation(-200.0f, 0, 500.0f);
 				healthComp->Heal(healthComp->GetMaxHealth());
-				myTarget = Engine::Get().GetSceneHandler().FindGameObjectByName("SMCont");
+				if (auto stateMachineController = Engine::Get().GetSceneHandler().FindGameObjectByName("SMCont"))
+				{
+					SetTarget(stateMachineController->GetHandle());
+				}
 			}
 		}
 	}
@@ -107,15 +111,16 @@ void DecisionTreeController::Update()
 
 void DecisionTreeController::SeekTarget()
 {
-	float dt = Engine::Get().GetTimer().GetDeltaTime();
+	float dt = Engine::Get().GetTimer().GetFixedDeltaTime();
 	auto& transform = gameObject->GetComponent<Transform>();
 
 	Math::Vector3f pos = transform->GetTranslation();
 	Math::Vector3f velocity;
 
 	// Seek Target
+	if (GameObject* target = Engine::Get().GetSceneHandler().Resolve(myTarget))
 	{
-		velocity += myTarget->GetComponent<Transform>()->GetTranslation() - pos;
+		velocity += target->GetComponent<Transform>()->GetTranslation() - pos;
 	}
 
 	// Avoid walls
@@ -154,7 +159,7 @@ void DecisionTreeController::SeekTarget()
 
 		float rotTimeDelta = myCurrentRotationTime / myMaxRotationTime;
 		Math::Quatf rot = Math::Quatf::Slerp(myCurrentRot, myGoalRot, rotTimeDelta);
-		gameObject->GetComponent<Transform>()->SetRotation(rot.GetEulerAnglesDegrees());
+		gameObject->GetComponent<Transform>()->SetRotationQuaternion(rot);
 	}
 
 	myVelocity = myVelocity * (1 - myDeceleration);
@@ -1,5 +1,6 @@
 #pragma once
 #include "GameEngine/ComponentSystem/Component.h"
+#include "GameEngine/ComponentSystem/EntityHandle.h"
 
 class DecisionTreeController : public Component
 {
@@ -7,14 +8,14 @@ public:
 	void Start() override;
 	void Update() override;
 
-	void SetTarget(std::shared_ptr<GameObject> aGameObject) { myTarget = aGameObject; }
+	void SetTarget(const EntityHandle aHandle) { myTarget = aHandle; }
 
 private:
 	void SeekTarget();
 	bool IsLineOfSightClear(Math::Vector3f aOrigin, Math::Vector3f aDirection);
 
 	float myDamage = 25.0f;
-	std::shared_ptr<GameObject> myTarget;
+	EntityHandle myTarget;
 
 	float mySightAngle = 0.2f;
 	float myShootingAngle = 0.6f;
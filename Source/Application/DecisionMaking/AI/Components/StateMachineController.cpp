@@ -16,7 +16,7 @@ void StateMachineController::Start()
 
 void StateMachineController::Update()
 {
-	float dt = Engine::Get().GetTimer().GetDeltaTime();
+	float dt = Engine::Get().GetTimer().GetFixedDeltaTime();
 	myCurrentParticleActiveTime += dt;
 	if (myIsShooting && myCurrentParticleActiveTime > myMaxParticleActiveTime)
 	{
@@ -38,12 +38,15 @@ void StateMachineController::Update()
 	{
 	case StateMachineController::State::SeekEnemy:
 	{
-		SetTarget(PollingStation::Get().GetRandomAIActor(Engine::Get().GetSceneHandler().FindGameObjectByName(gameObject->GetName())));
+		SetTarget(PollingStation::Get().GetRandomAIActor(gameObject->GetHandle()));
+		GameObject* target = Engine::Get().GetSceneHandler().Resolve(myTarget);
+		if (!target) break;
+
 		SeekTarget();
 
 		auto transform = gameObject->GetComponent<Transform>();
 		Math::Vector3f pos = transform->GetTranslation();
-		Math::Vector3f targetPos = myTarget->GetComponent<Transform>()->GetTranslation();
+		Math::Vector3f targetPos = target->GetComponent<Transform>()->GetTranslation();
 		Math::Vector3f directionToTarget = targetPos - pos;
 		if (directionToTarget.LengthSqr() < myShootingRange * myShootingRange)
 		{
@@ -61,12 +64,15 @@ void StateMachineController::Update()
 	}
 	case StateMachineController::State::SeekWell:
 	{
-		SetTarget(Engine::Get().GetSceneHandler().FindGameObjectByName("HWell"));
+		SetTarget(PollingStation::Get().GetHealingWell());
+		GameObject* target = Engine::Get().GetSceneHandler().Resolve(myTarget);
+		if (!target) break;
+
 		SeekTarget();
 
 		auto transform = gameObject->GetComponent<Transform>();
 		Math::Vector3f pos = transform->GetTranslation();
-		Math::Vector3f targetPos = myTarget->GetComponent<Transform>()->GetTranslation();
+		Math::Vector3f targetPos = target->GetComponent<Transform>()->GetTranslation();
 		Math::Vector3f directionToTarget = targetPos - pos;
 		if (directionToTarget.LengthSqr() >= myHealRadius * myHealRadius)
 		{
@@ -77,9 +83,16 @@ void StateMachineController::Update()
 	}
 	case StateMachineController::State::Aim:
 	{
+		GameObject* target = Engine::Get().GetSceneHandler().Resolve(myTarget);
+		if (!target)
+		{
+			myCurrentState = State::SeekEnemy;
+			break;
+		}
+
 		auto transform = gameObject->GetComponent<Transform>();
 		Math::Vector3f pos = transform->GetTranslation();
-		Math::Vector3f targetPos = myTarget->GetComponent<Transform>()->GetTranslation();
+		Math::Vector3f targetPos = target->GetComponent<Transform>()->GetTranslation();
 		Math::Vector3f directionToTarget = targetPos - pos;
 		if (directionToTarget.LengthSqr() > myShootingRange * myShootingRange)
 		{
@@ -101,7 +114,7 @@ void StateMachineController::Update()
 
 		float rotTimeDelta = myCurrentRotationTime / myMaxRotationTime;
 		Math::Quatf rot = Math::Quatf::Slerp(myCurrentRot, myGoalRot, rotTimeDelta);
-		transform->SetRotation(rot.GetEulerAnglesDegrees());
+		transform->SetRotationQuaternion(rot);
 		float dot = transform->GetForwardVector().Dot(directionToTarget.GetNormalized());
 		myTimeSinceLastShot += dt;
 		if (dot >= myShootingAngle)
@@ -109,13 +122,13 @@ void StateMachineController::Update()
 			if (myTimeSinceLastShot > myShootingCooldown)
 			{
 				myTimeSinceLastShot = 0;
-				if (auto targetHealthComp = myTarget->GetComponent<HealthComponent>())
+				if (auto targetHealthComp = target->GetComponent<HealthComponent>())
 				{
 					targetHealthComp->TakeDamage(myDamage);
 
 					if (targetHealthComp->GetHealth() <= 0)
 					{
-						SetTarget(PollingStation::Get().GetRandomAIActor(Engine::Get().GetSceneHandler().FindGameObjectByName(gameObject->GetName())));
+						SetTarget(PollingStation::Get().GetRandomAIActor(gameObject->GetHandle()));
 					}
 				}
 
@@ -160,15 +173,16 @@ void StateMachineController::Update()
 
 void StateMachineController::SeekTarget()
 {
-	float dt = Engine::Get().GetTimer().GetDeltaTime();
+	float dt = Engine::Get().GetTimer().GetFixedDeltaTime();
 	auto& transform = gameObject->GetComponent<Transform>();
 
 	Math::Vector3f pos = transform->GetTranslation();
 	Math::Vector3f velocity;
 
 	// Seek Target
+	if (GameObject* target = Engine::Get().GetSceneHandler().Resolve(myTarget))
 	{
-		velocity += myTarget->GetComponent<Transform>()->GetTranslation() - pos;
+		velocity += target->GetComponent<Transform>()->GetTranslation() - pos;
 	}
 
 	// Avoid walls
@@ -207,7 +221,7 @@ void StateMachineController::SeekTarget()
 
 		float rotTimeDelta = myCurrentRotationTime / myMaxRotationTime;
 		Math::Quatf rot = Math::Quatf::Slerp(myCurrentRot, myGoalRot, rotTimeDelta);
-		gameObject->GetComponent<Transform>()->SetRotation(rot.GetEulerAnglesDegrees());
+		gameObject->GetComponent<Transform>()->SetRotationQuaternion(rot);
 	}
 
 	myVelocity = myVelocity * (1 - myDeceleration);
@@ -1,5 +1,6 @@
 #pragma once
 #include "GameEngine/ComponentSystem/Component.h"
+#include "GameEngine/ComponentSystem/EntityHandle.h"
 
 class StateMachineController : public Component
 {
@@ -15,7 +16,7 @@ public:
 
 	void Start() override;
 	void Update() override;
-	void SetTarget(std::shared_ptr<GameObject> aGameObject) { myTarget = aGameObject; }
+	void SetTarget(const EntityHandle aHandle) { myTarget = aHandle; }
 
 private:
 	void SeekTarget();
@@ -23,7 +24,7 @@ private:
 
 	State myCurrentState = State::SeekEnemy;
 	float myDamage = 25.0f;
-	std::shared_ptr<GameObject> myTarget;
+	EntityHandle myTarget;
 
 	float mySightAngle = 0.2f;
 	float myShootingAngle = 0.6f;
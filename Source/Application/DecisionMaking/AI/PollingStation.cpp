@@ -18,34 +18,46 @@ void PollingStation::Update()
 {
 }
 
-std::shared_ptr<GameObject> PollingStation::GetRandomAIActor(std::shared_ptr<GameObject> aSelf)
+EntityHandle PollingStation::GetRandomAIActor(const EntityHandle aSelf) const
 {
-	int random = 0;
+	if (myAIActors.size() < 2) return EntityHandle();
+
+	size_t random = 0;
 	do 
 	{
-		random = std::rand() % 3;
+		random = std::rand() % myAIActors.size();
 	} while (myAIActors[random] == aSelf);
 
 	return myAIActors[random];
 }
 
-void PollingStation::AddAIActor(std::shared_ptr<GameObject> aGameObject)
+void PollingStation::AddAIActor(const EntityHandle aHandle)
 {
-	myAIActors.push_back(aGameObject);
+	myAIActors.push_back(aHandle);
 }
 
-const Math::Vector3f PollingStation::GetHealingWellPosition()
+const Math::Vector3f PollingStation::GetHealingWellPosition() const
 {
-	return myHealingWell->GetComponent<Transform>()->GetTranslation(true);
+	if (GameObject* healingWell = Engine::Get().GetSceneHandler().Resolve(myHealingWell))
+	{
+		if (auto transform = healingWell->GetComponent<Transform>())
+		{
+			return transform->GetTranslation(true);
+		}
+	}
+
+	return Math::Vector3f();
 }
 
 const std::vector<Math::Vector3f> PollingStation::GetWallPositions() const
 {
+	SceneHandler& sceneHandler = Engine::Get().GetSceneHandler();
 	std::vector<Math::Vector3f> wallPositions;
 
-	for (auto& wall : myWalls)
+	for (auto& wallHandle : myWalls)
 	{
-		if (auto transform = wall->GetComponent<Transform>())
+		GameObject* wall = sceneHandler.Resolve(wallHandle);
+		if (auto transform = wall ? wall->GetComponent<Transform>() : nullptr)
 		{
 			wallPositions.emplace_back(transform->GetTranslation());
 		}
@@ -1,5 +1,6 @@
 #pragma once
 #include "Math/Vector.hpp"
+#include "GameEngine/ComponentSystem/EntityHandle.h"
 
 class PollingStation
 {
@@ -18,16 +19,18 @@ private:
 
 public:
 	void Update();
-	std::shared_ptr<GameObject> GetRandomAIActor(std::shared_ptr<GameObject> aSelf);
-	void AddAIActor(std::shared_ptr<GameObject> aGameObject);
-	void SetHealingWell(std::shared_ptr<GameObject> aGameObject) { myHealingWell = aGameObject; }
-	void AddWall(std::shared_ptr<GameObject> aGameObject) { myWalls.emplace_back(aGameObject); }
+	// Any actor but aSelf, or an invalid handle if there is none.
+	EntityHandle GetRandomAIActor(const EntityHandle aSelf) const;
+	void AddAIActor(const EntityHandle aHandle);
+	void SetHealingWell(const EntityHandle aHandle) { myHealingWell = aHandle; }
+	void AddWall(const EntityHandle aHandle) { myWalls.emplace_back(aHandle); }
 
-	const Math::Vector3f GetHealingWellPosition();
-	const std::vector<std::shared_ptr<GameObject>>& GetWalls() { return myWalls; }
+	const EntityHandle GetHealingWell() const { return myHealingWell; }
+	const Math::Vector3f GetHealingWellPosition() const;
+	const std::vector<EntityHandle>& GetWalls() { return myWalls; }
 	const std::vector<Math::Vector3f> GetWallPositions() const;
 private:
-	std::vector<std::shared_ptr<GameObject>> myWalls;
-	std::vector<std::shared_ptr<GameObject>> myAIActors;
-	std::shared_ptr<GameObject> myHealingWell;
+	std::vector<EntityHandle> myWalls;
+	std::vector<EntityHandle> myAIActors;
+	EntityHandle myHealingWell;
 };
\ No newline at end of file
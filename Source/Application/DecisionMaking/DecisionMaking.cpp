@@ -30,18 +30,17 @@ void DecisionMaking::InitializeApplication()
 	{
 		for (int y = -2; y < 3; y++)
 		{
-			std::shared_ptr<GameObject> go = std::make_shared<GameObject>();
+			std::shared_ptr<GameObject> go = MakePooled<GameObject>();
 			auto transform = go->AddComponent<Transform>(Math::Vector3f(500.0f * x, 0, 500.0f * y));
 			transform->SetUniformScale(100.0f);
 			auto model = go->AddComponent<Model>(AssetManager::Get().GetAsset<MeshAsset>("SM_Sphere.fbx")->mesh, AssetManager::Get().GetAsset<MaterialAsset>("MAT_MatballOne.json")->material);
 
-			PollingStation::Get().AddWall(go);
-			Engine::Get().GetSceneHandler().Instantiate(go);
+			PollingStation::Get().AddWall(Engine::Get().GetSceneHandler().Instantiate(go));
 		}
 	}
 
 	{
-		std::shared_ptr<GameObject> go = std::make_shared<GameObject>();
+		std::shared_ptr<GameObject> go = MakePooled<GameObject>();
 		go->SetName("SMCont");
 		go->AddComponent<Transform>(Math::Vector3f(300.0f, 0, -500.0f));
 		auto model = go->AddComponent<AnimatedModel>(AssetManager::Get().GetAsset<MeshAsset>("Assets/SK_C_TGA_Bro.fbx")->mesh, AssetManager::Get().GetAsset<MaterialAsset>("Materials/MAT_ColorGreen.json")->material);
@@ -73,12 +72,11 @@ void DecisionMaking::InitializeApplication()
 
 		go->AddComponent<StateMachineController>();
 
-		PollingStation::Get().AddAIActor(go);
-		Engine::Get().GetSceneHandler().Instantiate(go);
+		PollingStation::Get().AddAIActor(Engine::Get().GetSceneHandler().Instantiate(go));
 	}
 
 	{
-		std::shared_ptr<GameObject> go = std::make_shared<GameObject>();
+		std::shared_ptr<GameObject> go = MakePooled<GameObject>();
 		go->SetName("DTCont");
 		go->AddComponent<Transform>(Math::Vector3f(-200.0f, 0, 500.0f), Math::Vector3f(0, 180.0f, 0));
 		auto model = go->AddComponent<AnimatedModel>(AssetManager::Get().GetAsset<MeshAsset>("Assets/SK_C_TGA_Bro.fbx")->mesh, AssetManager::Get().GetAsset<MaterialAsset>("Materials/MAT_ColorGreen.json")->material);
@@ -110,12 +108,11 @@ void DecisionMaking::InitializeApplication()
 
 		go->AddComponent<DecisionTreeController>();
 
-		PollingStation::Get().AddAIActor(go);
-		Engine::Get().GetSceneHandler().Instantiate(go);
+		PollingStation::Get().AddAIActor(Engine::Get().GetSceneHandler().Instantiate(go));
 	}
 	
 	{
-		std::shared_ptr<GameObject> go = std::make_shared<GameObject>();
+		std::shared_ptr<GameObject> go = MakePooled<GameObject>();
 		go->SetName("BTCont");
 		go->AddComponent<Transform>(Math::Vector3f(400.0f, 0, 300.0f), Math::Vector3f(0, -90.0f, 0));
 		auto model = go->AddComponent<AnimatedModel>(AssetManager::Get().GetAsset<MeshAsset>("Assets/SK_C_TGA_Bro.fbx")->mesh, AssetManager::Get().GetAsset<MaterialAsset>("Materials/MAT_ColorGreen.json")->material);
@@ -147,26 +144,24 @@ void DecisionMaking::InitializeApplication()
 
 		go->AddComponent<BehaviourTreeController>();
 
-		PollingStation::Get().AddAIActor(go);
-		Engine::Get().GetSceneHandler().Instantiate(go);
+		PollingStation::Get().AddAIActor(Engine::Get().GetSceneHandler().Instantiate(go));
 	}
 
 	auto smCont = Engine::Get().GetSceneHandler().FindGameObjectByName("SMCont");
 	auto dtCont = Engine::Get().GetSceneHandler().FindGameObjectByName("DTCont");
 	auto btCont = Engine::Get().GetSceneHandler().FindGameObjectByName("BTCont");
-	smCont->GetComponent<StateMachineController>()->SetTarget(dtCont);
-	dtCont->GetComponent<DecisionTreeController>()->SetTarget(btCont);
-	btCont->GetComponent<BehaviourTreeController>()->SetTarget(smCont);
+	smCont->GetComponent<StateMachineController>()->SetTarget(dtCont->GetHandle());
+	dtCont->GetComponent<DecisionTreeController>()->SetTarget(btCont->GetHandle());
+	btCont->GetComponent<BehaviourTreeController>()->SetTarget(smCont->GetHandle());
 
 	{
-		std::shared_ptr<GameObject> go = std::make_shared<GameObject>();
+		std::shared_ptr<GameObject> go = MakePooled<GameObject>();
 		go->SetName("HWell");
 		auto transform = go->AddComponent<Transform>(Math::Vector3f(-800.0f, 0, 0.0f));
 		transform->SetRotation(0, 90.0f, 0);
 		go->AddComponent<Model>(AssetManager::Get().GetAsset<MeshAsset>("Assets/SM_Chest.fbx")->mesh, AssetManager::Get().GetAsset<MaterialAsset>("Materials/MAT_Chest.json")->material);
 
-		PollingStation::Get().SetHealingWell(go);
-		Engine::Get().GetSceneHandler().Instantiate(go);
+		PollingStation::Get().SetHealingWell(Engine::Get().GetSceneHandler().Instantiate(go));
 	}
 }
 
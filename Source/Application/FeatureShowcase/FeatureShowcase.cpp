@@ -79,7 +79,7 @@ void FeatureShowcase::InitializeApplication()
 	inputHandler.RegisterBinaryAction("SharedAction", Keys::W, GenericInput::ActionType::Held);
 	inputHandler.RegisterBinaryAction("SharedAction", ControllerButtons::A, GenericInput::ActionType::Held);
 
-	std::shared_ptr<GameObject> instancedModelObj = std::make_shared<GameObject>();
+	std::shared_ptr<GameObject> instancedModelObj = MakePooled<GameObject>();
 	instancedModelObj->AddComponent<Transform>(Math::Vector3f(-500.0f, 0, 1500.0f));
 	std::shared_ptr<InstancedModel> instancedModel = instancedModelObj->AddComponent<InstancedModel>();
 	instancedModel->SetMesh(AssetManager::Get().GetAsset<MeshAsset>("SM_Chest.fbx")->mesh);
@@ -411,6 +411,19 @@ void FeatureShowcase::InitializeApplication()
 					ImGui::TableNextColumn();
 				}
 
+				// Object pools
+				{
+					ImGui::Text("Pooled Objects:");
+					ImGui::TableNextColumn();
+					ImGui::Text(std::to_string(ObjectPoolStats::liveObjects.load()).c_str());
+					ImGui::TableNextColumn();
+
+					ImGui::Text("Pool Heap Allocations:");
+					ImGui::TableNextColumn();
+					ImGui::Text(std::to_string(ObjectPoolStats::heapAllocations.load()).c_str());
+					ImGui::TableNextColumn();
+				}
+
 				ImGui::Spacing();
 
 				// Memory Usage
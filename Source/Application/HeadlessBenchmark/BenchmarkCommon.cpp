@@ -0,0 +1,239 @@
+#include "Enginepch.h"
+#include "BenchmarkCommon.h"
+
+#include "ComponentSystem/GameObject.h"
+#include "ComponentSystem/Components/Transform.h"
+#include "ComponentSystem/Components/Physics/Colliders/BoxCollider.h"
+#include "ComponentSystem/Components/Physics/Colliders/SphereCollider.h"
+
+#include <map>
+
+namespace Benchmark
+{
+	void PrintComparisonHeader(const char* aTitle, const char* aReferenceColumn, const char* aEngineColumn)
+	{
+		std::printf("\n%-16s %16s %16s %10s\n", aTitle, aReferenceColumn, aEngineColumn, "Speedup");
+	}
+
+	void PrintComparison(const char* aName, const double aReference, const double aEngine)
+	{
+		std::printf("%-16s %16.4f %16.4f %9.1fx\n", aName, aReference, aEngine, aEngine > 0 ? aReference / aEngine : 0.0);
+	}
+
+	const Math::Vector3f GetGridPosition(unsigned aIndex, unsigned aCount)
+	{
+		unsigned side = 1;
+		while (side * side < aCount) side++;
+
+		const float spacing = WorldSize / static_cast<float>(side);
+		return { (static_cast<float>(aIndex % side) + 0.5f) * spacing, 0, (static_cast<float>(aIndex / side) + 0.5f) * spacing };
+	}
+
+	std::vector<NavPolygon> CreateGridPolygons(unsigned aGridSize, unsigned aWallSpacing)
+	{
+		const float cellSize = WorldSize / static_cast<float>(aGridSize);
+		auto vertex = [cellSize](unsigned aX, unsigned aZ) { return Math::Vector3f(static_cast<float>(aX) * cellSize, 0, static_cast<float>(aZ) * cellSize); };
+
+		std::vector<NavPolygon> polygons;
+		polygons.reserve(aGridSize * aGridSize * 2);
+		for (unsigned z = 0; z < aGridSize; z++)
+		{
+			for (unsigned x = 0; x < aGridSize; x++)
+			{
+				if (aWallSpacing > 0 && x % aWallSpacing == aWallSpacing / 2 && z % aWallSpacing != 0) continue;
+
+				polygons.push_back({ { vertex(x, z), vertex(x + 1, z), vertex(x + 1, z + 1) } });
+				polygons.push_back({ { vertex(x, z), vertex(x + 1, z + 1), vertex(x, z + 1) } });
+			}
+		}
+
+		return polygons;
+	}
+
+	NavMesh CreateGridNavMesh(unsigned aGridSize, unsigned aWallSpacing)
+	{
+		const std::vector<NavPolygon> polygons = CreateGridPolygons(aGridSize, aWallSpacing);
+		std::vector<NavNode> nodes(polygons.size());
+		for (size_t i = 0; i < polygons.size(); i++)
+		{
+			const auto& vertices = polygons[i].vertexPositions;
+			nodes[i].position = (vertices[0] + vertices[1] + vertices[2]) * (1.0f / 3.0f);
+		}
+
+		// Triangle pairs per edge, keyed on the edge's vertex positions in a fixed order.
+		auto key = [](const Math::Vector3f& aA, const Math::Vector3f& aB)
+			{
+				const bool aFirst = aA.x < aB.x || (aA.x == aB.x && aA.z < aB.z);
+				const Math::Vector3f& first = aFirst ? aA : aB;
+				const Math::Vector3f& second = aFirst ? aB : aA;
+				return std::make_tuple(first.x, first.z, second.x, second.z);
+			};
+
+		std::map<std::tuple<float, float, float, float>, std::vector<int>> edges;
+		for (int i = 0; i < static_cast<int>(polygons.size()); i++)
+		{
+			const auto& vertices = polygons[i].vertexPositions;
+			for (int edge = 0; edge < 3; edge++)
+			{
+				edges[key(vertices[edge], vertices[(edge + 1) % 3])].emplace_back(i);
+			}
+		}
+
+		std::vector<NavPortal> portals;
+		for (const auto& [edgeKey, triangles] : edges)
+		{
+			if (triangles.size() != 2) continue;
+
+			const Math::Vector3f first(std::get<0>(edgeKey), 0, std::get<1>(edgeKey));
+			const Math::Vector3f second(std::get<2>(edgeKey), 0, std::get<3>(edgeKey));
+			for (int direction = 0; direction < 2; direction++)
+			{
+				NavPortal& portal = portals.emplace_back();
+				portal.nodes = { triangles[direction], triangles[1 - direction] };
+				portal.vertices = { first, second };
+				portal.cost = (nodes[triangles[0]].position - nodes[triangles[1]].position).Length();
+				nodes[portal.nodes[0]].portals.emplace_back(static_cast<int>(portals.size() - 1));
+			}
+		}
+
+		NavMesh navMesh;
+		navMesh.Init(nodes, polygons, portals);
+		navMesh.SetBoundingBox({ WorldSize * 0.5f, 0, WorldSize * 0.5f }, { WorldSize, 1.0f, WorldSize });
+		return navMesh;
+	}
+
+	std::vector<NavPolygon> CreateHillyPolygons(unsigned aTriangleCount, std::vector<NavNode>& outNodes)
+	{
+		unsigned gridSize = 1;
+		while (gridSize * gridSize * 2 < aTriangleCount) gridSize++;
+
+		std::vector<NavPolygon> polygons = CreateGridPolygons(gridSize);
+		for (size_t i = 0; i < polygons.size(); i++)
+		{
+			for (Math::Vector3f& vertex : polygons[i].vertexPositions)
+			{
+				vertex.y = std::sin(vertex.x * 0.01f) * std::cos(vertex.z * 0.013f) * 50.0f;
+				if (i % 2 == 0 && vertex.x == 0) vertex.x = -0.0f;
+			}
+		}
+
+		std::mt19937 random(1234);
+		std::shuffle(polygons.begin(), polygons.end(), random);
+
+		outNodes.assign(polygons.size(), NavNode());
+		for (size_t i = 0; i < polygons.size(); i++)
+		{
+			const auto& vertices = polygons[i].vertexPositions;
+			outNodes[i].position = (vertices[0] + vertices[1] + vertices[2]) * (1.0f / 3.0f);
+		}
+
+		return polygons;
+	}
+
+	void CreateIntersectionShapes(unsigned aCount, std::mt19937& aRandom, IntersectionShapes& outShapes)
+	{
+		std::uniform_int_distribution<int> coordinate(-16, 16);
+		std::uniform_int_distribution<int> size(0, 6);
+		std::uniform_int_distribution<int> direction(-1, 1);
+
+		for (unsigned i = 0; i < aCount; i++)
+		{
+			const Math::Vector3f min(static_cast<float>(coordinate(aRandom)), static_cast<float>(coordinate(aRandom)), static_cast<float>(coordinate(aRandom)));
+			const Math::Vector3f extents(static_cast<float>(size(aRandom)), static_cast<float>(size(aRandom)), static_cast<float>(size(aRandom)));
+			outShapes.aabbs.emplace_back(min, min + extents);
+			outShapes.aabbBatch.Add(outShapes.aabbs.back());
+
+			const Math::Vector3f center(static_cast<float>(coordinate(aRandom)), static_cast<float>(coordinate(aRandom)), static_cast<float>(coordinate(aRandom)));
+			outShapes.spheres.emplace_back(center, static_cast<float>(size(aRandom)));
+			outShapes.sphereBatch.Add(outShapes.spheres.back());
+
+			Math::Vector3f rayDirection(static_cast<float>(direction(aRandom)), static_cast<float>(direction(aRandom)), static_cast<float>(direction(aRandom)));
+			if (rayDirection.LengthSqr() == 0) rayDirection.x = 1.0f;
+			outShapes.rays.emplace_back(center, rayDirection);
+		}
+	}
+
+	void ContactEventLog::Add(const unsigned aFrame, const CollisionEvent aEvent, const uint32_t aSelf, const GameObject* aOther)
+	{
+		const uint64_t other = aOther ? aOther->GetHandle().index : UINT64_MAX;
+		for (const uint64_t value : { static_cast<uint64_t>(aFrame), static_cast<uint64_t>(aEvent), static_cast<uint64_t>(aSelf), other })
+		{
+			hash = (hash ^ value) * 1099511628211ull;
+		}
+
+		eventCount++;
+	}
+
+	ContactEventLog RunContactScene(unsigned aFrames, unsigned aColliderCount, const SceneUpdateMode aUpdateMode)
+	{
+		// About one collider per 100 square units, so most of them touch a few others at any time.
+		const float areaSize = std::sqrt(static_cast<float>(aColliderCount)) * 10.0f;
+		const unsigned obstacleCount = aColliderCount / 10;
+
+		Scene scene;
+		scene.SetUpdateMode(aUpdateMode);
+		CollisionHandler collisionHandler;
+		ContactEventLog log;
+		unsigned frame = 0;
+
+		for (unsigned i = 0; i < obstacleCount; i++)
+		{
+			std::shared_ptr<GameObject> go = MakePooled<GameObject>();
+			go->AddComponent<Transform>(GetGridPosition(i, obstacleCount) * (areaSize / WorldSize));
+			go->AddComponent<BoxCollider>(Math::Vector3f(4.0f, 4.0f, 4.0f));
+			go->SetStatic(true);
+			scene.Instantiate(go);
+		}
+
+		// Every collider circles around its own point, at its own speed and distance, alternating spheres and boxes.
+		std::vector<std::shared_ptr<Transform>> transforms;
+		std::vector<Math::Vector3f> centers;
+		for (unsigned i = 0; i < aColliderCount; i++)
+		{
+			std::shared_ptr<GameObject> go = MakePooled<GameObject>();
+			const Math::Vector3f center = GetGridPosition((i * 7919u) % aColliderCount, aColliderCount) * (areaSize / WorldSize);
+			transforms.emplace_back(go->AddComponent<Transform>(center));
+			centers.emplace_back(center);
+
+			std::shared_ptr<Collider> collider;
+			if (i % 2 == 0) collider = go->AddComponent<SphereCollider>(3.0f);
+			else collider = go->AddComponent<BoxCollider>(Math::Vector3f(2.5f, 2.5f, 2.5f));
+
+			scene.Instantiate(go);
+			const GameObject* self = go.get();
+			collider->SetCollisionCallback([&log, &frame, self](const CollisionEvent aEvent, GameObject* aOther)
+				{
+					log.Add(frame, aEvent, self->GetHandle().index, aOther);
+				}, { CollisionEvent::Enter, CollisionEvent::Stay, CollisionEvent::Exit });
+		}
+
+		for (frame = 0; frame < aFrames; frame++)
+		{
+			for (unsigned i = 0; i < aColliderCount; i++)
+			{
+				const float angle = static_cast<float>(frame) * (0.02f + static_cast<float>(i % 7) * 0.01f);
+				const float radius = 4.0f + static_cast<float>(i % 5) * 2.0f;
+				transforms[i]->SetTranslation(centers[i] + Math::Vector3f(std::cos(angle) * radius, 0, std::sin(angle) * radius));
+			}
+
+			scene.Update();
+
+			log.collisionMS += TimeMS([&collisionHandler, &scene] { collisionHandler.TestCollisions(scene); });
+			log.testedPairs += collisionHandler.GetStats().testedPairs;
+		}
+
+		return log;
+	}
+
+	void CreateRays(unsigned aSeed, unsigned aRayCount, std::vector<Math::Ray<float>>& outRays)
+	{
+		outRays.clear();
+		for (unsigned ray = 0; ray < aRayCount; ray++)
+		{
+			const unsigned seed = aSeed * aRayCount + ray;
+			const Math::Vector3f origin(static_cast<float>((seed * 41u) % 1000u) * WorldSize / 1000.0f, 0, static_cast<float>((seed * 67u) % 1000u) * WorldSize / 1000.0f);
+			const float angle = static_cast<float>((seed * 13u) % 360u) * 3.14159265f / 180.0f;
+			outRays.emplace_back(origin, Math::Vector3f(std::cos(angle), 0, std::sin(angle)));
+		}
+	}
+}
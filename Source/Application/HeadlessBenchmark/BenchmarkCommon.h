@@ -0,0 +1,71 @@
+#pragma once
+#include "ComponentSystem/Scene.h"
+#include "CollisionHandler/CollisionHandler.h"
+#include "Pathfinding/NavMesh.h"
+#include "Math/Intersection3D.hpp"
+#include "Math/IntersectionBatch.hpp"
+
+#include <chrono>
+#include <random>
+
+// Scenes, navmeshes and timing shared by the benchmark modes in HeadlessBenchmark and the checks in HeadlessTests.
+namespace Benchmark
+{
+	using Clock = std::chrono::steady_clock;
+
+	constexpr float WorldSize = 2000.0f;
+
+	template <typename Function>
+	const double TimeMS(Function&& aFunction)
+	{
+		const Clock::time_point start = Clock::now();
+		aFunction();
+		return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
+
+	// A table comparing the way something used to be done with the way the engine does it now. The values are in whatever
+	// unit the columns are named after, and the speedup is the first divided by the second.
+	void PrintComparisonHeader(const char* aTitle, const char* aReferenceColumn, const char* aEngineColumn);
+	void PrintComparison(const char* aName, const double aReference, const double aEngine);
+
+	// Position aIndex of aCount spread out on a square grid over the world.
+	const Math::Vector3f GetGridPosition(unsigned aIndex, unsigned aCount);
+
+	// Two triangles per grid cell over the world, one node per triangle and a portal each way over every shared edge, like
+	// navmeshes loaded by the asset manager. With aWallSpacing, every that many columns of cells is left out except for a
+	// doorway every that many rows, so paths across the grid have to go around.
+	std::vector<NavPolygon> CreateGridPolygons(unsigned aGridSize, unsigned aWallSpacing = 0);
+	NavMesh CreateGridNavMesh(unsigned aGridSize, unsigned aWallSpacing = 0);
+	// About aTriangleCount grid triangles on hills, with -0 instead of 0 on some vertices, which has to count as the same
+	// vertex, and in a random order like an exported mesh. outNodes gets one node per triangle.
+	std::vector<NavPolygon> CreateHillyPolygons(unsigned aTriangleCount, std::vector<NavNode>& outNodes);
+
+	// Coordinates on a coarse integer grid, so shapes often touch exactly and rays often run along an axis.
+	struct IntersectionShapes
+	{
+		std::vector<Math::AABB3D<float>> aabbs;
+		std::vector<Math::Sphere<float>> spheres;
+		std::vector<Math::Ray<float>> rays;
+		Math::AABBBatch aabbBatch;
+		Math::SphereBatch sphereBatch;
+	};
+
+	void CreateIntersectionShapes(unsigned aCount, std::mt19937& aRandom, IntersectionShapes& outShapes);
+
+	// The collision events one contact scene sent, folded into a hash in the order they arrived.
+	struct ContactEventLog
+	{
+		uint64_t hash = 14695981039346656037ull;
+		size_t eventCount = 0;
+		size_t testedPairs = 0;
+		double collisionMS = 0;
+
+		void Add(const unsigned aFrame, const CollisionEvent aEvent, const uint32_t aSelf, const GameObject* aOther);
+	};
+
+	// aColliderCount colliders circling around in a crowd among static boxes, tested for collisions every frame.
+	ContactEventLog RunContactScene(unsigned aFrames, unsigned aColliderCount, const SceneUpdateMode aUpdateMode);
+
+	// Short horizontal rays from all over the world, like line of sight checks between nearby agents.
+	void CreateRays(unsigned aSeed, unsigned aRayCount, std::vector<Math::Ray<float>>& outRays);
+}
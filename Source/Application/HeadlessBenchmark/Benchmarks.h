@@ -0,0 +1,48 @@
+#pragma once
+#include "BenchmarkCommon.h"
+
+namespace Benchmark
+{
+	struct BenchmarkSettings
+	{
+		unsigned frames = 300;
+		unsigned objects = 100000;
+		unsigned staticObjects = 20000;
+		unsigned colliders = 1000;
+		unsigned paths = 8;
+		unsigned rays = 0;
+		unsigned layers = 0;
+		unsigned navGridSize = 32;
+		unsigned workers = 0;
+		unsigned pathBudget = NavMesh::DefaultSearchStepsPerUpdate;
+		float rate = 0;
+		bool parallel = false;
+	};
+
+	// The benchmark modes, which each time one thing on its own. aCount is the N given to the mode's argument, see
+	// HeadlessBenchmark.cpp for what it means for each of them.
+
+	// SceneBenchmarks.cpp
+	void RunSpawnBenchmark(const BenchmarkSettings& aSettings, unsigned aCount);
+	void RunEachBenchmark(const BenchmarkSettings& aSettings, unsigned aCount);
+	void RunGetComponentBenchmark(const BenchmarkSettings& aSettings, unsigned aCount);
+	void RunFindBenchmark(const BenchmarkSettings& aSettings, unsigned aCount);
+	void RunDestroyBenchmark(const BenchmarkSettings& aSettings, unsigned aCount);
+	void RunPoolBenchmark(const BenchmarkSettings& aSettings, unsigned aCount);
+
+	// TransformBenchmarks.cpp
+	void RunHierarchyBenchmark(const BenchmarkSettings& aSettings, unsigned aCount);
+	void RunTransformBenchmark(const BenchmarkSettings& aSettings, unsigned aCount);
+
+	// MathBenchmarks.cpp
+	void RunIntersectionBenchmark(const BenchmarkSettings& aSettings, unsigned aCount);
+	void RunNeighbourBenchmark(const BenchmarkSettings& aSettings, unsigned aCount);
+
+	// CollisionBenchmarks.cpp
+	void RunContactBenchmark(const BenchmarkSettings& aSettings, unsigned aCount);
+
+	// NavigationBenchmarks.cpp
+	void RunNavMeshQueryBenchmark(const BenchmarkSettings& aSettings, unsigned aCount);
+	void RunNavPortalBenchmark(const BenchmarkSettings& aSettings, unsigned aCount);
+	void RunRepathBenchmark(const BenchmarkSettings& aSettings, unsigned aCount);
+}
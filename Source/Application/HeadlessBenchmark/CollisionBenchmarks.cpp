@@ -0,0 +1,22 @@
+#include "Enginepch.h"
+#include "Benchmarks.h"
+
+#include "Engine.h"
+#include "JobSystem/JobSystem.h"
+
+namespace Benchmark
+{
+	void RunContactBenchmark(const BenchmarkSettings& aSettings, unsigned aCount)
+	{
+		const unsigned workerCount = Engine::Get().GetJobSystem().GetWorkerCount();
+		std::printf("%u colliders, %u frames, %u worker threads\n", aCount, aSettings.frames, workerCount);
+		if (workerCount == 0) std::printf("No worker threads, both runs test their pairs on the main thread. Use --workers N.\n");
+
+		const ContactEventLog serial = RunContactScene(aSettings.frames, aCount, SceneUpdateMode::Serial);
+		const ContactEventLog parallel = RunContactScene(aSettings.frames, aCount, SceneUpdateMode::Parallel);
+
+		std::printf("%.1f pairs tested and %.1f collision events per frame\n", static_cast<double>(serial.testedPairs) / aSettings.frames, static_cast<double>(serial.eventCount) / aSettings.frames);
+		PrintComparisonHeader("Narrowphase", "Serial ms/frame", "Parallel ms/frame");
+		PrintComparison("Collisions", serial.collisionMS / aSettings.frames, parallel.collisionMS / aSettings.frames);
+	}
+}
@@ -0,0 +1,369 @@
+#include "Enginepch.h"
+#include "Benchmarks.h"
+#include "ReferenceImplementations.h"
+
+#include "Engine.h"
+#include "Time/Timer.h"
+#include "Time/FixedTimestep.h"
+#include "JobSystem/JobSystem.h"
+#include "ComponentSystem/GameObject.h"
+#include "ComponentSystem/Components/Transform.h"
+#include "ComponentSystem/Components/Movement/Rotator.h"
+#include "ComponentSystem/Components/Movement/MoveBetweenPoints.h"
+#include "ComponentSystem/Components/Physics/Colliders/BoxCollider.h"
+#include "ComponentSystem/Components/Physics/Colliders/SphereCollider.h"
+
+#include <cstring>
+
+// Ticks a generated scene on the headless engine and prints how long each subsystem took per frame.
+//
+// HeadlessBenchmark [--frames N] [--objects N] [--static N] [--colliders N] [--paths N] [--rays N] [--layers N] [--navgrid N] [--workers N] [--rate N] [--parallel]
+// HeadlessBenchmark --<mode> N [--frames N] [--navgrid N] [--workers N] [--budget N]
+//
+// Static objects each get a box collider and are laid out on a grid. Every moving object has a Rotator, and the first
+// --colliders of them also move between points across the grid with a sphere collider. --paths path queries are made
+// per simulation step on a generated --navgrid x --navgrid navmesh covering the same area. --rays closest hit raycasts are
+// made per simulation step in one batch, and the last step's are timed again testing every collider. --layers spreads
+// the moving colliders over N collision layers that only collide with themselves and the static level on layer 0.
+// Without --rate every frame is one simulation step, run back to back. With it the engine's fixed timestep decides how
+// many steps each frame runs, and the benchmark sleeps until the next one is due like a dedicated server would.
+// The default is a 100k object scene; "--objects 20500 --static 20000 --colliders 500" is a mostly static level.
+//
+// The modes each time one thing on its own, mostly compared to the way the engine used to do it, and then exit. Several
+// can be given at once. The results they have to agree on are checked by HeadlessTests instead.
+// --spawn spawns N moving colliders, built from JSON one by one like the scene loader does and cloned from a prefab.
+// --each goes over N game objects every frame with Scene::Each, once reading the transform and collider of those that
+// have one and once moving every transform, compared to looping over the game objects and looking the components up.
+// "--each 100000" is the size of the default scene.
+// --getcomponent has N game objects with 1, 2, 4, 8 and then 16 components look up each of their components every
+// frame, through the slot table and by casting every component in turn like GetComponent used to.
+// --find has a scene of N game objects and looks 1000 of them up by name, ID and network ID every frame, through the
+// scene's indices and by going through the game objects like the finders used to.
+// --destroy destroys 10% and then 50% of a scene of N game objects in one frame, compared to finding and erasing each of
+// them in the list of game objects on its own like the scene used to. "--destroy 50000" is the size of a big level.
+// --pool allocates N transforms among other allocations with make_shared and with MakePooled. It times moving all of them
+// every frame, respawning a tenth of them every frame and moving them again after that, and prints how many heap
+// allocations the pools made.
+// --hierarchy times transform hierarchies, a deep one (chains like a skeleton's bones) and a wide one (a single root with
+// many children). Each frame the roots move N times and then every world matrix is read once, compared to reading the
+// whole hierarchy after every move like eager propagation did.
+// --transforms moves, rotates and reads the world matrix of N unparented transforms every frame, and prints the cost per
+// transform.
+// --intersections times the batch intersection tests against the scalar ones, testing 256 of N shapes against all N per
+// frame.
+// --neighbours has N flocking agents moving in a spatial hash grid and each finding its neighbours every frame, compared
+// to every agent looping over all the others like the steering behaviours used to.
+// --contacts tests collisions of N colliders circling around in a crowd, once in a serial scene and once in a parallel
+// one where the narrowphase runs on the --workers threads.
+// --navqueries makes N ClampToNavMesh calls and N RayCasts on the --navgrid navmesh, on and off the mesh, compared to
+// going through every polygon like they used to on some of them. "--navqueries 100000 --navgrid 158" is about 50k
+// triangles.
+// --navportals builds the portals of a hilly, shuffled navmesh of about N triangles with NavMesh::CreatePortals and with
+// the all pairs loop the asset manager used to have.
+// --repath has N agents on the --navgrid navmesh, with walls in it, ask for a path in the same frame, once with FindPath
+// and once through the navmesh's path requests with --budget search steps per frame, and prints the worst frame of each.
+
+using namespace Benchmark;
+
+namespace
+{
+	struct BenchmarkMode
+	{
+		const char* argument;
+		void (*run)(const BenchmarkSettings& aSettings, unsigned aCount);
+	};
+
+	constexpr BenchmarkMode Modes[] = {
+		{ "--spawn", RunSpawnBenchmark },
+		{ "--each", RunEachBenchmark },
+		{ "--getcomponent", RunGetComponentBenchmark },
+		{ "--find", RunFindBenchmark },
+		{ "--destroy", RunDestroyBenchmark },
+		{ "--pool", RunPoolBenchmark },
+		{ "--hierarchy", RunHierarchyBenchmark },
+		{ "--transforms", RunTransformBenchmark },
+		{ "--intersections", RunIntersectionBenchmark },
+		{ "--neighbours", RunNeighbourBenchmark },
+		{ "--contacts", RunContactBenchmark },
+		{ "--navqueries", RunNavMeshQueryBenchmark },
+		{ "--navportals", RunNavPortalBenchmark },
+		{ "--repath", RunRepathBenchmark },
+	};
+
+	struct ModeRun
+	{
+		const BenchmarkMode* mode = nullptr;
+		unsigned count = 0;
+	};
+
+	struct SubsystemTiming
+	{
+		const char* name;
+		double totalMS = 0;
+		double maxMS = 0;
+
+		void Add(const Clock::duration aDuration)
+		{
+			const double ms = std::chrono::duration<double, std::milli>(aDuration).count();
+			totalMS += ms;
+			maxMS = ms > maxMS ? ms : maxMS;
+		}
+	};
+
+	// Moving colliders count the collisions they start, like gameplay reacting to hits would.
+	size_t collisionResponseCount = 0;
+
+	const bool ParseArguments(int aArgumentCount, char* aArguments[], BenchmarkSettings& outSettings, std::vector<ModeRun>& outModes)
+	{
+		for (int i = 1; i < aArgumentCount; i++)
+		{
+			const char* argument = aArguments[i];
+			if (std::strcmp(argument, "--parallel") == 0)
+			{
+				outSettings.parallel = true;
+				continue;
+			}
+
+			if (i + 1 >= aArgumentCount)
+			{
+				std::cerr << "Missing value for " << argument << std::endl;
+				return false;
+			}
+
+			if (std::strcmp(argument, "--rate") == 0)
+			{
+				outSettings.rate = std::strtof(aArguments[++i], nullptr);
+				continue;
+			}
+
+			const unsigned value = static_cast<unsigned>(std::strtoul(aArguments[++i], nullptr, 10));
+			auto mode = std::find_if(std::begin(Modes), std::end(Modes), [argument](const BenchmarkMode& aMode) { return std::strcmp(argument, aMode.argument) == 0; });
+			if (mode != std::end(Modes))
+			{
+				if (value > 0) outModes.push_back({ mode, value });
+			}
+			else if (std::strcmp(argument, "--frames") == 0) outSettings.frames = value;
+			else if (std::strcmp(argument, "--objects") == 0) outSettings.objects = value;
+			else if (std::strcmp(argument, "--static") == 0) outSettings.staticObjects = value;
+			else if (std::strcmp(argument, "--colliders") == 0) outSettings.colliders = value;
+			else if (std::strcmp(argument, "--paths") == 0) outSettings.paths = value;
+			else if (std::strcmp(argument, "--rays") == 0) outSettings.rays = value;
+			else if (std::strcmp(argument, "--layers") == 0) outSettings.layers = value;
+			else if (std::strcmp(argument, "--navgrid") == 0) outSettings.navGridSize = value;
+			else if (std::strcmp(argument, "--workers") == 0) outSettings.workers = value;
+			else if (std::strcmp(argument, "--budget") == 0) outSettings.pathBudget = value;
+			else
+			{
+				std::cerr << "Unknown argument " << argument << std::endl;
+				return false;
+			}
+		}
+
+		outSettings.staticObjects = outSettings.staticObjects < outSettings.objects ? outSettings.staticObjects : outSettings.objects;
+		const unsigned movingObjects = outSettings.objects - outSettings.staticObjects;
+		outSettings.colliders = outSettings.colliders < movingObjects ? outSettings.colliders : movingObjects;
+		outSettings.layers = outSettings.layers < Collider::LayerCount - 1 ? outSettings.layers : Collider::LayerCount - 1;
+		return true;
+	}
+
+	void PopulateScene(Scene& aScene, const BenchmarkSettings& aSettings)
+	{
+		for (unsigned i = 0; i < aSettings.staticObjects; i++)
+		{
+			std::shared_ptr<GameObject> go = MakePooled<GameObject>();
+			go->AddComponent<Transform>(GetGridPosition(i, aSettings.staticObjects));
+			go->AddComponent<BoxCollider>(Math::Vector3f(2.0f, 2.0f, 2.0f));
+			go->SetStatic(true);
+			aScene.Instantiate(go);
+		}
+
+		const unsigned movingObjects = aSettings.objects - aSettings.staticObjects;
+		for (unsigned i = 0; i < movingObjects; i++)
+		{
+			std::shared_ptr<GameObject> go = MakePooled<GameObject>();
+			const Math::Vector3f position = GetGridPosition(i, movingObjects) + Math::Vector3f(0, 5.0f, 0);
+			go->AddComponent<Transform>(position);
+			go->AddComponent<Rotator>(Math::Vector3f(0, 45.0f + static_cast<float>(i % 90), 0));
+
+			if (i < aSettings.colliders)
+			{
+				const Math::Vector3f target = GetGridPosition((i * 7919u) % movingObjects, movingObjects) + Math::Vector3f(0, 5.0f, 0);
+				go->AddComponent<MoveBetweenPoints>(std::vector<Math::Vector3f>{ position, target }, 50.0f);
+				std::shared_ptr<SphereCollider> collider = go->AddComponent<SphereCollider>(4.0f);
+				collider->SetCollisionResponse([] { collisionResponseCount++; });
+				if (aSettings.layers > 0)
+				{
+					const unsigned layer = 1 + i % aSettings.layers;
+					collider->SetCollisionLayer(layer);
+					collider->SetCollisionMask((1u << layer) | 1u);
+				}
+			}
+
+			aScene.Instantiate(go);
+		}
+	}
+
+	void PrintTimings(const std::vector<SubsystemTiming>& aTimings, unsigned aFrames)
+	{
+		std::printf("\n%-16s %12s %12s %12s\n", "Subsystem", "Total ms", "Avg ms", "Max ms");
+		for (const SubsystemTiming& timing : aTimings)
+		{
+			std::printf("%-16s %12.2f %12.4f %12.4f\n", timing.name, timing.totalMS, timing.totalMS / aFrames, timing.maxMS);
+		}
+	}
+}
+
+int main(int aArgumentCount, char* aArguments[])
+{
+	BenchmarkSettings settings;
+	std::vector<ModeRun> modes;
+	if (!ParseArguments(aArgumentCount, aArguments, settings, modes)) return 1;
+	if (settings.frames == 0) settings.frames = 1;
+
+	Engine::Initialize(settings.workers);
+	Engine& engine = Engine::Get();
+	engine.SetFixedTimestep(settings.rate);
+
+	if (!modes.empty())
+	{
+		for (const ModeRun& modeRun : modes)
+		{
+			modeRun.mode->run(settings, modeRun.count);
+			std::printf("\n");
+		}
+
+		Engine::Shutdown();
+		return 0;
+	}
+
+	{
+		Scene scene;
+		scene.SetUpdateMode(settings.parallel ? SceneUpdateMode::Parallel : SceneUpdateMode::Serial);
+		CollisionHandler collisionHandler;
+
+		std::printf("Objects: %u (%u static, %u moving, %u moving colliders)\n", settings.objects, settings.staticObjects, settings.objects - settings.staticObjects, settings.colliders);
+		std::printf("Update mode: %s, %u worker threads\n", settings.parallel ? "parallel" : "serial", engine.GetJobSystem().GetWorkerCount());
+		if (settings.rate > 0) std::printf("Simulation rate: %.1f steps per second\n", settings.rate);
+
+		const Clock::time_point setupStart = Clock::now();
+		PopulateScene(scene, settings);
+		NavMesh navMesh = CreateGridNavMesh(settings.navGridSize);
+		const double populateMS = std::chrono::duration<double, std::milli>(Clock::now() - setupStart).count();
+
+		// The first frame starts every component and builds the static index, it's reported on its own.
+		const Clock::time_point firstFrameStart = Clock::now();
+		engine.Update();
+		scene.Update();
+		collisionHandler.TestCollisions(scene);
+		const double firstFrameMS = std::chrono::duration<double, std::milli>(Clock::now() - firstFrameStart).count();
+
+		std::printf("Scene setup: %.2f ms, first frame: %.2f ms\n", populateMS, firstFrameMS);
+
+		std::vector<SubsystemTiming> timings = { { "Timer" }, { "Scene update" }, { "Collisions" }, { "Pathfinding" }, { "Raycasts" }, { "Frame" } };
+		constexpr float RayLength = 100.0f;
+		std::vector<Math::Ray<float>> rays;
+		std::vector<RaycastHit> rayHits;
+		size_t pathPointCount = 0;
+		size_t rayHitCount = 0;
+		CollisionStats collisionStats;
+		unsigned stepCount = 0;
+		const TransformStats transformStatsBefore = TransformStats::GetTotals();
+
+		for (unsigned frame = 0; frame < settings.frames; frame++)
+		{
+			const Clock::time_point frameStart = Clock::now();
+
+			engine.Update();
+			const Clock::time_point timerEnd = Clock::now();
+
+			Clock::duration sceneTime{};
+			Clock::duration collisionTime{};
+			Clock::duration pathTime{};
+			Clock::duration rayTime{};
+
+			for (unsigned step = 0; step < engine.GetSimulationStepCount(); step++, stepCount++)
+			{
+				const Clock::time_point sceneStart = Clock::now();
+				scene.Update();
+				const Clock::time_point sceneEnd = Clock::now();
+
+				collisionHandler.TestCollisions(scene);
+				const Clock::time_point collisionEnd = Clock::now();
+
+				const CollisionStats& stepStats = collisionHandler.GetStats();
+				collisionStats.sweptPairs += stepStats.sweptPairs;
+				collisionStats.overlappingPairs += stepStats.overlappingPairs;
+				collisionStats.maskedPairs += stepStats.maskedPairs;
+				collisionStats.testedPairs += stepStats.testedPairs;
+				collisionStats.collidingPairs += stepStats.collidingPairs;
+				collisionStats.enteredPairs += stepStats.enteredPairs;
+				collisionStats.exitedPairs += stepStats.exitedPairs;
+				collisionStats.callbacks += stepStats.callbacks;
+
+				for (unsigned path = 0; path < settings.paths; path++)
+				{
+					const unsigned seed = stepCount * settings.paths + path;
+					const Math::Vector3f start(static_cast<float>((seed * 37u) % 1000u) * WorldSize / 1000.0f, 0, static_cast<float>((seed * 53u) % 1000u) * WorldSize / 1000.0f);
+					const Math::Vector3f end(static_cast<float>((seed * 71u + 500u) % 1000u) * WorldSize / 1000.0f, 0, static_cast<float>((seed * 97u + 250u) % 1000u) * WorldSize / 1000.0f);
+					pathPointCount += navMesh.FindPath(start, end).GetSize();
+				}
+
+				const Clock::time_point pathEnd = Clock::now();
+
+				if (settings.rays > 0)
+				{
+					CreateRays(stepCount, settings.rays, rays);
+					rayHitCount += collisionHandler.RaycastClosestBatch(scene, rays, rayHits, RayLength);
+				}
+
+				sceneTime += sceneEnd - sceneStart;
+				collisionTime += collisionEnd - sceneEnd;
+				pathTime += pathEnd - collisionEnd;
+				rayTime += Clock::now() - pathEnd;
+			}
+
+			const Clock::time_point frameEnd = Clock::now();
+			timings[0].Add(timerEnd - frameStart);
+			timings[1].Add(sceneTime);
+			timings[2].Add(collisionTime);
+			timings[3].Add(pathTime);
+			timings[4].Add(rayTime);
+			timings[5].Add(frameEnd - frameStart);
+
+			if (settings.rate > 0)
+			{
+				std::this_thread::sleep_for(std::chrono::duration<float>(engine.GetFixedTimestep().GetTimeUntilNextStep()));
+			}
+		}
+
+		PrintTimings(timings, settings.frames);
+		std::printf("\n%u frames, %u simulation steps, %zu path points found\n", settings.frames, stepCount, pathPointCount);
+
+		const TransformStats transformStats = TransformStats::GetTotals();
+		const size_t inverseRequests = transformStats.inverseWorldMatrixRequests - transformStatsBefore.inverseWorldMatrixRequests;
+		const size_t inverseComputations = transformStats.inverseWorldMatrixComputations - transformStatsBefore.inverseWorldMatrixComputations;
+		const unsigned steps = stepCount > 0 ? stepCount : 1;
+		std::printf("Inverse world matrices per step: %zu used, %zu computed, %zu avoided\n", inverseRequests / steps, inverseComputations / steps, (inverseRequests - inverseComputations) / steps);
+		std::printf("Collider pairs per step: %u swept, %u overlapping, %u masked out, %u tested, %u colliding\n", collisionStats.sweptPairs / steps, collisionStats.overlappingPairs / steps, collisionStats.maskedPairs / steps, collisionStats.testedPairs / steps, collisionStats.collidingPairs / steps);
+		std::printf("Contacts per step: %u entered, %u exited, %u collision callbacks (%zu responses in total)\n", collisionStats.enteredPairs / steps, collisionStats.exitedPairs / steps, collisionStats.callbacks / steps, collisionResponseCount);
+
+		if (settings.rays > 0)
+		{
+			std::printf("Raycasts per step: %u, %zu hits in total\n", settings.rays, rayHitCount);
+
+			// The last step's rays again, without the hierarchy. Nothing has moved since.
+			const double bruteForceMS = TimeMS([&]
+				{
+					for (const Math::Ray<float>& ray : rays)
+					{
+						RaycastHit hit;
+						RaycastEveryCollider(scene, ray, RayLength, hit);
+					}
+				});
+			std::printf("Testing every collider instead: %.2f ms for the last step's rays\n", bruteForceMS);
+		}
+	}
+
+	Engine::Shutdown();
+	return 0;
+}
@@ -0,0 +1,160 @@
+#include "Enginepch.h"
+#include "Benchmarks.h"
+
+#include "Math/SpatialHashGrid.hpp"
+
+namespace Benchmark
+{
+	void RunIntersectionBenchmark(const BenchmarkSettings& aSettings, unsigned aCount)
+	{
+		std::mt19937 random(1234);
+		IntersectionShapes shapes;
+		CreateIntersectionShapes(aCount, random, shapes);
+
+		std::vector<uint32_t> indices(aCount);
+
+		struct Kernel
+		{
+			const char* name;
+			std::function<uint32_t(unsigned aQuery, uint32_t* outIndices)> batch;
+			std::function<uint32_t(unsigned aQuery, uint32_t* outIndices)> scalar;
+		};
+
+		auto scalarLoop = [aCount](auto&& aTest, uint32_t* outIndices)
+			{
+				uint32_t count = 0;
+				for (uint32_t i = 0; i < aCount; i++)
+				{
+					if (aTest(i)) outIndices[count++] = i;
+				}
+				return count;
+			};
+
+		const std::vector<Kernel> kernels = {
+			{ "AABB-AABB",
+				[&](unsigned aQuery, uint32_t* outIndices) { return Math::IntersectionBetweenAABBSBatch(shapes.aabbs[aQuery], shapes.aabbBatch, 0, aCount, outIndices); },
+				[&](unsigned aQuery, uint32_t* outIndices) { return scalarLoop([&](uint32_t i) { return Math::IntersectionBetweenAABBS(shapes.aabbs[aQuery], shapes.aabbs[i]); }, outIndices); } },
+			{ "Sphere-AABB",
+				[&](unsigned aQuery, uint32_t* outIndices) { return Math::IntersectionSphereAABBBatch(shapes.spheres[aQuery], shapes.aabbBatch, 0, aCount, outIndices); },
+				[&](unsigned aQuery, uint32_t* outIndices) { return scalarLoop([&](uint32_t i) { return Math::IntersectionSphereAABB(shapes.spheres[aQuery], shapes.aabbs[i]); }, outIndices); } },
+			{ "Sphere-Sphere",
+				[&](unsigned aQuery, uint32_t* outIndices) { return Math::IntersectionBetweenSpheresBatch(shapes.spheres[aQuery], shapes.sphereBatch, 0, aCount, outIndices); },
+				[&](unsigned aQuery, uint32_t* outIndices) { return scalarLoop([&](uint32_t i) { return Math::IntersectionBetweenSpheres(shapes.spheres[aQuery], shapes.spheres[i]); }, outIndices); } },
+			{ "Ray-AABB",
+				[&](unsigned aQuery, uint32_t* outIndices) { return Math::IntersectionAABBRayBatch(shapes.rays[aQuery], shapes.aabbBatch, 0, aCount, outIndices); },
+				[&](unsigned aQuery, uint32_t* outIndices) { return scalarLoop([&](uint32_t i) { return Math::IntersectionAABBRay(shapes.aabbs[i], shapes.rays[aQuery]); }, outIndices); } },
+		};
+
+		constexpr unsigned QueriesPerFrame = 256;
+		std::printf("Batch intersection tests: %s, %u shapes, %u queries per frame, %u frames\n", Math::GetIntersectionBatchInstructionSet(), aCount, QueriesPerFrame, aSettings.frames);
+		PrintComparisonHeader("Test", "Scalar ms/frame", "Batch ms/frame");
+
+		for (const Kernel& kernel : kernels)
+		{
+			// The hit counts keep either loop from being optimized away.
+			uint64_t hits = 0;
+			auto timeKernel = [&](const std::function<uint32_t(unsigned, uint32_t*)>& aKernel)
+				{
+					return TimeMS([&]
+						{
+							for (unsigned frame = 0; frame < aSettings.frames; frame++)
+							{
+								for (unsigned query = 0; query < QueriesPerFrame; query++)
+								{
+									hits += aKernel((frame * QueriesPerFrame + query) % aCount, indices.data());
+								}
+							}
+						}) / aSettings.frames;
+				};
+
+			const double scalarMS = timeKernel(kernel.scalar);
+			const double batchMS = timeKernel(kernel.batch);
+			if (hits == 1) std::printf(" ");
+			PrintComparison(kernel.name, scalarMS, batchMS);
+		}
+	}
+
+	void RunNeighbourBenchmark(const BenchmarkSettings& aSettings, unsigned aCount)
+	{
+		// Agents spread out on the ground at the same density whatever their count, about 20 within reach of each.
+		constexpr float NeighbourRadius = 50.0f;
+		constexpr float AgentSpacing = 20.0f;
+		constexpr float AgentSpeed = 40.0f;
+		const float areaSize = std::sqrt(static_cast<float>(aCount)) * AgentSpacing;
+
+		std::mt19937 random(1234);
+		std::uniform_real_distribution<float> coordinate(0, areaSize);
+		std::uniform_real_distribution<float> angle(0, 6.2831853f);
+
+		std::vector<Math::Vector3f> positions;
+		std::vector<Math::Vector3f> velocities;
+		for (unsigned i = 0; i < aCount; i++)
+		{
+			const float direction = angle(random);
+			positions.emplace_back(coordinate(random), 0, coordinate(random));
+			velocities.emplace_back(std::cos(direction) * AgentSpeed, 0, std::sin(direction) * AgentSpeed);
+		}
+
+		Math::SpatialHashGrid<float> grid(NeighbourRadius);
+		for (uint32_t i = 0; i < aCount; i++)
+		{
+			grid.Insert(i, positions[i]);
+		}
+
+		// Agents bounce off the edges of the area, so the density stays the same.
+		auto moveAgents = [&positions, &velocities, areaSize]()
+			{
+				constexpr float DeltaTime = 1.0f / 60.0f;
+				for (size_t i = 0; i < positions.size(); i++)
+				{
+					positions[i] += velocities[i] * DeltaTime;
+					if (positions[i].x < 0 || positions[i].x > areaSize) velocities[i].x = -velocities[i].x;
+					if (positions[i].z < 0 || positions[i].z > areaSize) velocities[i].z = -velocities[i].z;
+				}
+			};
+
+		std::vector<uint32_t> neighbours;
+		uint64_t gridNeighbourCount = 0;
+		const double gridMS = TimeMS([&]
+			{
+				for (unsigned frame = 0; frame < aSettings.frames; frame++)
+				{
+					moveAgents();
+					for (uint32_t i = 0; i < aCount; i++)
+					{
+						grid.Move(i, positions[i]);
+					}
+
+					for (uint32_t i = 0; i < aCount; i++)
+					{
+						neighbours.clear();
+						gridNeighbourCount += grid.QueryRadius(positions[i], NeighbourRadius, neighbours);
+					}
+				}
+			});
+
+		// Looping over every agent takes seconds per frame with tens of thousands of them, so it's timed on fewer frames
+		// where the grid left the agents.
+		const unsigned bruteForceFrames = aCount > 10000 ? 1 : (aSettings.frames < 10 ? aSettings.frames : 10);
+		const float radiusSqr = NeighbourRadius * NeighbourRadius;
+		uint64_t bruteForceNeighbourCount = 0;
+		const double bruteForceMS = TimeMS([&]
+			{
+				for (unsigned frame = 0; frame < bruteForceFrames; frame++)
+				{
+					for (uint32_t i = 0; i < aCount; i++)
+					{
+						for (uint32_t j = 0; j < aCount; j++)
+						{
+							if ((positions[j] - positions[i]).LengthSqr() <= radiusSqr) bruteForceNeighbourCount++;
+						}
+					}
+				}
+			});
+
+		if (bruteForceNeighbourCount == 1) std::printf(" ");
+		std::printf("%u agents, %u frames, %.1f neighbours per agent\n", aCount, aSettings.frames, static_cast<double>(gridNeighbourCount) / (static_cast<double>(aSettings.frames) * aCount));
+		PrintComparisonHeader("Neighbours", "Every agent ms", "Grid ms");
+		PrintComparison("Per frame", bruteForceMS / bruteForceFrames, gridMS / aSettings.frames);
+	}
+}
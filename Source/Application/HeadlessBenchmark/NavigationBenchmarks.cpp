@@ -0,0 +1,136 @@
+#include "Enginepch.h"
+#include "Benchmarks.h"
+#include "ReferenceImplementations.h"
+
+#include "Pathfinding/NavMeshPath.h"
+
+namespace Benchmark
+{
+	void RunNavMeshQueryBenchmark(const BenchmarkSettings& aSettings, unsigned aCount)
+	{
+		const std::vector<NavPolygon> polygons = CreateGridPolygons(aSettings.navGridSize);
+		NavMesh navMesh;
+		const double buildMS = TimeMS([&navMesh, &aSettings] { navMesh = CreateGridNavMesh(aSettings.navGridSize); });
+
+		// A tenth of the points and rays are off the navmesh, where the closest edge is looked for instead.
+		std::mt19937 random(1234);
+		std::uniform_real_distribution<float> coordinate(-0.05f * WorldSize, 1.05f * WorldSize);
+		std::uniform_real_distribution<float> height(-20.0f, 40.0f);
+		std::vector<Math::Vector3f> points;
+		std::vector<Math::Ray<float>> rays;
+		for (unsigned i = 0; i < aCount; i++)
+		{
+			points.emplace_back(coordinate(random), height(random), coordinate(random));
+
+			const Math::Vector3f origin(coordinate(random), 500.0f, coordinate(random));
+			const Math::Vector3f target(coordinate(random), 0, coordinate(random));
+			rays.emplace_back(origin, (target - origin).GetNormalized());
+		}
+
+		// Going through every polygon takes milliseconds per query on a big navmesh, so it only does some of them.
+		const unsigned referenceCount = aCount < 500 ? aCount : 500;
+		Math::Vector3f pointSum;
+		auto timeQueries = [&pointSum](unsigned aQueryCount, auto&& aQuery)
+			{
+				return TimeMS([&] { for (unsigned i = 0; i < aQueryCount; i++) pointSum += aQuery(i); }) * 1000.0 / aQueryCount;
+			};
+
+		const double clampUS = timeQueries(aCount, [&](unsigned i) { return navMesh.ClampToNavMesh(points[i]); });
+		const double clampReferenceUS = timeQueries(referenceCount, [&](unsigned i) { return ClampToEveryPolygon(polygons, points[i]); });
+		const double rayUS = timeQueries(aCount, [&](unsigned i)
+			{
+				Math::Vector3f hitPoint;
+				navMesh.RayCast(rays[i], hitPoint, true);
+				return hitPoint;
+			});
+		const double rayReferenceUS = timeQueries(referenceCount, [&](unsigned i)
+			{
+				Math::Vector3f hitPoint;
+				RayCastEveryPolygon(polygons, navMesh.GetBoundingBox(), rays[i], hitPoint);
+				return hitPoint;
+			});
+
+		std::printf("%zu triangles, %u queries of each kind (%u going through every polygon), navmesh built in %.2f ms\n", polygons.size(), aCount, referenceCount, buildMS);
+		PrintComparisonHeader("Query", "Every polygon us", "Spatial index us");
+		PrintComparison("ClampToNavMesh", clampReferenceUS, clampUS);
+		PrintComparison("RayCast", rayReferenceUS, rayUS);
+		std::printf("\nPoint checksum %.1f\n", pointSum.x + pointSum.y + pointSum.z);
+	}
+
+	void RunNavPortalBenchmark(const BenchmarkSettings&, unsigned aCount)
+	{
+		std::vector<NavNode> nodes;
+		const std::vector<NavPolygon> polygons = CreateHillyPolygons(aCount, nodes);
+
+		size_t portalCount = 0;
+		const double hashMS = TimeMS([&] { portalCount = NavMesh::CreatePortals(polygons, nodes).size(); });
+		const double referenceMS = TimeMS([&] { CreatePortalsComparingEveryPolygon(polygons, nodes); });
+
+		std::printf("%zu triangles, %zu portals\n", polygons.size(), portalCount);
+		PrintComparisonHeader("Portals", "Every polygon ms", "Shared vertex ms");
+		PrintComparison("Build", referenceMS, hashMS);
+	}
+
+	void RunRepathBenchmark(const BenchmarkSettings& aSettings, unsigned aCount)
+	{
+		// Walls make most of the paths search instead of going straight.
+		constexpr unsigned WallSpacing = 16;
+		NavMesh navMesh = CreateGridNavMesh(aSettings.navGridSize, WallSpacing);
+
+		std::mt19937 random(1234);
+		std::uniform_real_distribution<float> coordinate(0.01f * WorldSize, 0.99f * WorldSize);
+		std::vector<Math::Vector3f> starts;
+		std::vector<Math::Vector3f> ends;
+		for (unsigned i = 0; i < aCount; i++)
+		{
+			starts.emplace_back(coordinate(random), 0, coordinate(random));
+			ends.emplace_back(coordinate(random), 0, coordinate(random));
+		}
+
+		size_t pathPointCount = 0;
+		const double findMS = TimeMS([&]
+			{
+				for (unsigned i = 0; i < aCount; i++)
+				{
+					pathPointCount += navMesh.FindPath(starts[i], ends[i]).GetSize();
+				}
+			});
+
+		// Half of the agents get a callback, the other half poll for their path every frame like NavMeshAgent does.
+		std::vector<PathRequestID> requests;
+		for (unsigned i = 0; i < aCount; i++)
+		{
+			PathCallback callback;
+			if (i % 2 == 0)
+			{
+				callback = [&pathPointCount](const PathRequestID, const NavMeshPath& aPath) { pathPointCount += aPath.GetSize(); };
+			}
+
+			requests.emplace_back(navMesh.RequestPath(starts[i], ends[i], callback));
+		}
+
+		double worstFrameMS = 0;
+		double queuedMS = 0;
+		unsigned frame = 0;
+		for (; navMesh.GetPendingPathRequestCount() > 0; frame++)
+		{
+			const double frameMS = TimeMS([&]
+				{
+					navMesh.UpdatePathRequests(aSettings.pathBudget);
+					for (unsigned i = 1; i < aCount; i += 2)
+					{
+						NavMeshPath path;
+						if (navMesh.TakePath(requests[i], path)) pathPointCount += path.GetSize();
+					}
+				});
+
+			worstFrameMS = frameMS > worstFrameMS ? frameMS : worstFrameMS;
+			queuedMS += frameMS;
+		}
+
+		std::printf("%u agents repathing at once, %zu triangles, %u search steps per frame, %zu path points\n", aCount, CreateGridPolygons(aSettings.navGridSize, WallSpacing).size(), aSettings.pathBudget, pathPointCount);
+		std::printf("\n%-16s %14s %10s %12s\n", "Paths", "Worst frame ms", "Frames", "Total ms");
+		std::printf("%-16s %14.3f %10u %12.3f\n", "FindPath", findMS, 1u, findMS);
+		std::printf("%-16s %14.3f %10u %12.3f\n", "Path requests", worstFrameMS, frame, queuedMS);
+	}
+}
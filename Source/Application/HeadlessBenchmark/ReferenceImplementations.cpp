@@ -0,0 +1,155 @@
+#include "Enginepch.h"
+#include "ReferenceImplementations.h"
+
+#include "ComponentSystem/Components/Physics/Colliders/Collider.h"
+#include "Math/Intersection3D.hpp"
+
+namespace Benchmark
+{
+	namespace
+	{
+		const bool IsPointInsidePolygon(const NavPolygon& aPolygon, const Math::Vector3f& aPosition)
+		{
+			const Math::Vector3f u = (aPolygon.vertexPositions[1] - aPosition).Cross(aPolygon.vertexPositions[2] - aPosition);
+			const Math::Vector3f v = (aPolygon.vertexPositions[2] - aPosition).Cross(aPolygon.vertexPositions[0] - aPosition);
+			const Math::Vector3f w = (aPolygon.vertexPositions[0] - aPosition).Cross(aPolygon.vertexPositions[1] - aPosition);
+			return u.Dot(v) >= 0 && u.Dot(w) >= 0;
+		}
+	}
+
+	const Math::Vector3f ClampToEveryPolygon(const std::vector<NavPolygon>& aPolygons, const Math::Vector3f& aPosition)
+	{
+		const Math::Ray<float> ray(aPosition + Math::Vector3f(0, 50.0f, 0), Math::Vector3f(0, -1.0f, 0));
+		for (const NavPolygon& polygon : aPolygons)
+		{
+			Math::Plane<float> plane;
+			plane.InitWith3Points(polygon.vertexPositions[0], polygon.vertexPositions[1], polygon.vertexPositions[2]);
+
+			Math::Vector3f hitPoint;
+			if (Math::IntersectionPlaneRay(plane, ray, hitPoint) && IsPointInsidePolygon(polygon, hitPoint)) return hitPoint;
+		}
+
+		Math::Vector3f closestPoint = aPosition;
+		float closestDistance = FLT_MAX;
+		for (const NavPolygon& polygon : aPolygons)
+		{
+			for (int edge = 0; edge < 3; edge++)
+			{
+				const Math::Vector3f point = Math::Vector3f::ClosestPointOnSegment(polygon.vertexPositions[edge], polygon.vertexPositions[(edge + 1) % 3], aPosition);
+				const float distance = (aPosition - point).LengthSqr();
+				if (distance < closestDistance)
+				{
+					closestPoint = point;
+					closestDistance = distance;
+				}
+			}
+		}
+
+		return closestPoint;
+	}
+
+	const bool RayCastEveryPolygon(const std::vector<NavPolygon>& aPolygons, const Math::AABB3D<float>& aBoundingBox, Math::Ray<float> aRay, Math::Vector3f& outHitPoint)
+	{
+		if (!Math::IntersectionAABBRay(aBoundingBox, aRay, outHitPoint) && !aBoundingBox.IsInside(aRay.GetOrigin())) return false;
+
+		float closestDistance = FLT_MAX;
+		for (const NavPolygon& polygon : aPolygons)
+		{
+			const Math::Plane<float> plane(polygon.vertexPositions[0], polygon.vertexPositions[1], polygon.vertexPositions[2]);
+
+			Math::Vector3f hitPoint;
+			if (Math::IntersectionPlaneRay(plane, aRay, hitPoint) && IsPointInsidePolygon(polygon, hitPoint) && hitPoint.LengthSqr() < closestDistance)
+			{
+				outHitPoint = hitPoint;
+				closestDistance = hitPoint.LengthSqr();
+			}
+		}
+
+		if (closestDistance < FLT_MAX) return true;
+
+		const Math::Vector3f rayEnd = aRay.GetOrigin() + aRay.GetDirection() * 10000.0f;
+		for (const NavPolygon& polygon : aPolygons)
+		{
+			for (int edge = 0; edge < 3; edge++)
+			{
+				const auto closestPoints = Math::Vector3f::ClosestPointsSegmentSegment(aRay.GetOrigin(), rayEnd, polygon.vertexPositions[edge], polygon.vertexPositions[(edge + 1) % 3]);
+				const float distance = (std::get<0>(closestPoints) - std::get<1>(closestPoints)).LengthSqr();
+				if (distance < closestDistance)
+				{
+					outHitPoint = std::get<1>(closestPoints);
+					closestDistance = distance;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	std::vector<NavPortal> CreatePortalsComparingEveryPolygon(const std::vector<NavPolygon>& aPolygons, const std::vector<NavNode>& aNodes)
+	{
+		std::vector<NavPortal> portals;
+		for (int i = 0; i < static_cast<int>(aPolygons.size()); i++)
+		{
+			for (int j = 0; j < static_cast<int>(aPolygons.size()); j++)
+			{
+				if (i == j) continue;
+
+				std::array<Math::Vector3f, 2> sharedVertices;
+				int sharedCount = 0;
+				for (const Math::Vector3f& vertex : aPolygons[j].vertexPositions)
+				{
+					if (std::find(aPolygons[i].vertexPositions.begin(), aPolygons[i].vertexPositions.end(), vertex) != aPolygons[i].vertexPositions.end())
+					{
+						sharedVertices[sharedCount++] = vertex;
+					}
+				}
+
+				if (sharedCount == 2)
+				{
+					NavPortal& portal = portals.emplace_back();
+					portal.nodes = { i, j };
+					portal.vertices = sharedVertices;
+					portal.cost = (aNodes[i].position - aNodes[j].position).Length();
+				}
+			}
+		}
+
+		return portals;
+	}
+
+	const bool RaycastEveryCollider(Scene& aScene, const Math::Ray<float>& aRay, const float aMaxDistance, RaycastHit& outHit)
+	{
+		bool hasHit = false;
+		outHit.distance = aMaxDistance;
+
+		aScene.Each<Collider>([&aRay, &hasHit, &outHit](Collider& aCollider)
+			{
+				Math::Vector3f hitPoint;
+				if (!aCollider.GetActive() || !aCollider.TestCollision(aRay, hitPoint)) return;
+
+				const float distance = (hitPoint - aRay.GetOrigin()).Length();
+				if (distance > outHit.distance) return;
+
+				hasHit = true;
+				outHit.gameObject = aCollider.gameObject;
+				outHit.distance = distance;
+			});
+
+		return hasHit;
+	}
+
+	void EraseGameObjectsOneByOne(std::vector<std::shared_ptr<GameObject>>& inoutGameObjects, const std::vector<std::shared_ptr<GameObject>>& aGameObjectsToErase)
+	{
+		for (const std::shared_ptr<GameObject>& gameObjectToErase : aGameObjectsToErase)
+		{
+			for (size_t i = 0; i < inoutGameObjects.size(); i++)
+			{
+				if (inoutGameObjects[i] == gameObjectToErase)
+				{
+					inoutGameObjects.erase(inoutGameObjects.begin() + i);
+					break;
+				}
+			}
+		}
+	}
+}
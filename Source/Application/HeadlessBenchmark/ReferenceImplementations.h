@@ -0,0 +1,46 @@
+#pragma once
+#include "ComponentSystem/Scene.h"
+#include "CollisionHandler/CollisionHandler.h"
+#include "Pathfinding/NavMesh.h"
+
+// The straightforward ways the engine used to do things before they got faster, kept to time against in the benchmark
+// and to check the engine's results against in the tests.
+namespace Benchmark
+{
+	// NavMesh::ClampToNavMesh: a ray down through every polygon, then the closest point on every edge.
+	const Math::Vector3f ClampToEveryPolygon(const std::vector<NavPolygon>& aPolygons, const Math::Vector3f& aPosition);
+	// NavMesh::RayCast with aClampToNavMesh: the closest hit polygon, or the closest point on any edge to the ray. The ray
+	// is taken by value like RayCast does, since copying a ray normalizes its direction again.
+	const bool RayCastEveryPolygon(const std::vector<NavPolygon>& aPolygons, const Math::AABB3D<float>& aBoundingBox, Math::Ray<float> aRay, Math::Vector3f& outHitPoint);
+	// AssetManager's CreateNavPortals: compare every polygon to every other one.
+	std::vector<NavPortal> CreatePortalsComparingEveryPolygon(const std::vector<NavPolygon>& aPolygons, const std::vector<NavNode>& aNodes);
+	// CollisionHandler::Raycast, but keeping the closest hit: test the ray against every collider.
+	const bool RaycastEveryCollider(Scene& aScene, const Math::Ray<float>& aRay, const float aMaxDistance, RaycastHit& outHit);
+
+	// Scene's FindGameObjectByName, ByID and ByNetworkID: go through the game objects until one matches.
+	template <typename Predicate>
+	std::shared_ptr<GameObject> FindGameObjectByScanning(const std::vector<std::shared_ptr<GameObject>>& aGameObjects, Predicate&& aPredicate)
+	{
+		for (const std::shared_ptr<GameObject>& gameObject : aGameObjects)
+		{
+			if (aPredicate(*gameObject)) return gameObject;
+		}
+
+		return std::shared_ptr<GameObject>();
+	}
+
+	// Scene::DestroyInternal: find every destroyed object in the scene's game objects and erase it on its own.
+	void EraseGameObjectsOneByOne(std::vector<std::shared_ptr<GameObject>>& inoutGameObjects, const std::vector<std::shared_ptr<GameObject>>& aGameObjectsToErase);
+
+	// GameObject::GetComponent: cast every component of the object in turn until one is a T.
+	template <typename T>
+	std::shared_ptr<T> GetComponentByCasting(const std::vector<std::shared_ptr<Component>>& aComponents)
+	{
+		for (const std::shared_ptr<Component>& component : aComponents)
+		{
+			if (std::shared_ptr<T> castedComponent = std::dynamic_pointer_cast<T>(component)) return castedComponent;
+		}
+
+		return std::shared_ptr<T>();
+	}
+}
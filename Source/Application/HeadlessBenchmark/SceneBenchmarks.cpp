@@ -0,0 +1,404 @@
+#include "Enginepch.h"
+#include "Benchmarks.h"
+#include "ReferenceImplementations.h"
+
+#include "ComponentSystem/GameObject.h"
+#include "ComponentSystem/PrefabRegistry.h"
+#include "ComponentSystem/Components/Transform.h"
+#include "ComponentSystem/Components/Movement/Rotator.h"
+#include "ComponentSystem/Components/Movement/MoveBetweenPoints.h"
+#include "ComponentSystem/Components/Physics/Colliders/SphereCollider.h"
+
+#include <numeric>
+
+namespace Benchmark
+{
+	namespace
+	{
+		constexpr const char* SpawnedObjectJson = R"({
+			"Name": "Spawned",
+			"Components": [
+				{ "Type": "Transform", "Position": [ 0, 5, 0 ] },
+				{ "Type": "Rotator", "RotationPerSecond": [ 0, 90, 0 ] },
+				{ "Type": "MoveBetweenPoints", "Speed": 50, "Points": [ [ 0, 5, 0 ], [ 100, 5, 0 ] ] },
+				{ "Type": "SphereCollider", "Radius": 4 }
+			]
+		})";
+
+		// Builds a game object the way SceneLoader does, by component type name and Deserialize.
+		std::shared_ptr<GameObject> CreateGameObjectFromJson(nl::json& aGO)
+		{
+			std::shared_ptr<GameObject> newGO = MakePooled<GameObject>();
+			newGO->SetName(aGO["Name"].get<std::string>());
+
+			for (auto& comp : aGO["Components"])
+			{
+				std::shared_ptr<Component> newComponent;
+				const std::string type = comp["Type"];
+
+				if (type == "Transform") newComponent = newGO->AddComponent<Transform>();
+				else if (type == "Rotator") newComponent = newGO->AddComponent<Rotator>();
+				else if (type == "MoveBetweenPoints") newComponent = newGO->AddComponent<MoveBetweenPoints>();
+				else if (type == "SphereCollider") newComponent = newGO->AddComponent<SphereCollider>();
+
+				if (newComponent)
+				{
+					newComponent->Deserialize(comp);
+				}
+			}
+
+			return newGO;
+		}
+
+		// Component types that do nothing, for game objects with any number of different components.
+		constexpr unsigned LookupComponentTypeCount = 16;
+
+		template <unsigned Index>
+		class LookupComponent final : public Component
+		{
+		public:
+			void Start() override {}
+			void Update() override {}
+		};
+
+		// Gives aGameObject the first aCount lookup component types, and keeps them in outComponents too, in the same order.
+		template <unsigned... Indices>
+		void AddLookupComponents(GameObject& aGameObject, unsigned aCount, std::vector<std::shared_ptr<Component>>& outComponents, std::integer_sequence<unsigned, Indices...>)
+		{
+			((Indices < aCount ? outComponents.emplace_back(aGameObject.AddComponent<LookupComponent<Indices>>()), 0 : 0), ...);
+		}
+
+		// Looks up each of the first aCount lookup component types with aLookup and returns how many were found.
+		template <unsigned... Indices, typename Lookup>
+		const unsigned LookUpComponents(unsigned aCount, Lookup&& aLookup, std::integer_sequence<unsigned, Indices...>)
+		{
+			return ((Indices < aCount && aLookup(static_cast<LookupComponent<Indices>*>(nullptr)) ? 1u : 0u) + ...);
+		}
+	}
+
+	void RunSpawnBenchmark(const BenchmarkSettings&, unsigned aCount)
+	{
+		std::vector<Math::Vector3f> positions;
+		positions.reserve(aCount);
+		for (unsigned i = 0; i < aCount; i++)
+		{
+			positions.emplace_back(GetGridPosition(i, aCount) + Math::Vector3f(0, 5.0f, 0));
+		}
+
+		// Both scenes stay alive until the end, so neither run gets to reuse pool slots freed by the other.
+		Scene jsonScene;
+		Scene prefabScene;
+
+		const size_t jsonHeapAllocationsBefore = ObjectPoolStats::heapAllocations;
+		const double jsonMS = TimeMS([&positions, &jsonScene]
+			{
+				for (const Math::Vector3f& position : positions)
+				{
+					nl::json data = nl::json::parse(SpawnedObjectJson);
+					std::shared_ptr<GameObject> go = CreateGameObjectFromJson(data);
+					go->GetComponent<Transform>()->SetTranslation(position);
+					jsonScene.Instantiate(go);
+				}
+			});
+		const size_t jsonHeapAllocations = ObjectPoolStats::heapAllocations - jsonHeapAllocationsBefore;
+
+		PrefabRegistry prefabRegistry;
+		nl::json data = nl::json::parse(SpawnedObjectJson);
+		const PrefabID prefabID = prefabRegistry.Register("Spawned", CreateGameObjectFromJson(data));
+
+		const size_t prefabHeapAllocationsBefore = ObjectPoolStats::heapAllocations;
+		const double prefabMS = TimeMS([&] { prefabRegistry.InstantiateMany(prefabScene, prefabID, positions); });
+		const size_t prefabHeapAllocations = ObjectPoolStats::heapAllocations - prefabHeapAllocationsBefore;
+
+		std::printf("%u spawns, %zu pool heap allocations from JSON, %zu from the prefab\n", aCount, jsonHeapAllocations, prefabHeapAllocations);
+		PrintComparisonHeader("Spawn", "JSON us", "Prefab us");
+		PrintComparison("Per object", jsonMS * 1000.0 / aCount, prefabMS * 1000.0 / aCount);
+	}
+
+	void RunEachBenchmark(const BenchmarkSettings& aSettings, unsigned aCount)
+	{
+		// Every object has a transform, a quarter of them a collider and a tenth are inactive, so both loops have objects
+		// to skip over.
+		Scene scene;
+		scene.Reserve(aCount);
+		std::vector<std::shared_ptr<GameObject>> gameObjects;
+		gameObjects.reserve(aCount);
+		for (unsigned i = 0; i < aCount; i++)
+		{
+			std::shared_ptr<GameObject> go = MakePooled<GameObject>();
+			go->AddComponent<Transform>(GetGridPosition(i, aCount));
+			if (i % 4 == 0) go->AddComponent<SphereCollider>(4.0f);
+			if (i % 3 == 0) go->AddComponent<Rotator>();
+			go->SetActive(i % 10 != 0);
+			scene.Instantiate(go);
+			gameObjects.emplace_back(go);
+		}
+
+		// The game object loop is how CollisionHandler and RenderAssembler went through the scene before Scene::Each.
+		float checksum = 0;
+		auto timeFrames = [&aSettings](auto&& aFrame) { return TimeMS([&] { for (unsigned frame = 0; frame < aSettings.frames; frame++) aFrame(); }) / aSettings.frames; };
+
+		const double iterateLookupMS = timeFrames([&]
+			{
+				for (const std::shared_ptr<GameObject>& go : gameObjects)
+				{
+					if (!go->GetActive()) continue;
+					std::shared_ptr<SphereCollider> collider = go->GetComponent<SphereCollider>();
+					if (!collider) continue;
+					checksum += go->GetComponent<Transform>()->GetTranslation().x + collider->GetSphere().GetRadius();
+				}
+			});
+		const double iterateEachMS = timeFrames([&]
+			{
+				scene.Each<Transform, SphereCollider>([&checksum](Transform& aTransform, SphereCollider& aCollider) { checksum += aTransform.GetTranslation().x + aCollider.GetSphere().GetRadius(); });
+			});
+
+		const double updateLookupMS = timeFrames([&]
+			{
+				for (const std::shared_ptr<GameObject>& go : gameObjects)
+				{
+					if (!go->GetActive()) continue;
+					if (std::shared_ptr<Transform> transform = go->GetComponent<Transform>()) transform->AddTranslation(0.01f, 0, 0);
+				}
+			});
+		const double updateEachMS = timeFrames([&]
+			{
+				scene.Each<Transform>([](Transform& aTransform) { aTransform.AddTranslation(0.01f, 0, 0); });
+			});
+
+		if (checksum == 1.2345f) std::printf(" ");
+		std::printf("%u objects, %u frames, colliders read on a quarter and every transform moved\n", aCount, aSettings.frames);
+		PrintComparisonHeader("Each", "GetComponent ms", "Scene::Each ms");
+		PrintComparison("Iterate", iterateLookupMS, iterateEachMS);
+		PrintComparison("Update", updateLookupMS, updateEachMS);
+	}
+
+	void RunGetComponentBenchmark(const BenchmarkSettings& aSettings, unsigned aCount)
+	{
+		constexpr auto ComponentTypes = std::make_integer_sequence<unsigned, LookupComponentTypeCount>();
+		std::printf("%u game objects, %u frames, every component of every object looked up each frame\n", aCount, aSettings.frames);
+		PrintComparisonHeader("Components", "Casting ns", "Slot table ns");
+
+		for (unsigned componentCount = 1; componentCount <= LookupComponentTypeCount; componentCount *= 2)
+		{
+			std::vector<std::shared_ptr<GameObject>> gameObjects;
+			std::vector<std::vector<std::shared_ptr<Component>>> components(aCount);
+			for (unsigned i = 0; i < aCount; i++)
+			{
+				gameObjects.emplace_back(MakePooled<GameObject>());
+				AddLookupComponents(*gameObjects.back(), componentCount, components[i], ComponentTypes);
+			}
+
+			// Every lookup has to find its component, which keeps the loops from being optimized away too.
+			size_t foundCount = 0;
+			const double castingMS = TimeMS([&]
+				{
+					for (unsigned frame = 0; frame < aSettings.frames; frame++)
+					{
+						for (unsigned i = 0; i < aCount; i++)
+						{
+							foundCount += LookUpComponents(componentCount, [&](auto* aType) { return GetComponentByCasting<std::remove_pointer_t<decltype(aType)>>(components[i]) != nullptr; }, ComponentTypes);
+						}
+					}
+				});
+			const double tableMS = TimeMS([&]
+				{
+					for (unsigned frame = 0; frame < aSettings.frames; frame++)
+					{
+						for (unsigned i = 0; i < aCount; i++)
+						{
+							foundCount += LookUpComponents(componentCount, [&](auto* aType) { return gameObjects[i]->GetComponent<std::remove_pointer_t<decltype(aType)>>() != nullptr; }, ComponentTypes);
+						}
+					}
+				});
+
+			const double lookupCount = static_cast<double>(aSettings.frames) * aCount * componentCount;
+			if (foundCount != 2 * static_cast<size_t>(lookupCount)) std::printf("Only %zu of the components were found\n", foundCount);
+
+			char name[16];
+			std::snprintf(name, sizeof(name), "%u", componentCount);
+			PrintComparison(name, castingMS * 1000000.0 / lookupCount, tableMS * 1000000.0 / lookupCount);
+		}
+	}
+
+	void RunFindBenchmark(const BenchmarkSettings& aSettings, unsigned aCount)
+	{
+		Scene scene;
+		std::vector<std::shared_ptr<GameObject>> gameObjects;
+		std::vector<std::string> names;
+		for (unsigned i = 0; i < aCount; i++)
+		{
+			names.emplace_back("Object" + std::to_string(i));
+			gameObjects.emplace_back(MakePooled<GameObject>());
+			gameObjects.back()->SetName(names.back());
+			gameObjects.back()->SetNetworkID(i + 1);
+			scene.Instantiate(gameObjects.back());
+		}
+
+		// Looks up LookupsPerFrame objects spread over the scene every frame, so the scans go halfway through it on average.
+		constexpr unsigned LookupsPerFrame = 1000;
+		unsigned lookupIndex = 0;
+		size_t foundCount = 0;
+		auto timeLookups = [&](auto&& aLookup)
+			{
+				return TimeMS([&]
+					{
+						for (unsigned frame = 0; frame < aSettings.frames; frame++)
+						{
+							for (unsigned lookup = 0; lookup < LookupsPerFrame; lookup++)
+							{
+								lookupIndex = (lookupIndex + 7919u) % aCount;
+								if (aLookup(lookupIndex)) foundCount++;
+							}
+						}
+					}) / aSettings.frames;
+			};
+
+		const double nameScanMS = timeLookups([&](unsigned i) { return FindGameObjectByScanning(gameObjects, [&](const GameObject& aGO) { return aGO.GetName() == names[i]; }); });
+		const double nameIndexMS = timeLookups([&](unsigned i) { return scene.FindGameObjectByName(names[i]); });
+		const double idScanMS = timeLookups([&](unsigned i) { return FindGameObjectByScanning(gameObjects, [i](const GameObject& aGO) { return aGO.GetID() == i; }); });
+		const double idIndexMS = timeLookups([&](unsigned i) { return scene.FindGameObjectByID(i); });
+		const double networkIDScanMS = timeLookups([&](unsigned i) { return FindGameObjectByScanning(gameObjects, [i](const GameObject& aGO) { return aGO.GetNetworkID() == i + 1; }); });
+		const double networkIDIndexMS = timeLookups([&](unsigned i) { return scene.FindGameObjectByNetworkID(i + 1); });
+
+		std::printf("%u game objects, %u frames of %u lookups of each kind\n", aCount, aSettings.frames, LookupsPerFrame);
+		if (foundCount != 6 * static_cast<size_t>(aSettings.frames) * LookupsPerFrame) std::printf("Only %zu of the game objects were found\n", foundCount);
+		PrintComparisonHeader("Find by", "Scan ms/frame", "Index ms/frame");
+		PrintComparison("Name", nameScanMS, nameIndexMS);
+		PrintComparison("ID", idScanMS, idIndexMS);
+		PrintComparison("Network ID", networkIDScanMS, networkIDIndexMS);
+	}
+
+	void RunDestroyBenchmark(const BenchmarkSettings&, unsigned aCount)
+	{
+		std::printf("%u game objects with a transform, every 10th or every other one destroyed in one frame\n", aCount);
+		PrintComparisonHeader("Destroyed", "One by one ms", "Scene ms");
+
+		for (const unsigned stride : { 10u, 2u })
+		{
+			Scene scene;
+			std::vector<std::shared_ptr<GameObject>> gameObjects;
+			std::vector<std::shared_ptr<GameObject>> gameObjectsToDestroy;
+			for (unsigned i = 0; i < aCount; i++)
+			{
+				std::shared_ptr<GameObject> go = MakePooled<GameObject>();
+				go->AddComponent<Transform>(GetGridPosition(i, aCount));
+				scene.Instantiate(go);
+				gameObjects.emplace_back(go);
+				if (i % stride == 0) gameObjectsToDestroy.emplace_back(go);
+			}
+
+			// The scene also takes the objects out of its indices and archetypes, the one by one erase only out of the list.
+			const double oneByOneMS = TimeMS([&] { EraseGameObjectsOneByOne(gameObjects, gameObjectsToDestroy); });
+			const double sceneMS = TimeMS([&]
+				{
+					for (const std::shared_ptr<GameObject>& go : gameObjectsToDestroy)
+					{
+						scene.Destroy(go);
+					}
+
+					scene.Update();
+				});
+
+			if (scene.GetObjectAmount() != gameObjects.size()) std::printf("The scene has %u objects left instead of %zu\n", scene.GetObjectAmount(), gameObjects.size());
+
+			char name[16];
+			std::snprintf(name, sizeof(name), "%u%%", 100 / stride);
+			PrintComparison(name, oneByOneMS, sceneMS);
+		}
+	}
+
+	void RunPoolBenchmark(const BenchmarkSettings& aSettings, unsigned aCount)
+	{
+		struct PoolRun
+		{
+			double allocateMS = 0;
+			double iterateMS = 0;
+			double respawnMS = 0;
+			double iterateAfterRespawnMS = 0;
+			size_t heapAllocations = 0;
+			size_t respawnHeapAllocations = 0;
+		};
+
+		auto run = [&aSettings, aCount](auto&& aMakeTransform)
+			{
+				// Strings of random lengths are allocated in between and replaced along with the transforms, like the rest of
+				// a game allocating while objects spawn. Everything is freed at the end, so both runs start from the same heap.
+				PoolRun result;
+				std::mt19937 random(1234);
+				std::uniform_int_distribution<size_t> length(16, 1024);
+				std::vector<std::shared_ptr<Transform>> transforms;
+				std::vector<std::shared_ptr<std::string>> clutter;
+				transforms.reserve(aCount);
+				clutter.reserve(aCount);
+
+				float checksum = 0;
+				auto iterate = [&]
+					{
+						return TimeMS([&]
+							{
+								for (unsigned frame = 0; frame < aSettings.frames; frame++)
+								{
+									for (const std::shared_ptr<Transform>& transform : transforms)
+									{
+										transform->AddTranslation(0.1f, 0, 0);
+										checksum += transform->GetTranslation().x;
+									}
+								}
+							}) / aSettings.frames;
+					};
+
+				const size_t heapAllocationsBefore = ObjectPoolStats::heapAllocations;
+				result.allocateMS = TimeMS([&]
+					{
+						for (unsigned i = 0; i < aCount; i++)
+						{
+							transforms.emplace_back(aMakeTransform(GetGridPosition(i, aCount)));
+							clutter.emplace_back(std::make_shared<std::string>(length(random), 'x'));
+						}
+					});
+				result.heapAllocations = ObjectPoolStats::heapAllocations - heapAllocationsBefore;
+				result.iterateMS = iterate();
+
+				// A tenth of the objects despawn and respawn every frame, in a shuffled order. The pool already has its slots.
+				std::vector<unsigned> respawnOrder(aCount);
+				std::iota(respawnOrder.begin(), respawnOrder.end(), 0u);
+				std::shuffle(respawnOrder.begin(), respawnOrder.end(), random);
+				const unsigned respawnsPerFrame = aCount / 10 > 0 ? aCount / 10 : 1;
+
+				const size_t respawnHeapAllocationsBefore = ObjectPoolStats::heapAllocations;
+				result.respawnMS = TimeMS([&]
+					{
+						unsigned next = 0;
+						for (unsigned frame = 0; frame < aSettings.frames; frame++)
+						{
+							for (unsigned respawn = 0; respawn < respawnsPerFrame; respawn++, next = (next + 1) % aCount)
+							{
+								const unsigned i = respawnOrder[next];
+								transforms[i].reset();
+								clutter[i] = std::make_shared<std::string>(length(random), 'x');
+								transforms[i] = aMakeTransform(GetGridPosition(i, aCount));
+							}
+						}
+					}) / aSettings.frames;
+				result.respawnHeapAllocations = ObjectPoolStats::heapAllocations - respawnHeapAllocationsBefore;
+				result.iterateAfterRespawnMS = iterate();
+
+				if (checksum == 1.2345f) std::printf(" ");
+				return result;
+			};
+
+		// The first run only warms up the heap, so neither of the timed ones is the first to touch its memory.
+		auto makeShared = [](const Math::Vector3f& aPosition) { return std::make_shared<Transform>(aPosition); };
+		run(makeShared);
+		const PoolRun heap = run(makeShared);
+		const PoolRun pooled = run([](const Math::Vector3f& aPosition) { return MakePooled<Transform>(aPosition); });
+
+		std::printf("%u transforms, %u frames, pool heap allocations: %zu to allocate them, %zu while respawning\n", aCount, aSettings.frames, pooled.heapAllocations, pooled.respawnHeapAllocations);
+		PrintComparisonHeader("Transforms", "make_shared ms", "MakePooled ms");
+		PrintComparison("Allocate", heap.allocateMS, pooled.allocateMS);
+		PrintComparison("Iterate/frame", heap.iterateMS, pooled.iterateMS);
+		PrintComparison("Respawn/frame", heap.respawnMS, pooled.respawnMS);
+		PrintComparison("Iterate after", heap.iterateAfterRespawnMS, pooled.iterateAfterRespawnMS);
+	}
+}
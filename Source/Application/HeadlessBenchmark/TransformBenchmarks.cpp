@@ -0,0 +1,134 @@
+#include "Enginepch.h"
+#include "Benchmarks.h"
+
+#include "ComponentSystem/Components/Transform.h"
+
+namespace Benchmark
+{
+	namespace
+	{
+		struct TransformHierarchy
+		{
+			const char* name = nullptr;
+			std::vector<std::shared_ptr<Transform>> roots;
+			std::vector<std::shared_ptr<Transform>> transforms;
+		};
+
+		// aChainCount chains of aDepth transforms each, every transform parented to the one before it.
+		TransformHierarchy CreateTransformHierarchy(const char* aName, unsigned aChainCount, unsigned aDepth)
+		{
+			TransformHierarchy hierarchy;
+			hierarchy.name = aName;
+			for (unsigned chain = 0; chain < aChainCount; chain++)
+			{
+				std::shared_ptr<Transform> parent = MakePooled<Transform>(GetGridPosition(chain, aChainCount));
+				hierarchy.roots.emplace_back(parent);
+				hierarchy.transforms.emplace_back(parent);
+
+				for (unsigned depth = 1; depth < aDepth; depth++)
+				{
+					std::shared_ptr<Transform> child = MakePooled<Transform>(Math::Vector3f(0, 10.0f, 0), Math::Vector3f(0, 5.0f, 0));
+					parent->AddChild(child.get());
+					hierarchy.transforms.emplace_back(child);
+					parent = child;
+				}
+			}
+
+			return hierarchy;
+		}
+
+		TransformHierarchy CreateWideTransformHierarchy(const char* aName, unsigned aChildCount)
+		{
+			TransformHierarchy hierarchy;
+			hierarchy.name = aName;
+			std::shared_ptr<Transform> root = MakePooled<Transform>();
+			hierarchy.roots.emplace_back(root);
+			hierarchy.transforms.emplace_back(root);
+
+			for (unsigned i = 0; i < aChildCount; i++)
+			{
+				std::shared_ptr<Transform> child = MakePooled<Transform>(GetGridPosition(i, aChildCount));
+				root->AddChild(child.get());
+				hierarchy.transforms.emplace_back(child);
+			}
+
+			return hierarchy;
+		}
+
+		// Moves every root aMoves times and reads every world matrix, either once at the end or after every move.
+		const double TimeTransformHierarchy(TransformHierarchy& aHierarchy, unsigned aFrames, unsigned aMoves, bool aReadAfterEveryMove)
+		{
+			float checksum = 0;
+			const double ms = TimeMS([&]
+				{
+					for (unsigned frame = 0; frame < aFrames; frame++)
+					{
+						for (unsigned move = 0; move < aMoves; move++)
+						{
+							for (auto& root : aHierarchy.roots)
+							{
+								root->AddTranslation(0.1f, 0, 0);
+								root->AddRotation(0, 1.0f, 0);
+							}
+
+							if (aReadAfterEveryMove || move + 1 == aMoves)
+							{
+								for (auto& transform : aHierarchy.transforms)
+								{
+									checksum += transform->GetWorldMatrix()(4, 1);
+								}
+							}
+						}
+					}
+				});
+
+			// Keeps the reads from being optimized away.
+			if (checksum == 1.2345f) std::printf(" ");
+			return ms / aFrames;
+		}
+	}
+
+	void RunHierarchyBenchmark(const BenchmarkSettings& aSettings, unsigned aCount)
+	{
+		std::vector<TransformHierarchy> hierarchies;
+		hierarchies.emplace_back(CreateTransformHierarchy("Deep 64x64", 64, 64));
+		hierarchies.emplace_back(CreateWideTransformHierarchy("Wide 1x4096", 4096));
+
+		std::printf("%u frames, roots moved %u times per frame, %zu and %zu transforms\n", aSettings.frames, aCount, hierarchies[0].transforms.size(), hierarchies[1].transforms.size());
+		PrintComparisonHeader("Hierarchy", "Eager ms/frame", "Lazy ms/frame");
+		for (TransformHierarchy& hierarchy : hierarchies)
+		{
+			const double lazyMS = TimeTransformHierarchy(hierarchy, aSettings.frames, aCount, false);
+			const double eagerMS = TimeTransformHierarchy(hierarchy, aSettings.frames, aCount, true);
+			PrintComparison(hierarchy.name, eagerMS, lazyMS);
+		}
+	}
+
+	void RunTransformBenchmark(const BenchmarkSettings& aSettings, unsigned aCount)
+	{
+		std::vector<std::shared_ptr<Transform>> transforms;
+		transforms.reserve(aCount);
+		for (unsigned i = 0; i < aCount; i++)
+		{
+			transforms.emplace_back(MakePooled<Transform>(GetGridPosition(i, aCount), Math::Vector3f(0, static_cast<float>(i % 360), 0), Math::Vector3f(1.0f, 2.0f, 1.0f)));
+		}
+
+		float checksum = 0;
+		const double ms = TimeMS([&]
+			{
+				for (unsigned frame = 0; frame < aSettings.frames; frame++)
+				{
+					for (auto& transform : transforms)
+					{
+						transform->AddTranslation(0.1f, 0, 0);
+						transform->AddRotation(0, 1.0f, 0);
+						checksum += transform->GetWorldMatrix()(4, 1) + transform->GetWorldMatrix()(1, 1);
+					}
+				}
+			});
+
+		if (checksum == 1.2345f) std::printf(" ");
+
+		std::printf("%u transforms, %u frames: %.2f ms per frame, %.1f ns per transform\n", aCount, aSettings.frames, ms / aSettings.frames, ms * 1000000.0 / (static_cast<double>(aSettings.frames) * aCount));
+	}
+}
@@ -0,0 +1,235 @@
+#include "Enginepch.h"
+#include "HeadlessTests.h"
+#include "BenchmarkCommon.h"
+#include "ReferenceImplementations.h"
+
+#include "ComponentSystem/GameObject.h"
+#include "ComponentSystem/Components/Transform.h"
+#include "ComponentSystem/Components/Physics/Colliders/BoxCollider.h"
+#include "ComponentSystem/Components/Physics/Colliders/SphereCollider.h"
+
+using namespace Benchmark;
+
+// The narrowphase on the worker threads has to send the same Enter, Stay and Exit events in the same order as on the
+// main thread.
+TEST_CASE(ContactEvents)
+{
+	const ContactEventLog serial = RunContactScene(60, 2000, SceneUpdateMode::Serial);
+	const ContactEventLog parallel = RunContactScene(60, 2000, SceneUpdateMode::Parallel);
+
+	TEST_CHECK(serial.eventCount > 0);
+	TEST_CHECK(serial.eventCount == parallel.eventCount);
+	TEST_CHECK(serial.hash == parallel.hash);
+}
+
+// The closest hit of every ray through the collider hierarchy has to be the closest one testing every collider finds.
+TEST_CASE(ClosestRaycasts)
+{
+	constexpr unsigned StaticCount = 2000;
+	constexpr unsigned MovingCount = 1000;
+	constexpr float RayLength = 100.0f;
+
+	Scene scene;
+	CollisionHandler collisionHandler;
+	for (unsigned i = 0; i < StaticCount; i++)
+	{
+		std::shared_ptr<GameObject> go = MakePooled<GameObject>();
+		go->AddComponent<Transform>(GetGridPosition(i, StaticCount));
+		go->AddComponent<BoxCollider>(Math::Vector3f(10.0f, 2.0f, 10.0f));
+		go->SetStatic(true);
+		scene.Instantiate(go);
+	}
+
+	for (unsigned i = 0; i < MovingCount; i++)
+	{
+		std::shared_ptr<GameObject> go = MakePooled<GameObject>();
+		go->AddComponent<Transform>(GetGridPosition((i * 7919u) % MovingCount, MovingCount) + Math::Vector3f(3.0f, 0, 3.0f));
+		go->AddComponent<SphereCollider>(6.0f);
+		scene.Instantiate(go);
+	}
+
+	scene.Update();
+	collisionHandler.TestCollisions(scene);
+
+	std::vector<Math::Ray<float>> rays;
+	std::vector<RaycastHit> hits;
+	CreateRays(1, 2000, rays);
+	const unsigned hitCount = collisionHandler.RaycastClosestBatch(scene, rays, hits, RayLength);
+	TEST_CHECK(hitCount > 0);
+
+	for (size_t ray = 0; ray < rays.size(); ray++)
+	{
+		RaycastHit expected;
+		const bool hasHit = RaycastEveryCollider(scene, rays[ray], RayLength, expected);
+		TEST_CHECK(hasHit == (hits[ray].gameObject != nullptr));
+		TEST_CHECK(!hasHit || std::abs(expected.distance - hits[ray].distance) <= 0.001f);
+	}
+}
+
+// A game object's own colliders overlapping each other isn't a collision. Another object overlapping it is, once.
+TEST_CASE(SameObjectColliders)
+{
+	Scene scene;
+	CollisionHandler collisionHandler;
+
+	std::shared_ptr<GameObject> compound = MakePooled<GameObject>();
+	compound->AddComponent<Transform>();
+	compound->AddComponent<SphereCollider>(6.0f);
+	compound->AddComponent<BoxCollider>(Math::Vector3f(4.0f, 4.0f, 4.0f));
+	scene.Instantiate(compound);
+
+	scene.Update();
+	collisionHandler.TestCollisions(scene);
+	TEST_CHECK(collisionHandler.GetStats().testedPairs == 0);
+	TEST_CHECK(collisionHandler.GetStats().collidingPairs == 0);
+
+	std::shared_ptr<GameObject> other = MakePooled<GameObject>();
+	other->AddComponent<Transform>(Math::Vector3f(2.0f, 0, 0));
+	other->AddComponent<SphereCollider>(3.0f);
+	scene.Instantiate(other);
+
+	scene.Update();
+	collisionHandler.TestCollisions(scene);
+	TEST_CHECK(collisionHandler.GetStats().testedPairs == 1);
+	TEST_CHECK(collisionHandler.GetStats().collidingPairs == 1);
+}
+
+// Removing a collider ends its contacts without the collision handler touching it again, and a collider created where
+// the removed one was starts touching with Enter rather than carrying on its Stay.
+TEST_CASE(RemovedColliderContacts)
+{
+	Scene scene;
+	CollisionHandler collisionHandler;
+	std::vector<std::pair<CollisionEvent, GameObject*>> events;
+
+	std::shared_ptr<GameObject> first = MakePooled<GameObject>();
+	first->AddComponent<Transform>();
+	first->AddComponent<SphereCollider>(3.0f)->SetCollisionCallback([&events](const CollisionEvent aEvent, GameObject* aOther)
+		{
+			events.emplace_back(aEvent, aOther);
+		}, { CollisionEvent::Enter, CollisionEvent::Stay, CollisionEvent::Exit });
+	scene.Instantiate(first);
+
+	std::shared_ptr<GameObject> second = MakePooled<GameObject>();
+	second->AddComponent<Transform>(Math::Vector3f(2.0f, 0, 0));
+	const SphereCollider* removedCollider = second->AddComponent<SphereCollider>(3.0f).get();
+	scene.Instantiate(second);
+
+	scene.Update();
+	collisionHandler.TestCollisions(scene);
+	TEST_CHECK(events.size() == 1 && events[0].first == CollisionEvent::Enter && events[0].second == second.get());
+
+	second->RemoveComponent<SphereCollider>();
+	events.clear();
+	scene.Update();
+	collisionHandler.TestCollisions(scene);
+	TEST_CHECK(collisionHandler.GetStats().exitedPairs == 1);
+	TEST_CHECK(events.size() == 1 && events[0].first == CollisionEvent::Exit && events[0].second == nullptr);
+
+	// The pool hands out the removed collider's slot first, so the new collider has the same address.
+	const SphereCollider* newCollider = second->AddComponent<SphereCollider>(3.0f).get();
+	TEST_CHECK(newCollider == removedCollider);
+	events.clear();
+	scene.Update();
+	collisionHandler.TestCollisions(scene);
+	TEST_CHECK(collisionHandler.GetStats().enteredPairs == 1);
+	TEST_CHECK(events.size() == 1 && events[0].first == CollisionEvent::Enter && events[0].second == second.get());
+
+	// A callback removing the other collider keeps that collider's own callback from being called.
+	unsigned secondCallbacks = 0;
+	second->GetComponent<SphereCollider>()->SetCollisionCallback([&secondCallbacks](const CollisionEvent, GameObject*) { secondCallbacks++; }, { CollisionEvent::Stay, CollisionEvent::Exit });
+	first->GetComponent<SphereCollider>()->SetCollisionCallback([&second](const CollisionEvent, GameObject*) { second->RemoveComponent<SphereCollider>(); }, { CollisionEvent::Stay });
+	scene.Update();
+	collisionHandler.TestCollisions(scene);
+	TEST_CHECK(!second->HasComponent<SphereCollider>());
+	TEST_CHECK(secondCallbacks == 0);
+
+	scene.Update();
+	collisionHandler.TestCollisions(scene);
+	TEST_CHECK(collisionHandler.GetStats().exitedPairs == 1);
+	TEST_CHECK(secondCallbacks == 0);
+}
+
+// Queries see objects as they are now: spawned, moved, deactivated or with their collider removed since the last query,
+// with or without collisions being tested in between.
+TEST_CASE(QueryHierarchyUpdates)
+{
+	Scene scene;
+	CollisionHandler collisionHandler;
+	std::vector<GameObject*> found;
+
+	std::shared_ptr<GameObject> first = MakePooled<GameObject>();
+	first->AddComponent<Transform>();
+	first->AddComponent<SphereCollider>(3.0f);
+	scene.Instantiate(first);
+
+	scene.Update();
+	collisionHandler.TestCollisions(scene);
+	TEST_CHECK(collisionHandler.OverlapSphere(scene, Math::Vector3f(), 1.0f, found) == 1 && found[0] == first.get());
+
+	std::shared_ptr<GameObject> second = MakePooled<GameObject>();
+	second->AddComponent<Transform>(Math::Vector3f(100.0f, 0, 0));
+	second->AddComponent<SphereCollider>(3.0f);
+	scene.Instantiate(second);
+
+	RaycastHit hit;
+	TEST_CHECK(collisionHandler.RaycastClosest(scene, Math::Ray<float>(Math::Vector3f(50.0f, 0, 0), Math::Vector3f(1.0f, 0, 0)), hit));
+	TEST_CHECK(hit.gameObject == second.get());
+
+	second->GetComponent<Transform>()->SetTranslation(200.0f, 0, 0);
+	found.clear();
+	TEST_CHECK(collisionHandler.OverlapSphere(scene, Math::Vector3f(100.0f, 0, 0), 1.0f, found) == 0);
+	TEST_CHECK(collisionHandler.OverlapSphere(scene, Math::Vector3f(200.0f, 0, 0), 1.0f, found) == 1 && found[0] == second.get());
+
+	second->RemoveComponent<SphereCollider>();
+	found.clear();
+	TEST_CHECK(collisionHandler.OverlapSphere(scene, Math::Vector3f(200.0f, 0, 0), 1.0f, found) == 0);
+
+	first->SetActive(false);
+	TEST_CHECK(collisionHandler.OverlapSphere(scene, Math::Vector3f(), 1.0f, found) == 0);
+	first->SetActive(true);
+	TEST_CHECK(collisionHandler.OverlapSphere(scene, Math::Vector3f(), 1.0f, found) == 1 && found[0] == first.get());
+}
+
+// A batch of rays on a scene collisions were never tested in finds the same closest hits as testing every collider.
+TEST_CASE(UntestedSceneRaycasts)
+{
+	constexpr unsigned StaticCount = 500;
+	constexpr unsigned MovingCount = 1000;
+	constexpr float RayLength = 100.0f;
+
+	Scene scene;
+	CollisionHandler collisionHandler;
+	for (unsigned i = 0; i < StaticCount; i++)
+	{
+		std::shared_ptr<GameObject> go = MakePooled<GameObject>();
+		go->AddComponent<Transform>(GetGridPosition(i, StaticCount));
+		go->AddComponent<BoxCollider>(Math::Vector3f(10.0f, 2.0f, 10.0f));
+		go->SetStatic(true);
+		scene.Instantiate(go);
+	}
+
+	for (unsigned i = 0; i < MovingCount; i++)
+	{
+		std::shared_ptr<GameObject> go = MakePooled<GameObject>();
+		go->AddComponent<Transform>(GetGridPosition((i * 7919u) % MovingCount, MovingCount) + Math::Vector3f(3.0f, 0, 3.0f));
+		go->AddComponent<SphereCollider>(6.0f);
+		scene.Instantiate(go);
+	}
+
+	scene.Update();
+
+	std::vector<Math::Ray<float>> rays;
+	std::vector<RaycastHit> hits;
+	CreateRays(1, 2000, rays);
+	const unsigned hitCount = collisionHandler.RaycastClosestBatch(scene, rays, hits, RayLength);
+	TEST_CHECK(hitCount > 0);
+
+	for (size_t ray = 0; ray < rays.size(); ray++)
+	{
+		RaycastHit expected;
+		const bool hasHit = RaycastEveryCollider(scene, rays[ray], RayLength, expected);
+		TEST_CHECK(hasHit == (hits[ray].gameObject != nullptr));
+		TEST_CHECK(!hasHit || std::abs(expected.distance - hits[ray].distance) <= 0.001f);
+	}
+}
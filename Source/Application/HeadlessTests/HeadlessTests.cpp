@@ -0,0 +1,69 @@
+#include "Enginepch.h"
+#include "HeadlessTests.h"
+
+#include "Engine.h"
+
+#include <cstring>
+
+// Checks on the headless engine that the faster ways of doing things give the same results as the ways they replaced,
+// and other behaviour that's easy to break without noticing. CMake registers every test with CTest.
+//
+// HeadlessTests [TestName]
+
+namespace
+{
+	struct RegisteredTest
+	{
+		const char* name;
+		Test::TestFunction function;
+	};
+
+	// Function local so registrations from other files' static initialization can't run before it's constructed.
+	std::vector<RegisteredTest>& GetTests()
+	{
+		static std::vector<RegisteredTest> tests;
+		return tests;
+	}
+
+	unsigned failureCount = 0;
+}
+
+Test::TestRegistration::TestRegistration(const char* aName, TestFunction aFunction)
+{
+	GetTests().push_back({ aName, aFunction });
+}
+
+void Test::ReportFailure(const char* aFile, const int aLine, const char* aExpression)
+{
+	std::printf("%s:%d: check failed: %s\n", aFile, aLine, aExpression);
+	failureCount++;
+}
+
+int main(int aArgumentCount, char* aArguments[])
+{
+	const char* testName = aArgumentCount > 1 ? aArguments[1] : nullptr;
+
+	// Worker threads so the tests of parallel code have something to run on, even on a single core.
+	Engine::Initialize(3);
+
+	unsigned testCount = 0;
+	for (const RegisteredTest& test : GetTests())
+	{
+		if (testName && std::strcmp(testName, test.name) != 0) continue;
+
+		const unsigned failuresBefore = failureCount;
+		test.function();
+		std::printf("%s %s\n", failureCount == failuresBefore ? "Passed" : "FAILED", test.name);
+		testCount++;
+	}
+
+	Engine::Shutdown();
+
+	if (testCount == 0)
+	{
+		std::printf("No test called %s\n", testName ? testName : "anything");
+		return 1;
+	}
+
+	return failureCount == 0 ? 0 : 1;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+// A test is a function that checks results with TEST_CHECK, which reports every check that fails and lets the test
+// carry on. HeadlessTests runs the test named on the command line, or all of them, and fails if any check did.
+#define TEST_CASE(Name) \
+	static void Name(); \
+	static const Test::TestRegistration Name##Registration(#Name, Name); \
+	static void Name()
+
+#define TEST_CHECK(Expression) \
+	do { if (!(Expression)) Test::ReportFailure(__FILE__, __LINE__, #Expression); } while (false)
+
+namespace Test
+{
+	using TestFunction = void(*)();
+
+	struct TestRegistration
+	{
+		TestRegistration(const char* aName, TestFunction aFunction);
+	};
+
+	void ReportFailure(const char* aFile, const int aLine, const char* aExpression);
+}
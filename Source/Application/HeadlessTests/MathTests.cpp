@@ -0,0 +1,114 @@
+#include "Enginepch.h"
+#include "HeadlessTests.h"
+#include "BenchmarkCommon.h"
+
+#include "Math/SpatialHashGrid.hpp"
+
+using namespace Benchmark;
+
+// Every shape is used as the query once, the batch has to find the same shapes as testing them one by one, in the same
+// order. It's also run on a range that doesn't start or end on a group of four.
+TEST_CASE(BatchIntersections)
+{
+	constexpr unsigned ShapeCount = 1000;
+	std::mt19937 random(1234);
+	IntersectionShapes shapes;
+	CreateIntersectionShapes(ShapeCount, random, shapes);
+
+	std::vector<uint32_t> batchIndices(ShapeCount);
+	std::vector<uint32_t> expectedIndices;
+
+	auto checkBatch = [&](uint32_t aBatchCount, auto&& aTest)
+		{
+			expectedIndices.clear();
+			for (uint32_t i = 0; i < ShapeCount; i++)
+			{
+				if (aTest(i)) expectedIndices.emplace_back(i);
+			}
+
+			TEST_CHECK(aBatchCount == expectedIndices.size());
+			TEST_CHECK(std::equal(expectedIndices.begin(), expectedIndices.end(), batchIndices.begin()));
+		};
+
+	for (unsigned query = 0; query < ShapeCount; query++)
+	{
+		const Math::AABB3D<float>& aabb = shapes.aabbs[query];
+		const Math::Sphere<float>& sphere = shapes.spheres[query];
+		const Math::Ray<float>& ray = shapes.rays[query];
+
+		checkBatch(Math::IntersectionBetweenAABBSBatch(aabb, shapes.aabbBatch, 0, ShapeCount, batchIndices.data()), [&](uint32_t i) { return Math::IntersectionBetweenAABBS(aabb, shapes.aabbs[i]); });
+		checkBatch(Math::IntersectionSphereAABBBatch(sphere, shapes.aabbBatch, 0, ShapeCount, batchIndices.data()), [&](uint32_t i) { return Math::IntersectionSphereAABB(sphere, shapes.aabbs[i]); });
+		checkBatch(Math::IntersectionBetweenSpheresBatch(sphere, shapes.sphereBatch, 0, ShapeCount, batchIndices.data()), [&](uint32_t i) { return Math::IntersectionBetweenSpheres(sphere, shapes.spheres[i]); });
+		checkBatch(Math::IntersectionAABBRayBatch(ray, shapes.aabbBatch, 0, ShapeCount, batchIndices.data()), [&](uint32_t i) { return Math::IntersectionAABBRay(shapes.aabbs[i], ray); });
+	}
+
+	constexpr uint32_t RangeBegin = 3;
+	constexpr uint32_t RangeEnd = ShapeCount - 2;
+	checkBatch(Math::IntersectionBetweenAABBSBatch(shapes.aabbs[0], shapes.aabbBatch, RangeBegin, RangeEnd, batchIndices.data()), [&](uint32_t i)
+		{
+			return i >= RangeBegin && i < RangeEnd && Math::IntersectionBetweenAABBS(shapes.aabbs[0], shapes.aabbs[i]);
+		});
+}
+
+// Items moving around in the grid have to be found by radius and box queries exactly when looping over all of them
+// would find them.
+TEST_CASE(SpatialHashGridQueries)
+{
+	constexpr unsigned ItemCount = 2000;
+	constexpr float Radius = 50.0f;
+	std::mt19937 random(1234);
+	std::uniform_real_distribution<float> coordinate(0, 1000.0f);
+	std::uniform_real_distribution<float> step(-30.0f, 30.0f);
+
+	Math::SpatialHashGrid<float> grid(Radius);
+	std::vector<Math::Vector3f> positions;
+	for (uint32_t i = 0; i < ItemCount; i++)
+	{
+		positions.emplace_back(coordinate(random), coordinate(random) * 0.1f, coordinate(random));
+		grid.Insert(i, positions[i]);
+	}
+
+	std::vector<uint32_t> found;
+	std::vector<uint32_t> expected;
+	for (unsigned frame = 0; frame < 5; frame++)
+	{
+		for (uint32_t i = 0; i < ItemCount; i++)
+		{
+			positions[i] += Math::Vector3f(step(random), 0, step(random));
+			grid.Move(i, positions[i]);
+		}
+
+		// Every tenth item leaves the grid for a frame.
+		for (uint32_t i = frame; i < ItemCount; i += 10) grid.Remove(i);
+
+		for (uint32_t query = 0; query < ItemCount; query += 7)
+		{
+			const Math::Vector3f& center = positions[query];
+			const Math::AABB3D<float> box(center - Math::Vector3f(Radius, 5.0f, Radius * 0.5f), center + Math::Vector3f(Radius, 5.0f, Radius * 0.5f));
+
+			found.clear();
+			expected.clear();
+			grid.QueryRadius(center, Radius, found);
+			for (uint32_t i = 0; i < ItemCount; i++)
+			{
+				if (grid.Contains(i) && (positions[i] - center).LengthSqr() <= Radius * Radius) expected.emplace_back(i);
+			}
+			std::sort(found.begin(), found.end());
+			TEST_CHECK(found == expected);
+
+			found.clear();
+			expected.clear();
+			grid.QueryBox(box, found);
+			for (uint32_t i = 0; i < ItemCount; i++)
+			{
+				if (grid.Contains(i) && box.IsInside(positions[i])) expected.emplace_back(i);
+			}
+			std::sort(found.begin(), found.end());
+			TEST_CHECK(found == expected);
+		}
+
+		for (uint32_t i = frame; i < ItemCount; i += 10) grid.Insert(i, positions[i]);
+	}
+
+	TEST_CHECK(grid.GetItemCount() == ItemCount);
+}
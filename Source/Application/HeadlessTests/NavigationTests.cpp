@@ -0,0 +1,203 @@
+#include "Enginepch.h"
+#include "HeadlessTests.h"
+#include "BenchmarkCommon.h"
+#include "ReferenceImplementations.h"
+
+#include "Engine.h"
+#include "ComponentSystem/GameObject.h"
+#include "ComponentSystem/Components/Transform.h"
+#include "Pathfinding/NavMeshPath.h"
+#include "Pathfinding/Components/NavMeshAgent.h"
+
+#include <cstring>
+
+using namespace Benchmark;
+
+// ClampToNavMesh and RayCast over the spatial index have to give exactly the points going through every polygon gives,
+// on the navmesh and off it.
+TEST_CASE(NavMeshQueries)
+{
+	constexpr unsigned GridSize = 24;
+	constexpr unsigned QueryCount = 1000;
+	const std::vector<NavPolygon> polygons = CreateGridPolygons(GridSize);
+	const NavMesh navMesh = CreateGridNavMesh(GridSize);
+
+	std::mt19937 random(1234);
+	std::uniform_real_distribution<float> coordinate(-0.05f * WorldSize, 1.05f * WorldSize);
+	std::uniform_real_distribution<float> height(-20.0f, 40.0f);
+	for (unsigned i = 0; i < QueryCount; i++)
+	{
+		const Math::Vector3f point(coordinate(random), height(random), coordinate(random));
+		TEST_CHECK(navMesh.ClampToNavMesh(point) == ClampToEveryPolygon(polygons, point));
+
+		const Math::Vector3f origin(coordinate(random), 500.0f, coordinate(random));
+		const Math::Vector3f target(coordinate(random), 0, coordinate(random));
+		const Math::Ray<float> ray(origin, (target - origin).GetNormalized());
+
+		Math::Vector3f expected;
+		Math::Vector3f hitPoint;
+		const bool expectedHit = RayCastEveryPolygon(polygons, navMesh.GetBoundingBox(), ray, expected);
+		const bool hit = navMesh.RayCast(ray, hitPoint, true);
+		TEST_CHECK(hit == expectedHit);
+		TEST_CHECK(!hit || hitPoint == expected);
+	}
+}
+
+// NavMesh::CreatePortals has to give exactly the portals comparing every polygon to every other one gives, in the same
+// order, on a hilly and shuffled navmesh.
+TEST_CASE(NavMeshPortals)
+{
+	std::vector<NavNode> nodes;
+	const std::vector<NavPolygon> polygons = CreateHillyPolygons(3000, nodes);
+
+	const std::vector<NavPortal> portals = NavMesh::CreatePortals(polygons, nodes);
+	const std::vector<NavPortal> expectedPortals = CreatePortalsComparingEveryPolygon(polygons, nodes);
+
+	TEST_CHECK(!portals.empty());
+	TEST_CHECK(portals.size() == expectedPortals.size());
+	for (size_t i = 0; i < portals.size() && i < expectedPortals.size(); i++)
+	{
+		TEST_CHECK(portals[i].nodes == expectedPortals[i].nodes);
+		TEST_CHECK(portals[i].vertices == expectedPortals[i].vertices);
+		TEST_CHECK(std::memcmp(&portals[i].cost, &expectedPortals[i].cost, sizeof(float)) == 0);
+	}
+}
+
+// Requested paths have to be the ones FindPath gives, with higher priority ones delivered no later than lower priority
+// ones, and cancelled ones never delivered. Half of the requests get a callback, the other half are polled for.
+TEST_CASE(PathRequests)
+{
+	constexpr unsigned RequestCount = 200;
+	constexpr unsigned NotDelivered = UINT_MAX;
+	NavMesh navMesh = CreateGridNavMesh(48, 16);
+
+	std::mt19937 random(1234);
+	std::uniform_real_distribution<float> coordinate(0.01f * WorldSize, 0.99f * WorldSize);
+	std::vector<Math::Vector3f> starts;
+	std::vector<Math::Vector3f> ends;
+	std::vector<NavMeshPath> expectedPaths;
+	for (unsigned i = 0; i < RequestCount; i++)
+	{
+		starts.emplace_back(coordinate(random), 0, coordinate(random));
+		ends.emplace_back(coordinate(random), 0, coordinate(random));
+		expectedPaths.emplace_back(navMesh.FindPath(starts[i], ends[i]));
+	}
+
+	std::vector<PathRequestID> requests(RequestCount, InvalidPathRequest);
+	std::vector<NavMeshPath> paths(RequestCount);
+	std::vector<unsigned> deliveryFrames(RequestCount, NotDelivered);
+	unsigned frame = 0;
+	for (unsigned i = 0; i < RequestCount; i++)
+	{
+		PathCallback callback;
+		if (i % 2 == 0)
+		{
+			callback = [&paths, &deliveryFrames, &frame, i](const PathRequestID, const NavMeshPath& aPath)
+				{
+					paths[i] = aPath;
+					deliveryFrames[i] = frame;
+				};
+		}
+
+		requests[i] = navMesh.RequestPath(starts[i], ends[i], callback, i % 5 == 0 ? 1 : 0);
+		TEST_CHECK(navMesh.GetPathRequestState(requests[i]) == PathRequestState::Pending);
+		if (i % 7 == 0) navMesh.CancelPathRequest(requests[i]);
+	}
+
+	for (frame = 0; navMesh.GetPendingPathRequestCount() > 0 && frame < 10000; frame++)
+	{
+		navMesh.UpdatePathRequests(200);
+		for (unsigned i = 1; i < RequestCount; i += 2)
+		{
+			if (deliveryFrames[i] == NotDelivered && navMesh.TakePath(requests[i], paths[i])) deliveryFrames[i] = frame;
+		}
+	}
+
+	TEST_CHECK(navMesh.GetPendingPathRequestCount() == 0);
+	TEST_CHECK(frame > 1);
+
+	unsigned lastHighPriorityFrame = 0;
+	unsigned firstLowPriorityFrame = NotDelivered;
+	for (unsigned i = 0; i < RequestCount; i++)
+	{
+		TEST_CHECK(navMesh.GetPathRequestState(requests[i]) == PathRequestState::None);
+		if (i % 7 == 0)
+		{
+			TEST_CHECK(deliveryFrames[i] == NotDelivered);
+			continue;
+		}
+
+		TEST_CHECK(deliveryFrames[i] != NotDelivered);
+		TEST_CHECK(paths[i].GetSize() == expectedPaths[i].GetSize());
+		for (int point = 0; point < paths[i].GetSize() && point < expectedPaths[i].GetSize(); point++)
+		{
+			TEST_CHECK(paths[i][point] == expectedPaths[i][point]);
+		}
+
+		if (i % 5 == 0) lastHighPriorityFrame = deliveryFrames[i] > lastHighPriorityFrame ? deliveryFrames[i] : lastHighPriorityFrame;
+		else firstLowPriorityFrame = deliveryFrames[i] < firstLowPriorityFrame ? deliveryFrames[i] : firstLowPriorityFrame;
+	}
+
+	TEST_CHECK(lastHighPriorityFrame <= firstLowPriorityFrame);
+}
+
+// Finishing a path counts against the search budget too: a straight path tests at least one polygon and clamps both of
+// its ends, so no more than a third of the budget's worth of them can finish in one update.
+TEST_CASE(PathRequestBudget)
+{
+	constexpr unsigned RequestCount = 100;
+	constexpr unsigned Budget = 30;
+	NavMesh navMesh = CreateGridNavMesh(48);
+
+	std::mt19937 random(1234);
+	std::uniform_real_distribution<float> coordinate(0.01f * WorldSize, 0.99f * WorldSize);
+	unsigned deliveredCount = 0;
+	for (unsigned i = 0; i < RequestCount; i++)
+	{
+		const Math::Vector3f start(coordinate(random), 0, coordinate(random));
+		navMesh.RequestPath(start, start + Math::Vector3f(1.0f, 0, 1.0f), [&deliveredCount](const PathRequestID, const NavMeshPath&) { deliveredCount++; });
+	}
+
+	for (unsigned update = 0; navMesh.GetPendingPathRequestCount() > 0 && update < RequestCount; update++)
+	{
+		const unsigned deliveredBefore = deliveredCount;
+		navMesh.UpdatePathRequests(Budget);
+		TEST_CHECK(deliveredCount > deliveredBefore);
+		TEST_CHECK(deliveredCount - deliveredBefore <= (Budget + 2) / 3);
+	}
+
+	TEST_CHECK(deliveredCount == RequestCount);
+}
+
+// The scene handler updates the path requests of the navmeshes agents use, which has to get an agent moving. A copy of
+// the agent must not take over its request, or destroying the copy would cancel it.
+TEST_CASE(AgentPathRequests)
+{
+	NavMesh navMesh = CreateGridNavMesh(48, 16);
+	Engine::Get().SetFixedTimestep(60.0f);
+	{
+		Scene scene;
+		std::shared_ptr<GameObject> go = MakePooled<GameObject>();
+		std::shared_ptr<Transform> transform = go->AddComponent<Transform>(Math::Vector3f(0.1f * WorldSize, 0, 0.1f * WorldSize));
+		std::shared_ptr<NavMeshAgent> agent = go->AddComponent<NavMeshAgent>(&navMesh, 100.0f);
+		scene.Instantiate(go);
+
+		agent->MoveToLocation(Math::Vector3f(0.9f * WorldSize, 0, 0.9f * WorldSize));
+		TEST_CHECK(navMesh.GetPendingPathRequestCount() == 1);
+
+		go->Clone();
+		TEST_CHECK(navMesh.GetPendingPathRequestCount() == 1);
+
+		const Math::Vector3f start = transform->GetTranslation();
+		for (unsigned step = 0; step < 10; step++)
+		{
+			scene.Update();
+			NavMeshAgent::UpdatePathRequests(scene);
+		}
+
+		TEST_CHECK(navMesh.GetPendingPathRequestCount() == 0);
+		TEST_CHECK((transform->GetTranslation() - start).LengthSqr() > 0);
+	}
+
+	Engine::Get().SetFixedTimestep(0);
+}
@@ -0,0 +1,190 @@
+#include "Enginepch.h"
+#include "HeadlessTests.h"
+
+#include "ComponentSystem/Scene.h"
+#include "ComponentSystem/GameObject.h"
+#include "ComponentSystem/PrefabRegistry.h"
+#include "ComponentSystem/Components/Transform.h"
+
+// Renaming a game object or changing its network ID has to index that object, even when another object in the scene
+// has been given the same ID.
+TEST_CASE(SceneIndices)
+{
+	Scene scene;
+	std::vector<std::shared_ptr<GameObject>> gameObjects;
+	for (unsigned i = 0; i < 3; i++)
+	{
+		gameObjects.emplace_back(MakePooled<GameObject>());
+		gameObjects.back()->SetName("Object");
+		scene.Instantiate(gameObjects.back());
+	}
+
+	gameObjects[1]->SetID(gameObjects[0]->GetID());
+	TEST_CHECK(scene.FindGameObjectByID(gameObjects[0]->GetID()) == gameObjects[1]);
+
+	gameObjects[0]->SetName("Renamed");
+	gameObjects[0]->SetNetworkID(7);
+	TEST_CHECK(scene.FindGameObjectByName("Renamed") == gameObjects[0]);
+	TEST_CHECK(scene.FindGameObjectByNetworkID(7) == gameObjects[0]);
+	TEST_CHECK(scene.FindGameObjectByName("Object") == gameObjects[1]);
+
+	scene.Destroy(gameObjects[0]);
+	scene.Update();
+	TEST_CHECK(!scene.FindGameObjectByName("Renamed"));
+	TEST_CHECK(!scene.FindGameObjectByNetworkID(7));
+	TEST_CHECK(scene.FindGameObjectByID(gameObjects[1]->GetID()) == gameObjects[1]);
+}
+
+// Destroying objects that share a name has to leave the others findable by it, in the order they were instantiated.
+TEST_CASE(SceneDestroy)
+{
+	Scene scene;
+	std::vector<std::shared_ptr<GameObject>> gameObjects;
+	std::vector<EntityHandle> handles;
+	for (unsigned i = 0; i < 10; i++)
+	{
+		gameObjects.emplace_back(MakePooled<GameObject>());
+		gameObjects.back()->SetName("Object");
+		handles.emplace_back(scene.Instantiate(gameObjects.back()));
+	}
+
+	for (unsigned i = 0; i < 10; i += 2)
+	{
+		scene.Destroy(gameObjects[i]);
+	}
+
+	scene.Destroy(gameObjects[0]);
+	scene.Update();
+
+	TEST_CHECK(scene.GetObjectAmount() == 5);
+	TEST_CHECK(scene.FindGameObjectByName("Object") == gameObjects[1]);
+	for (unsigned i = 0; i < 10; i++)
+	{
+		TEST_CHECK((scene.Resolve(handles[i]) == nullptr) == (i % 2 == 0));
+	}
+
+	for (unsigned i = 1; i < 10; i += 2)
+	{
+		scene.Destroy(gameObjects[i]);
+	}
+
+	scene.Update();
+	TEST_CHECK(scene.GetObjectAmount() == 0);
+	TEST_CHECK(!scene.FindGameObjectByName("Object"));
+}
+
+// Destroying through a handle has to destroy the object it refers to, whatever IDs the objects have been given.
+TEST_CASE(SceneDestroyByHandle)
+{
+	Scene scene;
+	std::vector<std::shared_ptr<GameObject>> gameObjects;
+	std::vector<EntityHandle> handles;
+	for (unsigned i = 0; i < 3; i++)
+	{
+		gameObjects.emplace_back(MakePooled<GameObject>());
+		handles.emplace_back(scene.Instantiate(gameObjects.back()));
+		gameObjects.back()->SetID(0);
+	}
+
+	scene.Destroy(handles[0]);
+	scene.Update();
+
+	TEST_CHECK(scene.GetObjectAmount() == 2);
+	TEST_CHECK(!scene.Resolve(handles[0]));
+	TEST_CHECK(scene.Resolve(handles[1]) == gameObjects[1].get());
+	TEST_CHECK(scene.Resolve(handles[2]) == gameObjects[2].get());
+
+	// Stale handles don't resolve, so destroying through one again does nothing.
+	scene.Destroy(handles[0]);
+	scene.Update();
+	TEST_CHECK(scene.GetObjectAmount() == 2);
+}
+
+// Instantiating an object that's already in a scene does nothing, so destroying it leaves nothing behind.
+TEST_CASE(SceneInstantiateTwice)
+{
+	Scene scene;
+	Scene otherScene;
+	std::shared_ptr<GameObject> gameObject = MakePooled<GameObject>();
+	gameObject->AddComponent<Transform>();
+
+	const EntityHandle handle = scene.Instantiate(gameObject);
+	TEST_CHECK(scene.Instantiate(gameObject) == handle);
+	TEST_CHECK(!otherScene.Instantiate(gameObject).IsValid());
+	TEST_CHECK(scene.GetObjectAmount() == 1);
+	TEST_CHECK(otherScene.GetObjectAmount() == 0);
+
+	unsigned transformCount = 0;
+	scene.Each<Transform>([&transformCount](Transform&) { transformCount++; });
+	TEST_CHECK(transformCount == 1);
+
+	scene.Destroy(gameObject);
+	scene.Update();
+	transformCount = 0;
+	scene.Each<Transform>([&transformCount](Transform&) { transformCount++; });
+	TEST_CHECK(transformCount == 0);
+	TEST_CHECK(scene.GetObjectAmount() == 0);
+}
+
+namespace
+{
+	// Spawns a prefab and registers more of them when it starts, like a spawner placed in a prefab would.
+	class SpawnOnStart : public Component
+	{
+	public:
+		void Start() override
+		{
+			if (!registry) return;
+
+			PrefabRegistry& spawnRegistry = *registry;
+			registry = nullptr;
+			spawnRegistry.Instantiate(*scene, innerPrefab, Math::Vector3f(0, 0, 100.0f));
+			for (unsigned i = 0; i < 64; i++)
+			{
+				spawnRegistry.Register("Registered" + std::to_string(i), MakePooled<GameObject>());
+			}
+		}
+
+		void Update() override {}
+
+		static inline PrefabRegistry* registry = nullptr;
+		static inline Scene* scene = nullptr;
+		static inline PrefabID innerPrefab = PrefabRegistry::InvalidID;
+	};
+}
+
+// A component starting while a prefab is spawned may spawn and register prefabs through the same registry.
+TEST_CASE(PrefabSpawnFromStart)
+{
+	Scene scene;
+	PrefabRegistry registry;
+
+	std::shared_ptr<GameObject> inner = MakePooled<GameObject>();
+	inner->AddComponent<Transform>();
+	const PrefabID innerPrefab = registry.Register("Inner", inner);
+
+	std::shared_ptr<GameObject> root = MakePooled<GameObject>();
+	std::shared_ptr<GameObject> spawner = MakePooled<GameObject>();
+	std::shared_ptr<GameObject> child = MakePooled<GameObject>();
+	root->AddComponent<Transform>()->AddChild(spawner->AddComponent<Transform>().get());
+	root->GetComponent<Transform>()->AddChild(child->AddComponent<Transform>().get());
+	spawner->AddComponent<SpawnOnStart>();
+	const PrefabID outerPrefab = registry.Register("Outer", root, { spawner, child });
+
+	SpawnOnStart::registry = &registry;
+	SpawnOnStart::scene = &scene;
+	SpawnOnStart::innerPrefab = innerPrefab;
+	const Math::Vector3f position(10.0f, 0, 20.0f);
+	const EntityHandle handle = registry.Instantiate(scene, outerPrefab, position);
+	SpawnOnStart::registry = nullptr;
+
+	TEST_CHECK(scene.GetObjectAmount() == 4);
+	TEST_CHECK(registry.GetPrefabAmount() == 66);
+	GameObject* spawnedRoot = scene.Resolve(handle);
+	TEST_CHECK(spawnedRoot != nullptr);
+	if (!spawnedRoot) return;
+
+	std::shared_ptr<Transform> transform = spawnedRoot->GetComponent<Transform>();
+	TEST_CHECK(transform->GetChildren().size() == 2);
+	TEST_CHECK(transform->GetTranslation() == position);
+}
@@ -0,0 +1,51 @@
+#include "Enginepch.h"
+#include "HeadlessTests.h"
+
+#include "Time/FixedTimestep.h"
+
+#include <random>
+
+// A fixed timestep hands out whole steps, catches up with several in one frame, drops what it can't catch up on, and
+// keeps the interpolation alpha in [0, 1). Disabled, it's always one step per frame with an alpha of 1. The step length
+// is a power of two so the accumulated time adds up exactly.
+TEST_CASE(FixedTimesteps)
+{
+	FixedTimestep timestep;
+	TEST_CHECK(!timestep.IsEnabled());
+	TEST_CHECK(timestep.Advance(0.5f) == 1);
+	TEST_CHECK(timestep.Advance(0) == 1);
+	TEST_CHECK(timestep.GetInterpolationAlpha() == 1.0f);
+	TEST_CHECK(timestep.GetTimeUntilNextStep() == 0);
+
+	timestep.SetStepsPerSecond(8.0f);
+	timestep.SetMaxStepsPerFrame(5);
+	TEST_CHECK(timestep.IsEnabled());
+	TEST_CHECK(timestep.GetStepTime() == 0.125f);
+
+	TEST_CHECK(timestep.Advance(0.0625f) == 0);
+	TEST_CHECK(timestep.GetInterpolationAlpha() == 0.5f);
+	TEST_CHECK(timestep.GetTimeUntilNextStep() == 0.0625f);
+
+	TEST_CHECK(timestep.Advance(0.3125f) == 3);
+	TEST_CHECK(timestep.GetInterpolationAlpha() == 0);
+
+	// 16.5 steps' worth: 5 are simulated, the rest is dropped but for the half step.
+	TEST_CHECK(timestep.Advance(2.0625f) == 5);
+	TEST_CHECK(timestep.GetInterpolationAlpha() == 0.5f);
+	TEST_CHECK(timestep.Advance(0) == 0);
+	TEST_CHECK(timestep.Advance(0.0625f) == 1);
+
+	std::mt19937 random(1234);
+	std::uniform_real_distribution<float> frameTime(0, 1.0f);
+	for (unsigned frame = 0; frame < 1000; frame++)
+	{
+		TEST_CHECK(timestep.Advance(frameTime(random)) <= timestep.GetMaxStepsPerFrame());
+		const float alpha = timestep.GetInterpolationAlpha();
+		TEST_CHECK(alpha >= 0 && alpha < 1.0f);
+	}
+
+	timestep.SetStepsPerSecond(0);
+	TEST_CHECK(!timestep.IsEnabled());
+	TEST_CHECK(timestep.Advance(0.25f) == 1);
+	TEST_CHECK(timestep.GetInterpolationAlpha() == 1.0f);
+}
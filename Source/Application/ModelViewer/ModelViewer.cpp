@@ -22,7 +22,7 @@ void ModelViewer::InitializeApplication()
 	GraphicsEngine::Get().RecalculateShadowFrustum = false;
 	GraphicsEngine::Get().DrawGizmos = true;
 	Engine::Get().GetSceneHandler().LoadScene("Scenes/SC_ModelViewerScene.json");
-	std::shared_ptr<GameObject> newGO = std::make_shared<GameObject>();
+	std::shared_ptr<GameObject> newGO = MakePooled<GameObject>();
 	newGO->SetName("Model");
 	newGO->AddComponent<Transform>(Math::Vector3f(0, 0, 0), Math::Vector3f(0, -180.0f, 0));
 	Engine::Get().GetSceneHandler().Instantiate(newGO);
@@ -57,7 +57,7 @@ void ControllerMove::Start()
 
 void ControllerMove::Update()
 {
-	float dt = Engine::Get().GetTimer().GetDeltaTime();
+	float dt = Engine::Get().GetTimer().GetFixedDeltaTime();
 	auto& transform = gameObject->GetComponent<Transform>();
 
 	ControllerBase::SteeringInput steeringInput;
@@ -97,7 +97,7 @@ void ControllerMove::Update()
 
 			float rotTimeDelta = myCurrentRotationTime / myMaxRotationTime;
 			Math::Quatf rot = Math::Quatf::Slerp(myCurrentRot, myGoalRot, rotTimeDelta);
-			gameObject->GetComponent<Transform>()->SetRotation(rot.GetEulerAnglesDegrees());
+			gameObject->GetComponent<Transform>()->SetRotationQuaternion(rot);
 		}
 	}
 	else
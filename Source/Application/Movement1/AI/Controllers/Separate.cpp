@@ -13,8 +13,9 @@ ControllerBase::SteeringOutput Separate::GetSteering(const SteeringInput& aSteer
 {
     SteeringOutput output;
 
-    auto otherActors = PollingStation::Get().GetOtherActorPositions();
-    for (auto& actorPos : otherActors)
+    myNeighbourPositions.clear();
+    PollingStation::Get().GetActorPositionsInRadius(aSteeringInput.position, myThreshold, myNeighbourPositions);
+    for (auto& actorPos : myNeighbourPositions)
     {
         if (Math::Vector3f::Equal(aSteeringInput.position, actorPos, 1.0f)) continue;
         Math::Vector3f diff = aSteeringInput.position - actorPos;
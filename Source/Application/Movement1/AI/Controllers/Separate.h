@@ -8,4 +8,6 @@ public:
 
 private:
 	float myThreshold = 200.0f;
+	// Reused every frame so finding neighbours doesn't allocate.
+	std::vector<Math::Vector3f> myNeighbourPositions;
 };
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
 #include "Math/Vector.hpp"
+#include "Math/SpatialHashGrid.hpp"
+#include "GameEngine/ComponentSystem/EntityHandle.h"
 
 
 class PollingStation
@@ -18,14 +20,19 @@ private:
 	static PollingStation* myInstance;
 
 public:
+	// Moves the watched actors to where they are now in the neighbour grid.
 	void Update();
-	void AddWatchedActor(std::shared_ptr<GameObject> aGameObject);
-	void SetWanderer(std::shared_ptr<GameObject> aGameObject);
+	void AddWatchedActor(const EntityHandle aHandle);
+	void SetWanderer(const EntityHandle aHandle);
 
-	const std::vector<std::shared_ptr<GameObject>>& GetOtherActors() { return myWatchedActors; }
-	const std::vector<Math::Vector3f> GetOtherActorPositions() const;
+	const std::vector<EntityHandle>& GetOtherActors() { return myWatchedActors; }
+	// Append the watched actors within aRadius of aPosition, or their positions, as of the last Update.
+	unsigned GetActorsInRadius(const Math::Vector3f& aPosition, const float aRadius, std::vector<EntityHandle>& outActors) const;
+	unsigned GetActorPositionsInRadius(const Math::Vector3f& aPosition, const float aRadius, std::vector<Math::Vector3f>& outPositions) const;
 	const Math::Vector3f GetWandererPosition() const;
 private:
-	std::vector<std::shared_ptr<GameObject>> myWatchedActors;
-	std::shared_ptr<GameObject> myWanderer;
+	std::vector<EntityHandle> myWatchedActors;
+	// The watched actors by their index in myWatchedActors, so steering only looks at the ones nearby.
+	Math::SpatialHashGrid<float> myActorGrid;
+	EntityHandle myWanderer;
 };
\ No newline at end of file
@@ -22,41 +22,41 @@ void Movement1::InitializeApplication()
 	Engine::Get().GetSceneHandler().LoadScene("Scenes/SC_Movement.json");
 
 	{
-		std::shared_ptr<GameObject> go = std::make_shared<GameObject>();
+		std::shared_ptr<GameObject> go = MakePooled<GameObject>();
 		go->AddComponent<Transform>();
 		auto model = go->AddComponent<AnimatedModel>(AssetManager::Get().GetAsset<MeshAsset>("Assets/SK_C_TGA_Bro.fbx")->mesh, AssetManager::Get().GetAsset<MaterialAsset>("Materials/MAT_TgaBroBlue.json")->material);
 		model->AddAnimationToLayer("Idle", AssetManager::Get().GetAsset<AnimationAsset>("Animations/TgaBro/Idle/A_C_TGA_Bro_Idle_Breathing.fbx")->animation, "", true);
 		go->AddComponent<WrapAroundWorld>();
 		go->AddComponent<ControllerMove>(150.0f, 15.0f, ControllerMove::ControllerType::Wander);
-		PollingStation::Get().SetWanderer(go);
-		PollingStation::Get().AddWatchedActor(go);
-		Engine::Get().GetSceneHandler().Instantiate(go);
+		EntityHandle handle = Engine::Get().GetSceneHandler().Instantiate(go);
+		PollingStation::Get().SetWanderer(handle);
+		PollingStation::Get().AddWatchedActor(handle);
 	}
 
 	for (int i = 0; i < 4; i++)
 	{
-		std::shared_ptr<GameObject> go = std::make_shared<GameObject>();
+		std::shared_ptr<GameObject> go = MakePooled<GameObject>();
 		go->AddComponent<Transform>(Math::Vector3f(static_cast<float>(std::rand() % 1000 - std::rand() % 1000), 0, static_cast<float>(std::rand() % 1000 - std::rand() % 1000)));
 		auto model = go->AddComponent<AnimatedModel>(AssetManager::Get().GetAsset<MeshAsset>("Assets/SK_C_TGA_Bro.fbx")->mesh, AssetManager::Get().GetAsset<MaterialAsset>("Materials/MAT_TgaBroRed.json")->material);
 		model->AddAnimationToLayer("Idle", AssetManager::Get().GetAsset<AnimationAsset>("Animations/TgaBro/Idle/A_C_TGA_Bro_Idle_Breathing.fbx")->animation, "", true);
 		go->AddComponent<WrapAroundWorld>();
 		go->AddComponent<ControllerMove>(80.0f, 5.0f, ControllerMove::ControllerType::Seek);
 
-		PollingStation::Get().AddWatchedActor(go);
-		Engine::Get().GetSceneHandler().Instantiate(go);
+		EntityHandle handle = Engine::Get().GetSceneHandler().Instantiate(go);
+		PollingStation::Get().AddWatchedActor(handle);
 	}
 
 	for (int i = 0; i < 10; i++)
 	{
-		std::shared_ptr<GameObject> go = std::make_shared<GameObject>();
+		std::shared_ptr<GameObject> go = MakePooled<GameObject>();
 		go->AddComponent<Transform>(Math::Vector3f(static_cast<float>(std::rand() % 1000 - std::rand() % 1000), 0, static_cast<float>(std::rand() % 1000 - std::rand() % 1000)));
 		auto model = go->AddComponent<AnimatedModel>(AssetManager::Get().GetAsset<MeshAsset>("Assets/SK_C_TGA_Bro.fbx")->mesh, AssetManager::Get().GetAsset<MaterialAsset>("Materials/MAT_TgaBroGreen.json")->material);
 		model->AddAnimationToLayer("Idle", AssetManager::Get().GetAsset<AnimationAsset>("Animations/TgaBro/Idle/A_C_TGA_Bro_Idle_Breathing.fbx")->animation, "", true);
 		go->AddComponent<WrapAroundWorld>();
 		go->AddComponent<ControllerMove>(80.0f, 5.0f, ControllerMove::ControllerType::Separate);
 
-		PollingStation::Get().AddWatchedActor(go);
-		Engine::Get().GetSceneHandler().Instantiate(go);
+		EntityHandle handle = Engine::Get().GetSceneHandler().Instantiate(go);
+		PollingStation::Get().AddWatchedActor(handle);
 	}
 }
 
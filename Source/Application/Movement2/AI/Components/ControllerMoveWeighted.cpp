@@ -79,7 +79,7 @@ void ControllerMoveWeighted::Start()
 
 void ControllerMoveWeighted::Update()
 {
-	float dt = Engine::Get().GetTimer().GetDeltaTime();
+	float dt = Engine::Get().GetTimer().GetFixedDeltaTime();
 	auto& transform = gameObject->GetComponent<Transform>();
 
 	ControllerBase::SteeringInput steeringInput;
@@ -135,7 +135,7 @@ void ControllerMoveWeighted::Update()
 
 			float rotTimeDelta = myCurrentRotationTime / myMaxRotationTime;
 			Math::Quatf rot = Math::Quatf::Slerp(myCurrentRot, myGoalRot, rotTimeDelta);
-			gameObject->GetComponent<Transform>()->SetRotation(rot.GetEulerAnglesDegrees());
+			gameObject->GetComponent<Transform>()->SetRotationQuaternion(rot);
 		}
 	}
 	else
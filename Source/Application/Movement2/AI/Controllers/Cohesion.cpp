@@ -11,10 +11,11 @@ ControllerBase::SteeringOutput Cohesion::GetSteering(const SteeringInput& aSteer
 {
     SteeringOutput output;
 
-    auto otherActors = PollingStation::Get().GetOtherActorPositions();
+    myNeighbourPositions.clear();
+    PollingStation::Get().GetActorPositionsInRadius(aSteeringInput.position, myNeighbourhoodRadius, myNeighbourPositions);
     Math::Vector3f averagePos;
     float nearbyCount = 0;
-    for (auto& actorPos : otherActors)
+    for (auto& actorPos : myNeighbourPositions)
     {
         Math::Vector3f diff = actorPos - aSteeringInput.position;
         if (diff.LengthSqr() > myNeighbourhoodRadius * myNeighbourhoodRadius) continue;
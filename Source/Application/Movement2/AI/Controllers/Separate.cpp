@@ -13,8 +13,9 @@ ControllerBase::SteeringOutput Separate::GetSteering(const SteeringInput& aSteer
 {
     SteeringOutput output;
 
-    auto otherActors = PollingStation::Get().GetOtherActorPositions();
-    for (auto& actorPos : otherActors)
+    myNeighbourPositions.clear();
+    PollingStation::Get().GetActorPositionsInRadius(aSteeringInput.position, myAvoidRadius, myNeighbourPositions);
+    for (auto& actorPos : myNeighbourPositions)
     {
         Math::Vector3f diff = aSteeringInput.position - actorPos;
         if (diff.LengthSqr() > myAvoidRadius * myAvoidRadius) continue;
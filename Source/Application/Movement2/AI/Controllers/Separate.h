@@ -9,4 +9,6 @@ public:
 private:
 	float myAvoidRadius = 100.0f;
 	float myAvoidFactor = 10.0f;
+	// Reused every frame so finding neighbours doesn't allocate.
+	std::vector<Math::Vector3f> myNeighbourPositions;
 };
\ No newline at end of file
@@ -13,11 +13,16 @@ ControllerBase::SteeringOutput VelocityMatch::GetSteering(const SteeringInput& a
     SteeringOutput output;
     aSteeringInput;
 
-    auto otherActors = PollingStation::Get().GetOtherActorPositions();
+    myNeighbours.clear();
+    PollingStation::Get().GetActorsInRadius(aSteeringInput.position, myNeighbourhoodRadius, myNeighbours);
     Math::Vector3f averageVelocity;
     float nearbyCount = 0;
-    for (auto& actor : PollingStation::Get().GetOtherActors())
+    SceneHandler& sceneHandler = Engine::Get().GetSceneHandler();
+    for (const EntityHandle& handle : myNeighbours)
     {
+        GameObject* actor = sceneHandler.Resolve(handle);
+        if (!actor) continue;
+
         Math::Vector3f diff = aSteeringInput.position - actor->GetComponent<Transform>()->GetTranslation();
         if (diff.LengthSqr() > myNeighbourhoodRadius * myNeighbourhoodRadius) continue;
         if (auto& cont = actor->GetComponent<ControllerMoveWeighted>())
@@ -1,5 +1,6 @@
 #pragma once
 #include "ControllerBase.h"
+#include "GameEngine/ComponentSystem/EntityHandle.h"
 
 class VelocityMatch : public ControllerBase
 {
@@ -8,4 +9,6 @@ public:
 
 private:
 	float myNeighbourhoodRadius = 250.0f;
+	// Reused every frame so finding neighbours doesn't allocate.
+	std::vector<EntityHandle> myNeighbours;
 };
\ No newline at end of file
@@ -6,7 +6,7 @@
 #include "GameEngine/ComponentSystem/GameObject.h"
 #include "GameEngine/ComponentSystem/Components/Transform.h"
 
-PollingStation::PollingStation()
+PollingStation::PollingStation() : myActorGrid(200.0f)
 {
 }
 
@@ -16,40 +16,70 @@ PollingStation::~PollingStation()
 
 void PollingStation::Update()
 {
+	SceneHandler& sceneHandler = Engine::Get().GetSceneHandler();
+	for (uint32_t i = 0; i < myWatchedActors.size(); i++)
+	{
+		GameObject* actor = sceneHandler.Resolve(myWatchedActors[i]);
+		std::shared_ptr<Transform> transform = actor ? actor->GetComponent<Transform>() : nullptr;
+		if (transform)
+		{
+			myActorGrid.Move(i, transform->GetTranslation());
+		}
+		else
+		{
+			myActorGrid.Remove(i);
+		}
+	}
 }
 
-void PollingStation::AddWatchedActor(std::shared_ptr<GameObject> aGameObject)
+void PollingStation::AddWatchedActor(const EntityHandle aHandle)
 {
-	if (std::find(myWatchedActors.begin(), myWatchedActors.end(), aGameObject) != myWatchedActors.end()) return;
+	if (std::find(myWatchedActors.begin(), myWatchedActors.end(), aHandle) != myWatchedActors.end()) return;
+
+	myWatchedActors.emplace_back(aHandle);
 
-	myWatchedActors.emplace_back(aGameObject);
+	GameObject* actor = Engine::Get().GetSceneHandler().Resolve(aHandle);
+	if (std::shared_ptr<Transform> transform = actor ? actor->GetComponent<Transform>() : nullptr)
+	{
+		myActorGrid.Insert(static_cast<uint32_t>(myWatchedActors.size() - 1), transform->GetTranslation());
+	}
 }
 
-void PollingStation::SetWanderer(std::shared_ptr<GameObject> aGameObject)
+void PollingStation::SetWanderer(const EntityHandle aHandle)
 {
-	myWanderer = aGameObject;
+	myWanderer = aHandle;
 }
 
-const std::vector<Math::Vector3f> PollingStation::GetOtherActorPositions() const
+unsigned PollingStation::GetActorsInRadius(const Math::Vector3f& aPosition, const float aRadius, std::vector<EntityHandle>& outActors) const
 {
-	std::vector<Math::Vector3f> actorPositions;
+	const size_t countBefore = outActors.size();
+	myActorGrid.ForEachInRadius(aPosition, aRadius, [this, &outActors](uint32_t aActor, const Math::Vector3f&)
+		{
+			outActors.emplace_back(myWatchedActors[aActor]);
+		});
 
-	for (auto& actor : myWatchedActors)
-	{
-		if (auto transform = actor->GetComponent<Transform>())
+	return static_cast<unsigned>(outActors.size() - countBefore);
+}
+
+unsigned PollingStation::GetActorPositionsInRadius(const Math::Vector3f& aPosition, const float aRadius, std::vector<Math::Vector3f>& outPositions) const
+{
+	const size_t countBefore = outPositions.size();
+	myActorGrid.ForEachInRadius(aPosition, aRadius, [&outPositions](uint32_t, const Math::Vector3f& aActorPosition)
 		{
-			actorPositions.emplace_back(transform->GetTranslation());
-		}
-	}
+			outPositions.emplace_back(aActorPosition);
+		});
 
-	return actorPositions;
+	return static_cast<unsigned>(outPositions.size() - countBefore);
 }
 
 const Math::Vector3f PollingStation::GetWandererPosition() const
 {
-	if (auto transform = myWanderer->GetComponent<Transform>())
+	if (GameObject* wanderer = Engine::Get().GetSceneHandler().Resolve(myWanderer))
 	{
-		return transform->GetTranslation();
+		if (auto transform = wanderer->GetComponent<Transform>())
+		{
+			return transform->GetTranslation();
+		}
 	}
 
 	return Math::Vector3f();
@@ -23,7 +23,7 @@ void Movement2::InitializeApplication()
 
 	for (int i = 0; i < 20; i++)
 	{
-		std::shared_ptr<GameObject> go = std::make_shared<GameObject>();
+		std::shared_ptr<GameObject> go = MakePooled<GameObject>();
 		go->AddComponent<Transform>(Math::Vector3f(static_cast<float>(std::rand() % 800 - std::rand() % 800), 0, static_cast<float>(std::rand() % 500 - std::rand() % 500)));
 		auto model = go->AddComponent<AnimatedModel>(AssetManager::Get().GetAsset<MeshAsset>("Assets/SK_C_TGA_Bro.fbx")->mesh, AssetManager::Get().GetAsset<MaterialAsset>("Materials/MAT_TgaBroBlue.json")->material);
 		model->AddAnimationToLayer("Idle", AssetManager::Get().GetAsset<AnimationAsset>("Animations/TgaBro/Idle/A_C_TGA_Bro_Idle_Breathing.fbx")->animation, "", true);
@@ -33,8 +33,8 @@ void Movement2::InitializeApplication()
 		cont->AddControllerType(ControllerMoveWeighted::ControllerType::VelocityMatch, 3.0f);
 		cont->AddControllerType(ControllerMoveWeighted::ControllerType::CollisionAvoidance, 5.0f);
 
-		PollingStation::Get().AddWatchedActor(go);
-		Engine::Get().GetSceneHandler().Instantiate(go);
+		EntityHandle handle = Engine::Get().GetSceneHandler().Instantiate(go);
+		PollingStation::Get().AddWatchedActor(handle);
 	}
 }
 
@@ -28,7 +28,7 @@ void Controller::Start()
 
 void Controller::Update()
 {
-	float deltaTime = Engine::Get().GetTimer().GetDeltaTime();
+	float deltaTime = Engine::Get().GetTimer().GetFixedDeltaTime();
 	InputHandler& inputHandler = Engine::Get().GetInputHandler();
 
 	Math::Vector3f inputDelta;
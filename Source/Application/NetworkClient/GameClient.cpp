@@ -192,7 +192,7 @@ void GameClient::HandleMessage_Text(NetMessage_Text& aMessage)
 
 void GameClient::HandleMessage_CreateCharacter(NetMessage_CreateCharacter& aMessage)
 {
-    std::shared_ptr<GameObject> go = std::make_shared<GameObject>();
+    std::shared_ptr<GameObject> go = MakePooled<GameObject>();
     go->SetNetworkID(aMessage.GetNetworkID());
     go->AddComponent<Transform>(aMessage.GetPosition());
     go->AddComponent<BoxCollider>(Math::Vector3f(50.0f, 100.0f, 50.0f), Math::Vector3f(0.0f, 90.0f, 0.0f));
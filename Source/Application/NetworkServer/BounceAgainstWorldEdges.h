@@ -6,6 +6,7 @@ class BounceAgainstWorldEdges : public Component
 public:
 	void Start() override {}
 	void Update() override;
+	ComponentUpdateThreading GetUpdateThreading() const override { return ComponentUpdateThreading::ThreadSafe; }
 
 private:
 	Math::Vector3f myExtents = { 800.0f, 0.0f, 800.0f };
@@ -124,8 +124,12 @@ void GameServer::HandleMessage_RequestConnect(NetMessage_RequestConnect& aMessag
     }
 
     // Create already existing objects for newly joined user.
-    for (auto& object : myObjects)
+    SceneHandler& sceneHandler = Engine::Get().GetSceneHandler();
+    for (const EntityHandle& handle : myObjects)
     {
+        GameObject* object = sceneHandler.Resolve(handle);
+        if (!object) continue;
+
         NetMessage_CreateCharacter createCharacterMsg;
         createCharacterMsg.SetNetworkID(object->GetNetworkID());
         NetBuffer buffer;
@@ -175,41 +179,41 @@ void GameServer::CreateNewObject()
     createCharacterMsg.Serialize(buffer);
     SendToAllClients(buffer);
 
-    std::shared_ptr<GameObject> go = std::make_shared<GameObject>();
+    std::shared_ptr<GameObject> go = MakePooled<GameObject>();
     go->SetNetworkID(createCharacterMsg.GetNetworkID());
     go->AddComponent<Transform>(createCharacterMsg.GetPosition());
     go->AddComponent<RandomDirectionMovement>();
     go->AddComponent<BounceAgainstWorldEdges>();
     auto coll = go->AddComponent<BoxCollider>(Math::Vector3f(50.0f, 100.0f, 50.0f), Math::Vector3f(0.0f, 90.0f, 0.0f));
+
+    auto model = go->AddComponent<AnimatedModel>(AssetManager::Get().GetAsset<MeshAsset>("Assets/SK_C_TGA_Bro.fbx")->mesh, AssetManager::Get().GetAsset<MaterialAsset>("Materials/MAT_ColorBlue.json")->material);
+    model->AddAnimationToLayer("Idle", AssetManager::Get().GetAsset<AnimationAsset>("Animations/TgaBro/Idle/A_C_TGA_Bro_Idle_Breathing.fbx")->animation, "", true);
+
+    EntityHandle handle = Engine::Get().GetSceneHandler().Instantiate(go);
+    myObjects.push_back(handle);
+
     unsigned id = go->GetNetworkID();
-    coll->SetCollisionResponse([this, id] {
-        if (auto gameObject = Engine::Get().GetSceneHandler().FindGameObjectByNetworkID(id))
+    coll->SetCollisionResponse([this, handle, id] {
+        if (Engine::Get().GetSceneHandler().Resolve(handle))
         {
-            Engine::Get().GetSceneHandler().Destroy(gameObject);
+            Engine::Get().GetSceneHandler().Destroy(handle);
             DestroyObject(id);
             myCurrentlyActiveObjects--;
         }
         });
 
-
-    auto model = go->AddComponent<AnimatedModel>(AssetManager::Get().GetAsset<MeshAsset>("Assets/SK_C_TGA_Bro.fbx")->mesh, AssetManager::Get().GetAsset<MaterialAsset>("Materials/MAT_ColorBlue.json")->material);
-    model->AddAnimationToLayer("Idle", AssetManager::Get().GetAsset<AnimationAsset>("Animations/TgaBro/Idle/A_C_TGA_Bro_Idle_Breathing.fbx")->animation, "", true);
-
-    myObjects.push_back(go);
-
-    Engine::Get().GetSceneHandler().Instantiate(go);
-
     myCurrentTimeSinceLastSpawn = 0.0f;
     myCurrentNetworkID++;
 }
 
 void GameServer::DestroyObject(unsigned aNetworkID)
 {
-    auto it = std::find_if(myObjects.begin(), myObjects.end(), [aNetworkID](const std::shared_ptr<GameObject>& object) { return object->GetNetworkID() == aNetworkID; });
-    if (it != myObjects.end() && *it != nullptr)
-    {
-        myObjects.erase(it);
-    }
+    SceneHandler& sceneHandler = Engine::Get().GetSceneHandler();
+    std::erase_if(myObjects, [&sceneHandler, aNetworkID](const EntityHandle& handle)
+        {
+            GameObject* object = sceneHandler.Resolve(handle);
+            return !object || object->GetNetworkID() == aNetworkID;
+        });
 
     NetMessage_RemoveCharacter removeCharacterMsg;
     removeCharacterMsg.SetNetworkID(aNetworkID);
@@ -220,8 +224,12 @@ void GameServer::DestroyObject(unsigned aNetworkID)
 
 void GameServer::UpdatePositions()
 {
-    for (auto& object : myObjects)
+    SceneHandler& sceneHandler = Engine::Get().GetSceneHandler();
+    for (const EntityHandle& handle : myObjects)
     {
+        GameObject* object = sceneHandler.Resolve(handle);
+        if (!object) continue;
+
         NetMessage_Position newMsg;
         newMsg.SetNetworkID(object->GetNetworkID());
         newMsg.SetPosition(object->GetComponent<Transform>()->GetTranslation());
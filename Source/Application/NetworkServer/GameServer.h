@@ -1,5 +1,6 @@
 #pragma once
 #include "ServerBase.h"
+#include <GameEngine/ComponentSystem/EntityHandle.h>
 
 class NetMessage_RequestConnect;
 class NetMessage_Disconnect;
@@ -28,7 +29,7 @@ protected:
 
 private:
     unsigned myCurrentNetworkID = 1;
-    std::vector<std::shared_ptr<GameObject>> myObjects;
+    std::vector<EntityHandle> myObjects;
 
     float myTickRate = 10.0f;
 
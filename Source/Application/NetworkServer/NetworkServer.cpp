@@ -14,6 +14,8 @@ void NetworkServer::InitializeApplication()
 {
 	GraphicsEngine::Get().RecalculateShadowFrustum = false;
 	GraphicsEngine::Get().DrawColliders = true;
+	// The server only needs to simulate as often as clients get updates, not every rendered frame.
+	Engine::Get().SetFixedTimestep(30.0f);
 	Engine::Get().GetSceneHandler().LoadScene("Scenes/SC_NetworkingScene.json");
 	myServer.StartServer();
 
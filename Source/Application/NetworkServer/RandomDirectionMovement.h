@@ -8,6 +8,7 @@ class RandomDirectionMovement : public Component
 public:
 	void Start() override;
 	void Update() override;
+	ComponentUpdateThreading GetUpdateThreading() const override { return ComponentUpdateThreading::ThreadSafe; }
 
 	void SetDirection(Math::Vector3f aNewDirection);
 	const Math::Vector3f& GetDirection() const;
@@ -12,6 +12,7 @@
 #include "Math/Matrix.hpp"
 #include "Math/Vector.hpp"
 #include "CommonUtilities/StringUtilities.hpp"
+#include "Platform/Platform.h"
 
 
 #include "DefaultTextures/Default_C.h"
@@ -791,7 +792,6 @@ bool AssetManager::RegisterFontAsset(const std::filesystem::path& aPath)
 
 std::vector<NavPolygon> CreateNavPolygons(const TGA::FBX::NavMesh& tgaNavMesh);
 std::vector<NavNode> CreateNavNodes(const std::vector<NavPolygon>& navPolygons);
-std::vector<NavPortal> CreateNavPortals(const std::vector<NavPolygon>& navPolygons, const std::vector<NavNode>& aNavNodes);
 
 bool AssetManager::RegisterNavMeshAsset(const std::filesystem::path& aPath)
 {
@@ -816,7 +816,7 @@ bool AssetManager::RegisterNavMeshAsset(const std::filesystem::path& aPath)
     std::vector<NavNode> navNodes = CreateNavNodes(navPolygons);
 
     // Create Nav Portals.
-    std::vector<NavPortal> navPortals = CreateNavPortals(navPolygons, navNodes);
+    std::vector<NavPortal> navPortals = NavMesh::CreatePortals(navPolygons, navNodes);
 
     for (int portalIndex = 0; portalIndex < static_cast<int>(navPortals.size()); ++portalIndex)
     {
@@ -1331,7 +1331,7 @@ bool AssetManager::RegisterRampPrimitive()
 void AssetManager::LogAssetLoadError(const std::filesystem::path& aPath)
 {
     LOG(LogAssetManager, Error, "Asset manager can not find asset at path: {}", aPath.string());
-    MessageBox(NULL, L"Asset manager can not find asset, Please check the log for more information!", L"Asset Manager Error", MB_ICONERROR);
+    Platform::ShowErrorMessage("Asset Manager Error", "Asset manager can not find asset, Please check the log for more information!");
 }
 
 std::vector<NavPolygon> CreateNavPolygons(const TGA::FBX::NavMesh& tgaNavMesh)
@@ -1380,46 +1380,4 @@ std::vector<NavNode> CreateNavNodes(const std::vector<NavPolygon>& navPolygons)
     }
 
     return navNodes;
-}
-
-std::vector<NavPortal> CreateNavPortals(const std::vector<NavPolygon>& navPolygons, const std::vector<NavNode>& aNavNodes)
-{
-    std::vector<NavPortal> navPortals;
-
-    for (int i = 0; i < static_cast<int>(navPolygons.size()); ++i)
-    {
-        const NavPolygon& navPoly1 = navPolygons[i];
-
-        for (int j = 0; j < static_cast<int>(navPolygons.size()); ++j)
-        {
-            if (i == j) continue;
-
-            const NavPolygon& navPoly2 = navPolygons[j];
-
-            std::array<Math::Vector3f, 2> sharedVertices;
-            int sharedCount = 0;
-
-            for (int vertexPos = 0; vertexPos < static_cast<int>(navPoly2.vertexPositions.size()); vertexPos++)
-            {
-                const Math::Vector3f& vertexPosToTest = navPoly2.vertexPositions[vertexPos];
-                if (std::find(navPoly1.vertexPositions.begin(), navPoly1.vertexPositions.end(), vertexPosToTest) != navPoly1.vertexPositions.end())
-                {
-                    assert(sharedCount < 2 && "More than 2 shared vertices means mesh is not triangulated, or polygon is really damn small");
-                    sharedVertices[sharedCount++] = vertexPosToTest;
-                }
-            }
-
-            if (sharedCount == 2) // Polygons share an edge
-            {
-                NavPortal& navPortal = navPortals.emplace_back();
-                navPortal.nodes[0] = i;
-                navPortal.nodes[1] = j;
-                navPortal.vertices[0] = sharedVertices[0];
-                navPortal.vertices[1] = sharedVertices[1];
-                navPortal.cost = (aNavNodes[i].position - aNavNodes[j].position).Length();
-            }
-        }
-    }
-
-    return navPortals;
 }
\ No newline at end of file
@@ -70,6 +70,26 @@ void AppSettings::LoadSettings(const std::filesystem::path& aSettingsFilepath)
         instance.autoRegisterAssets = data["autoregisterassets"].get<bool>();
     }
 
+    if (data.contains("parallelsceneupdate"))
+    {
+        instance.parallelSceneUpdate = data["parallelsceneupdate"].get<bool>();
+    }
+
+    if (data.contains("workerthreads"))
+    {
+        instance.workerThreadCount = data["workerthreads"].get<unsigned>();
+    }
+
+    if (data.contains("simulationrate"))
+    {
+        instance.simulationRate = data["simulationrate"].get<float>();
+    }
+
+    if (data.contains("maxsimulationsteps"))
+    {
+        instance.maxSimulationStepsPerFrame = data["maxsimulationsteps"].get<unsigned>();
+    }
+
     LPWSTR* szArgList;
     int argCount;
     szArgList = CommandLineToArgvW(GetCommandLine(), &argCount);
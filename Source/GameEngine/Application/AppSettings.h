@@ -15,6 +15,13 @@ public:
     bool isBorderless = true;
     bool allowDropFiles = false;
     bool autoRegisterAssets = true;
+    // Scenes update on the main thread unless this is set, see SceneUpdateMode.
+    bool parallelSceneUpdate = false;
+    // 0 uses one worker per hardware thread, minus the main thread.
+    unsigned workerThreadCount = 0;
+    // Simulation steps per second, 0 simulates once per rendered frame. See Engine::SetFixedTimestep.
+    float simulationRate = 0;
+    unsigned maxSimulationStepsPerFrame = 5;
 
 private:
     AppSettings();
@@ -1,5 +1,7 @@
 #include "Enginepch.h"
 #include "CollisionHandler.h"
+#include "Engine.h"
+#include "JobSystem/JobSystem.h"
 #include "ComponentSystem/Scene.h"
 #include "ComponentSystem/GameObject.h"
 #include "ComponentSystem/Component.h"
@@ -7,6 +9,60 @@
 #include "ComponentSystem/Components/Physics/Colliders/Collider.h"
 #include "Math/Intersection3D.hpp"
 
+namespace
+{
+	// Distance along the ray to where it enters aBounds (0 if it starts inside them), or -1 if it misses them.
+	float GetRayEntryDistance(const Math::Vector3f& aOrigin, const Math::Vector3f& aInverseDirection, const Math::AABB3D<float>& aBounds)
+	{
+		const Math::Vector3f boundsMin = aBounds.GetMin();
+		const Math::Vector3f boundsMax = aBounds.GetMax();
+
+		const float x1 = (boundsMin.x - aOrigin.x) * aInverseDirection.x;
+		const float x2 = (boundsMax.x - aOrigin.x) * aInverseDirection.x;
+		const float y1 = (boundsMin.y - aOrigin.y) * aInverseDirection.y;
+		const float y2 = (boundsMax.y - aOrigin.y) * aInverseDirection.y;
+		const float z1 = (boundsMin.z - aOrigin.z) * aInverseDirection.z;
+		const float z2 = (boundsMax.z - aOrigin.z) * aInverseDirection.z;
+
+		float entry = x1 < x2 ? x1 : x2;
+		float exit = x1 < x2 ? x2 : x1;
+		const float yEntry = y1 < y2 ? y1 : y2;
+		const float yExit = y1 < y2 ? y2 : y1;
+		const float zEntry = z1 < z2 ? z1 : z2;
+		const float zExit = z1 < z2 ? z2 : z1;
+
+		entry = yEntry > entry ? yEntry : entry;
+		entry = zEntry > entry ? zEntry : entry;
+		exit = yExit < exit ? yExit : exit;
+		exit = zExit < exit ? zExit : exit;
+
+		entry = entry > 0 ? entry : 0;
+		return entry <= exit ? entry : -1.0f;
+	}
+
+	// Transforms cache their world matrices when they're first asked for, which isn't safe to do from several threads at
+	// once. Asking on one thread first leaves the worker threads only reading them.
+	void ResolveTransformCaches(const Collider* aCollider)
+	{
+		if (std::shared_ptr<Transform> transform = aCollider->gameObject->GetComponent<Transform>())
+		{
+			transform->GetWorldMatrix();
+			transform->GetInverseWorldMatrix();
+		}
+	}
+
+	Math::Vector3f GetInverseDirection(const Math::Vector3f& aDirection)
+	{
+		// Axes the ray runs parallel to get a huge value instead of infinity, which would turn into NaN on the bounds' sides.
+		constexpr float parallel = 1e30f;
+		return {
+			aDirection.x != 0 ? 1.0f / aDirection.x : parallel,
+			aDirection.y != 0 ? 1.0f / aDirection.y : parallel,
+			aDirection.z != 0 ? 1.0f / aDirection.z : parallel
+		};
+	}
+}
+
 CollisionHandler::CollisionHandler()
 {
 }
@@ -19,53 +75,681 @@ void CollisionHandler::TestCollisions(Scene& aScene)
 {
 	PIXScopedEvent(PIX_COLOR_INDEX(9), "Test Collisions in Scene");
 
-    for (auto& goA : aScene.myGameObjects)
-    {
-		int collisions = 0;
-		if (!goA->GetActive()) continue;
+	myColliders.clear();
+	aScene.Each<Collider>([this, &aScene](Collider& aCollider)
+		{
+			if (aCollider.GetActive() && aScene.GetStaticIndexOf(*aCollider.gameObject) == StaticSceneIndex::InvalidIndex)
+			{
+				myColliders.emplace_back(&aCollider);
+			}
+		});
+
+	UpdateBroadphase();
+
+	myStats = CollisionStats();
+	myCandidates.clear();
+
+	// Layers are only swept against themselves and each other if some of their colliders collide, so layers that
+	// never meet aren't looked at at all.
+	myOverlappingProxies.resize(myProxies.size());
+	for (uint32_t layerA = 0; layerA < myLayerRuns.size(); layerA++)
+	{
+		const LayerRun& runA = myLayerRuns[layerA];
+		if (runA.begin == runA.end) continue;
+
+		const uint32_t layerBitA = 1u << layerA;
+		if (runA.masks & layerBitA)
+		{
+			SweepLayer(runA);
+		}
+
+		for (uint32_t layerB = layerA + 1; layerB < myLayerRuns.size(); layerB++)
+		{
+			const LayerRun& runB = myLayerRuns[layerB];
+			if (runB.begin != runB.end && (runA.masks & (1u << layerB)) && (runB.masks & layerBitA))
+			{
+				SweepLayers(runA, runB);
+			}
+		}
+	}
+
+	const uint32_t staticLayers = aScene.myStaticIndex.GetColliderLayers();
+	for (uint32_t a = 0; a < myProxies.size(); a++)
+	{
+		const uint32_t maskA = myProxyMasks[a];
+		if ((maskA & staticLayers) == 0) continue;
+
+		const BroadphaseProxy& proxyA = myProxies[a];
+		const uint32_t layerBitA = 1u << proxyA.layer;
+		Collider* colliderA = proxyA.collider;
+		const EntityHandle handleA = myProxyHandles[a];
+
+		aScene.myStaticIndex.QueryColliders(Math::AABB3D<float>(proxyA.min, proxyA.max), [this, colliderA, handleA, maskA, layerBitA](uint32_t, const StaticSceneIndex::Entry& aEntry)
+			{
+				Collider* staticCollider = aEntry.collider;
+				myStats.overlappingPairs++;
+
+				if ((maskA & staticCollider->GetCollisionLayerBit()) == 0 || (staticCollider->GetCollisionMask() & layerBitA) == 0)
+				{
+					myStats.maskedPairs++;
+					return;
+				}
+
+				AddCandidate(colliderA, handleA, staticCollider, aEntry.gameObject->GetHandle());
+			});
+	}
+
+	TestCandidates(aScene);
+	UpdateContacts(aScene);
+}
+
+void CollisionHandler::SweepLayer(const LayerRun& aRun)
+{
+	// Sweep along the sorted axis: the proxies that can overlap one are the ones after it that start before it ends.
+	const float* sweepMins = mySweepAxis == 0 ? myProxyBounds.GetMinX() : (mySweepAxis == 1 ? myProxyBounds.GetMinY() : myProxyBounds.GetMinZ());
+
+	for (uint32_t a = aRun.begin; a < aRun.end; a++)
+	{
+		const float sweepMax = myProxies[a].sweepMax;
+		uint32_t sweepEnd = a + 1;
+		while (sweepEnd < aRun.end && sweepMins[sweepEnd] <= sweepMax)
+		{
+			sweepEnd++;
+		}
+
+		TestProxyAgainst(a, a + 1, sweepEnd);
+	}
+}
+
+void CollisionHandler::SweepLayers(const LayerRun& aRunA, const LayerRun& aRunB)
+{
+	// Every overlapping pair has one proxy that starts first, and the other one starts before it ends. Proxies in A are
+	// tested against the ones in B that start at or after them, and the other way around for the ones that start after.
+	const float* sweepMins = mySweepAxis == 0 ? myProxyBounds.GetMinX() : (mySweepAxis == 1 ? myProxyBounds.GetMinY() : myProxyBounds.GetMinZ());
+
+	uint32_t sweepBegin = aRunB.begin;
+	for (uint32_t a = aRunA.begin; a < aRunA.end; a++)
+	{
+		while (sweepBegin < aRunB.end && sweepMins[sweepBegin] < sweepMins[a])
+		{
+			sweepBegin++;
+		}
+
+		const float sweepMax = myProxies[a].sweepMax;
+		uint32_t sweepEnd = sweepBegin;
+		while (sweepEnd < aRunB.end && sweepMins[sweepEnd] <= sweepMax)
+		{
+			sweepEnd++;
+		}
+
+		TestProxyAgainst(a, sweepBegin, sweepEnd);
+	}
+
+	sweepBegin = aRunA.begin;
+	for (uint32_t b = aRunB.begin; b < aRunB.end; b++)
+	{
+		while (sweepBegin < aRunA.end && sweepMins[sweepBegin] <= sweepMins[b])
+		{
+			sweepBegin++;
+		}
+
+		const float sweepMax = myProxies[b].sweepMax;
+		uint32_t sweepEnd = sweepBegin;
+		while (sweepEnd < aRunA.end && sweepMins[sweepEnd] <= sweepMax)
+		{
+			sweepEnd++;
+		}
+
+		TestProxyAgainst(b, sweepBegin, sweepEnd);
+	}
+}
+
+void CollisionHandler::TestProxyAgainst(const uint32_t aProxy, const uint32_t aBegin, const uint32_t aEnd)
+{
+	if (aBegin == aEnd) return;
 
-		std::shared_ptr<Collider> colliderA = goA->GetComponent<Collider>();
-		if (!colliderA || !colliderA->GetActive()) continue;
+	const BroadphaseProxy& proxyA = myProxies[aProxy];
+	Collider* colliderA = proxyA.collider;
+	const uint32_t maskA = myProxyMasks[aProxy];
+	const uint32_t layerBitA = 1u << proxyA.layer;
+	const EntityHandle handleA = myProxyHandles[aProxy];
 
-		for (auto& goB : aScene.myGameObjects)
+	// Most proxies in the sweep are apart on another axis, they're weeded out several at a time.
+	const uint32_t overlapCount = Math::IntersectionBetweenAABBSBatch(Math::AABB3D<float>(proxyA.min, proxyA.max), myProxyBounds, aBegin, aEnd, myOverlappingProxies.data());
+	myStats.sweptPairs += aEnd - aBegin;
+	myStats.overlappingPairs += overlapCount;
+
+	for (uint32_t i = 0; i < overlapCount; i++)
+	{
+		// An object's own colliders don't collide with each other. Static objects are never in the sweep, so only moving
+		// objects can have a pair of their own.
+		const uint32_t b = myOverlappingProxies[i];
+		if (myProxyHandles[b] == handleA) continue;
+
+		if ((maskA & (1u << myProxies[b].layer)) == 0 || (myProxyMasks[b] & layerBitA) == 0)
 		{
-			if (goA == goB) break;
-			if (!goB->GetActive()) continue;
+			myStats.maskedPairs++;
+			continue;
+		}
 
-			std::shared_ptr<Collider> colliderB = goB->GetComponent<Collider>();
-			if (!colliderB || !colliderB->GetActive()) continue;
+		AddCandidate(colliderA, handleA, myProxies[b].collider, myProxyHandles[b]);
+	}
+}
 
-			if (colliderA->TestCollision(colliderB.get()))
+void CollisionHandler::AddCandidate(Collider* aColliderA, const EntityHandle aHandleA, Collider* aColliderB, const EntityHandle aHandleB)
+{
+	myStats.testedPairs++;
+
+	Contact& candidate = myCandidates.emplace_back();
+	const bool isInOrder = IsColliderSortedBefore(aHandleA, aColliderA->myColliderID, aHandleB, aColliderB->myColliderID);
+	candidate.colliderA = isInOrder ? aColliderA : aColliderB;
+	candidate.colliderB = isInOrder ? aColliderB : aColliderA;
+	candidate.handleA = isInOrder ? aHandleA : aHandleB;
+	candidate.handleB = isInOrder ? aHandleB : aHandleA;
+	candidate.colliderIDA = candidate.colliderA->myColliderID;
+	candidate.colliderIDB = candidate.colliderB->myColliderID;
+}
+
+void CollisionHandler::TestCandidates(Scene& aScene)
+{
+	PIXScopedEvent(PIX_COLOR_INDEX(9), "Test Candidate Pairs");
+
+	// Every batch of candidates gets its own contact list, so threads never write to the same one. They're put together
+	// in batch order afterwards, and sorted before anything is sent.
+	const size_t batchCount = (myCandidates.size() + NarrowphaseBatchSize - 1) / NarrowphaseBatchSize;
+	if (myContactBatches.size() < batchCount)
+	{
+		myContactBatches.resize(batchCount);
+	}
+
+	for (size_t batch = 0; batch < batchCount; batch++)
+	{
+		myContactBatches[batch].clear();
+	}
+
+	auto testCandidates = [this](size_t aBegin, size_t aEnd)
+		{
+			std::vector<Contact>& contacts = myContactBatches[aBegin / NarrowphaseBatchSize];
+			for (size_t i = aBegin; i < aEnd; i++)
 			{
-				colliderA->TriggerCollisionResponse();
-				colliderB->TriggerCollisionResponse();
-				colliderA->debugColliding = true;
-				colliderB->debugColliding = true;
-				collisions++;
+				const Contact& candidate = myCandidates[i];
+				if (candidate.colliderA->TestCollision(candidate.colliderB))
+				{
+					contacts.emplace_back(candidate);
+				}
 			}
+		};
+
+	JobSystem& jobSystem = Engine::Get().GetJobSystem();
+	if (aScene.GetUpdateMode() == SceneUpdateMode::Parallel && jobSystem.GetWorkerCount() > 0 && batchCount > 1)
+	{
+		for (const Contact& candidate : myCandidates)
+		{
+			ResolveTransformCaches(candidate.colliderA);
+			ResolveTransformCaches(candidate.colliderB);
 		}
 
-		if (collisions == 0) colliderA->debugColliding = false;
-    }
+		jobSystem.ParallelFor(myCandidates.size(), NarrowphaseBatchSize, testCandidates);
+	}
+	else if (!myCandidates.empty())
+	{
+		testCandidates(0, myCandidates.size());
+	}
+
+	myNewContacts.clear();
+	for (size_t batch = 0; batch < batchCount; batch++)
+	{
+		myNewContacts.insert(myNewContacts.end(), myContactBatches[batch].begin(), myContactBatches[batch].end());
+	}
+
+	myStats.collidingPairs = static_cast<unsigned>(myNewContacts.size());
 }
 
-bool CollisionHandler::Raycast(Scene& aScene, Math::Vector3f aOrigin, Math::Vector3f aDirection, Math::Vector3f& aHitPoint)
+void CollisionHandler::UpdateContacts(Scene& aScene)
+{
+	PIXScopedEvent(PIX_COLOR_INDEX(9), "Update Contacts");
+
+	// Contacts from another scene can't be resolved here, they're dropped without events.
+	if (myContactScene != &aScene)
+	{
+		myContacts.clear();
+		myContactScene = &aScene;
+	}
+
+	std::sort(myNewContacts.begin(), myNewContacts.end(), IsContactSortedBefore);
+
+	// Last frame's colliders that are still around have their debug flags reset, and set again if they're touching
+	// something now. This frame's colliders were all there for the narrowphase.
+	for (const Contact& contact : myContacts)
+	{
+		if (Collider* colliderA = GetContactCollider(aScene.Resolve(contact.handleA), contact.colliderA, contact.colliderIDA)) colliderA->debugColliding = false;
+		if (Collider* colliderB = GetContactCollider(aScene.Resolve(contact.handleB), contact.colliderB, contact.colliderIDB)) colliderB->debugColliding = false;
+	}
+
+	for (const Contact& contact : myNewContacts)
+	{
+		contact.colliderA->debugColliding = true;
+		contact.colliderB->debugColliding = true;
+	}
+
+	// Last frame's and this frame's contacts are sorted the same way, so walking them side by side pairs up the ones
+	// that are still touching, and the events go out in the same order however the pairs were found.
+	size_t previous = 0;
+	size_t current = 0;
+	while (previous < myContacts.size() || current < myNewContacts.size())
+	{
+		const bool hasPrevious = previous < myContacts.size();
+		const bool hasCurrent = current < myNewContacts.size();
+
+		if (hasPrevious && (!hasCurrent || IsContactSortedBefore(myContacts[previous], myNewContacts[current])))
+		{
+			myStats.exitedPairs++;
+			SendContactEvent(aScene, myContacts[previous++], CollisionEvent::Exit);
+			continue;
+		}
+
+		const bool wasTouching = hasPrevious && !IsContactSortedBefore(myNewContacts[current], myContacts[previous]);
+		previous += wasTouching ? 1 : 0;
+		myStats.enteredPairs += wasTouching ? 0 : 1;
+		SendContactEvent(aScene, myNewContacts[current++], wasTouching ? CollisionEvent::Stay : CollisionEvent::Enter);
+	}
+
+	myContacts.swap(myNewContacts);
+}
+
+void CollisionHandler::SendContactEvent(Scene& aScene, const Contact& aContact, const CollisionEvent aEvent)
+{
+	// Colliders can be removed between frames, or by an earlier callback in this walk. Destroyed objects are only taken
+	// out of the scene at the start of its update, so the objects themselves stay put while the events go out.
+	GameObject* gameObjectA = aScene.Resolve(aContact.handleA);
+	GameObject* gameObjectB = aScene.Resolve(aContact.handleB);
+	Collider* colliderA = GetContactCollider(gameObjectA, aContact.colliderA, aContact.colliderIDA);
+	Collider* colliderB = GetContactCollider(gameObjectB, aContact.colliderB, aContact.colliderIDB);
+
+	// A collider that's gone only leaves its partner an Exit, with no object.
+	if (aEvent != CollisionEvent::Exit && (!colliderA || !colliderB)) return;
+
+	if (colliderA && colliderA->HasCollisionCallback(aEvent))
+	{
+		myStats.callbacks++;
+		colliderA->TriggerCollisionCallback(aEvent, colliderB ? gameObjectB : nullptr);
+
+		// The callback is free to remove either collider.
+		colliderA = GetContactCollider(gameObjectA, aContact.colliderA, aContact.colliderIDA);
+		colliderB = GetContactCollider(gameObjectB, aContact.colliderB, aContact.colliderIDB);
+		if (aEvent != CollisionEvent::Exit && (!colliderA || !colliderB)) return;
+	}
+
+	if (colliderB && colliderB->HasCollisionCallback(aEvent))
+	{
+		myStats.callbacks++;
+		colliderB->TriggerCollisionCallback(aEvent, colliderA ? gameObjectA : nullptr);
+	}
+}
+
+Collider* CollisionHandler::GetContactCollider(GameObject* aGameObject, Collider* aCollider, const uint64_t aColliderID)
+{
+	if (!aGameObject || !aGameObject->OwnsComponent(aCollider)) return nullptr;
+	return aCollider->myColliderID == aColliderID ? aCollider : nullptr;
+}
+
+bool CollisionHandler::IsColliderSortedBefore(const EntityHandle aHandleA, const uint64_t aColliderIDA, const EntityHandle aHandleB, const uint64_t aColliderIDB)
 {
-	for (auto& goA : aScene.myGameObjects)
+	if (aHandleA.index != aHandleB.index) return aHandleA.index < aHandleB.index;
+	if (aHandleA.generation != aHandleB.generation) return aHandleA.generation < aHandleB.generation;
+	return aColliderIDA < aColliderIDB;
+}
+
+bool CollisionHandler::IsContactSortedBefore(const Contact& aContactA, const Contact& aContactB)
+{
+	if (aContactA.colliderIDA != aContactB.colliderIDA || aContactA.handleA != aContactB.handleA)
+	{
+		return IsColliderSortedBefore(aContactA.handleA, aContactA.colliderIDA, aContactB.handleA, aContactB.colliderIDA);
+	}
+
+	return IsColliderSortedBefore(aContactA.handleB, aContactA.colliderIDB, aContactB.handleB, aContactB.colliderIDB);
+}
+
+bool CollisionHandler::IsProxySortedBefore(const BroadphaseProxy& aProxyA, const BroadphaseProxy& aProxyB)
+{
+	return aProxyA.layer != aProxyB.layer ? aProxyA.layer < aProxyB.layer : aProxyA.sweepMin < aProxyB.sweepMin;
+}
+
+void CollisionHandler::UpdateBroadphase()
+{
+	PIXScopedEvent(PIX_COLOR_INDEX(9), "Update Broadphase");
+
+	// A collider's proxy index can't be trusted on its own, the collider could have been destroyed and another one
+	// created in its place. Proxies are only kept if a collider that's still around points at them and they point back.
+	myProxyIsCurrent.assign(myProxies.size(), 0);
+	myNewProxies.clear();
+
+	for (Collider* collider : myColliders)
+	{
+		const uint32_t proxyIndex = collider->myBroadphaseProxy;
+		if (proxyIndex < myProxies.size() && myProxies[proxyIndex].collider == collider)
+		{
+			myProxyIsCurrent[proxyIndex] = 1;
+		}
+		else
+		{
+			myNewProxies.emplace_back().collider = collider;
+		}
+	}
+
+	size_t proxyCount = 0;
+	for (size_t i = 0; i < myProxies.size(); i++)
+	{
+		if (myProxyIsCurrent[i])
+		{
+			myProxies[proxyCount++] = myProxies[i];
+		}
+	}
+
+	myProxies.resize(proxyCount);
+	myProxies.insert(myProxies.end(), myNewProxies.begin(), myNewProxies.end());
+	myLayerRuns.assign(Collider::LayerCount, LayerRun());
+
+	if (myProxies.empty()) return;
+
+	Math::Vector3f centerMin = myProxies.front().collider->GetWorldBounds().GetCenter();
+	Math::Vector3f centerMax = centerMin;
+
+	for (BroadphaseProxy& proxy : myProxies)
+	{
+		const Math::AABB3D<float> bounds = proxy.collider->GetWorldBounds();
+		proxy.min = bounds.GetMin();
+		proxy.max = bounds.GetMax();
+		proxy.layer = proxy.collider->GetCollisionLayer();
+
+		const Math::Vector3f center = (proxy.min + proxy.max) * 0.5f;
+		centerMin.x = center.x < centerMin.x ? center.x : centerMin.x;
+		centerMin.y = center.y < centerMin.y ? center.y : centerMin.y;
+		centerMin.z = center.z < centerMin.z ? center.z : centerMin.z;
+		centerMax.x = center.x > centerMax.x ? center.x : centerMax.x;
+		centerMax.y = center.y > centerMax.y ? center.y : centerMax.y;
+		centerMax.z = center.z > centerMax.z ? center.z : centerMax.z;
+	}
+
+	// Sweep along the axis the colliders are spread out the most along, so the fewest of them share a stretch of it.
+	const Math::Vector3f centerSpread = centerMax - centerMin;
+	int sweepAxis = 0;
+	if (centerSpread.y > centerSpread.x) sweepAxis = 1;
+	if (centerSpread.z > (sweepAxis == 0 ? centerSpread.x : centerSpread.y)) sweepAxis = 2;
+
+	for (BroadphaseProxy& proxy : myProxies)
+	{
+		proxy.sweepMin = sweepAxis == 0 ? proxy.min.x : (sweepAxis == 1 ? proxy.min.y : proxy.min.z);
+		proxy.sweepMax = sweepAxis == 0 ? proxy.max.x : (sweepAxis == 1 ? proxy.max.y : proxy.max.z);
+	}
+
+	if (sweepAxis != mySweepAxis || myNewProxies.size() > myProxies.size() / 2)
+	{
+		// Last frame's order says little about this one, sort from scratch.
+		mySweepAxis = sweepAxis;
+		std::sort(myProxies.begin(), myProxies.end(), IsProxySortedBefore);
+	}
+	else
+	{
+		// Insertion sort, unless things moved far enough that a full sort is cheaper.
+		const size_t maxMoves = myProxies.size() * 8;
+		size_t moves = 0;
+
+		for (size_t i = 1; i < myProxies.size() && moves <= maxMoves; i++)
+		{
+			if (!IsProxySortedBefore(myProxies[i], myProxies[i - 1])) continue;
+
+			const BroadphaseProxy proxy = myProxies[i];
+			size_t j = i;
+			while (j > 0 && IsProxySortedBefore(proxy, myProxies[j - 1]))
+			{
+				myProxies[j] = myProxies[j - 1];
+				j--;
+			}
+
+			myProxies[j] = proxy;
+			moves += i - j;
+		}
+
+		if (moves > maxMoves)
+		{
+			std::sort(myProxies.begin(), myProxies.end(), IsProxySortedBefore);
+		}
+	}
+
+	myProxyBounds.Clear();
+	myProxyBounds.Reserve(myProxies.size());
+	myProxyHandles.resize(myProxies.size());
+	myProxyMasks.resize(myProxies.size());
+
+	for (size_t i = 0; i < myProxies.size(); i++)
+	{
+		const BroadphaseProxy& proxy = myProxies[i];
+		proxy.collider->myBroadphaseProxy = static_cast<uint32_t>(i);
+		myProxyBounds.Add(proxy.min, proxy.max);
+		myProxyHandles[i] = proxy.collider->gameObject->GetHandle();
+		myProxyMasks[i] = proxy.collider->GetCollisionMask();
+
+		LayerRun& run = myLayerRuns[proxy.layer];
+		if (run.begin == run.end)
+		{
+			run.begin = static_cast<uint32_t>(i);
+		}
+
+		run.end = static_cast<uint32_t>(i) + 1;
+		run.masks |= myProxyMasks[i];
+	}
+}
+
+void CollisionHandler::UpdateQueryHierarchy(Scene& aScene)
+{
+	// Asked for first, so anything that moves while the bounds are read shows up as a new generation next time.
+	const unsigned transformsGeneration = aScene.GetTransformsGeneration();
+
+	if (myQueryScene == &aScene && myQueryObjectsGeneration == aScene.myObjectsGeneration)
+	{
+		if (myQueryTransformsGeneration == transformsGeneration) return;
+
+		PIXScopedEvent(PIX_COLOR_INDEX(9), "Refit Collider Query Hierarchy");
+
+		for (size_t i = 0; i < myQueryItems.size(); i++)
+		{
+			myQueryItemBounds[i] = myQueryItems[i].collider->GetWorldBounds();
+		}
+
+		myQueryHierarchy.Refit(myQueryItemBounds);
+		myQueryTransformsGeneration = transformsGeneration;
+		return;
+	}
+
+	PIXScopedEvent(PIX_COLOR_INDEX(9), "Build Collider Query Hierarchy");
+
+	myQueryItems.clear();
+	myQueryItemBounds.clear();
+
+	// Inactive colliders and objects go in too, since activating them doesn't change the scene's objects. Queries skip them.
+	aScene.SyncArchetypes();
+	const ComponentTypeID colliderTypeID = GetComponentTypeID<Collider>();
+	for (const std::unique_ptr<Archetype>& archetype : aScene.myArchetypes)
 	{
-		if (!goA->GetActive()) continue;
+		if (!archetype->signature.test(colliderTypeID)) continue;
+
+		const std::vector<Component*>& colliders = archetype->columns[colliderTypeID];
+		for (size_t row = 0; row < archetype->gameObjects.size(); row++)
+		{
+			GameObject* gameObject = archetype->gameObjects[row];
+			if (aScene.GetStaticIndexOf(*gameObject) != StaticSceneIndex::InvalidIndex) continue;
+
+			Collider* collider = static_cast<Collider*>(colliders[row]);
+			myQueryItems.emplace_back(collider, gameObject->GetHandle());
+			myQueryItemBounds.emplace_back(collider->GetWorldBounds());
+		}
+	}
+
+	myQueryHierarchy.Build(myQueryItemBounds);
+	myQueryScene = &aScene;
+	myQueryObjectsGeneration = aScene.myObjectsGeneration;
+	myQueryTransformsGeneration = transformsGeneration;
+}
+
+template <typename OverlapTest, typename Function>
+inline void CollisionHandler::QueryColliders(Scene& aScene, OverlapTest&& aOverlapTest, Function&& aFunction)
+{
+	myQueryHierarchy.Query(aOverlapTest, [this, &aScene, &aFunction](uint32_t aItem)
+		{
+			const QueryItem& item = myQueryItems[aItem];
+			GameObject* gameObject = aScene.Resolve(item.handle);
+			if (gameObject && gameObject->GetActive() && item.collider->GetActive())
+			{
+				aFunction(item.collider, gameObject);
+			}
+		});
+
+	aScene.myStaticIndex.QueryColliderBounds(aOverlapTest, [&aFunction](uint32_t, const StaticSceneIndex::Entry& aEntry)
+		{
+			aFunction(aEntry.collider, aEntry.gameObject);
+		});
+}
+
+bool CollisionHandler::RaycastClosest(Scene& aScene, const Math::Ray<float>& aRay, RaycastHit& outHit, const float aMaxDistance)
+{
+	UpdateQueryHierarchy(aScene);
+	return RaycastClosestInHierarchy(aScene, aRay, outHit, aMaxDistance);
+}
+
+bool CollisionHandler::RaycastClosestInHierarchy(Scene& aScene, const Math::Ray<float>& aRay, RaycastHit& outHit, const float aMaxDistance)
+{
+	const Math::Vector3f origin = aRay.GetOrigin();
+	const Math::Vector3f inverseDirection = GetInverseDirection(aRay.GetDirection());
+	float closestDistance = aMaxDistance;
+	bool hasHit = false;
+
+	// Anything entered further away than the closest hit so far is skipped, including whole subtrees.
+	auto isInReach = [&origin, &inverseDirection, &closestDistance](const Math::AABB3D<float>& aBounds)
+		{
+			const float distance = GetRayEntryDistance(origin, inverseDirection, aBounds);
+			return distance >= 0 && distance <= closestDistance;
+		};
+
+	QueryColliders(aScene, isInReach, [&aRay, &origin, &closestDistance, &hasHit, &outHit](Collider* aCollider, GameObject* aGameObject)
+		{
+			Math::Vector3f hitPoint;
+			if (!aCollider->TestCollision(aRay, hitPoint)) return;
+
+			const float distance = (hitPoint - origin).Length();
+			if (distance > closestDistance) return;
+
+			closestDistance = distance;
+			hasHit = true;
+			outHit.gameObject = aGameObject;
+			outHit.collider = aCollider;
+			outHit.point = hitPoint;
+			outHit.distance = distance;
+		});
+
+	return hasHit;
+}
+
+unsigned CollisionHandler::RaycastAll(Scene& aScene, const Math::Ray<float>& aRay, std::vector<RaycastHit>& outHits, const float aMaxDistance)
+{
+	const Math::Vector3f origin = aRay.GetOrigin();
+	const Math::Vector3f inverseDirection = GetInverseDirection(aRay.GetDirection());
+	const size_t firstHit = outHits.size();
+	UpdateQueryHierarchy(aScene);
+
+	auto isInReach = [&origin, &inverseDirection, aMaxDistance](const Math::AABB3D<float>& aBounds)
+		{
+			const float distance = GetRayEntryDistance(origin, inverseDirection, aBounds);
+			return distance >= 0 && distance <= aMaxDistance;
+		};
 
-		std::shared_ptr<Collider> colliderA = goA->GetComponent<Collider>();
-		if (!colliderA || !colliderA->GetActive()) continue;
+	QueryColliders(aScene, isInReach, [&aRay, &origin, aMaxDistance, &outHits](Collider* aCollider, GameObject* aGameObject)
+		{
+			Math::Vector3f hitPoint;
+			if (!aCollider->TestCollision(aRay, hitPoint)) return;
+
+			const float distance = (hitPoint - origin).Length();
+			if (distance > aMaxDistance) return;
+
+			RaycastHit& hit = outHits.emplace_back();
+			hit.gameObject = aGameObject;
+			hit.collider = aCollider;
+			hit.point = hitPoint;
+			hit.distance = distance;
+		});
+
+	std::sort(outHits.begin() + firstHit, outHits.end(), [](const RaycastHit& aHitA, const RaycastHit& aHitB) { return aHitA.distance < aHitB.distance; });
+	return static_cast<unsigned>(outHits.size() - firstHit);
+}
+
+unsigned CollisionHandler::RaycastClosestBatch(Scene& aScene, const std::vector<Math::Ray<float>>& aRays, std::vector<RaycastHit>& outHits, const float aMaxDistance)
+{
+	PIXScopedEvent(PIX_COLOR_INDEX(9), "Raycast Batch");
+
+	// The hierarchy is brought up to date once for the whole batch instead of being checked ray by ray.
+	UpdateQueryHierarchy(aScene);
+
+	outHits.clear();
+	outHits.resize(aRays.size());
 
-		Math::Ray<float> aRay(aOrigin, aDirection);
-		Math::Vector3f hitPoint;
-		if (colliderA->TestCollision(aRay, hitPoint))
+	unsigned hitCount = 0;
+	for (size_t i = 0; i < aRays.size(); i++)
+	{
+		if (RaycastClosestInHierarchy(aScene, aRays[i], outHits[i], aMaxDistance))
 		{
-			return true;
+			hitCount++;
 		}
 	}
 
+	return hitCount;
+}
+
+unsigned CollisionHandler::OverlapSphere(Scene& aScene, const Math::Vector3f& aCenter, const float aRadius, std::vector<GameObject*>& outGameObjects)
+{
+	const Math::Sphere<float> sphere(aCenter, aRadius);
+	const size_t firstObject = outGameObjects.size();
+	UpdateQueryHierarchy(aScene);
+
+	auto overlapsSphere = [&sphere](const Math::AABB3D<float>& aBounds) { return Math::IntersectionSphereAABB(sphere, aBounds); };
+
+	QueryColliders(aScene, overlapsSphere, [&sphere, &outGameObjects](Collider* aCollider, GameObject* aGameObject)
+		{
+			if (aCollider->TestCollision(sphere))
+			{
+				outGameObjects.emplace_back(aGameObject);
+			}
+		});
+
+	return static_cast<unsigned>(outGameObjects.size() - firstObject);
+}
+
+unsigned CollisionHandler::OverlapBox(Scene& aScene, const Math::AABB3D<float>& aBox, std::vector<GameObject*>& outGameObjects)
+{
+	const size_t firstObject = outGameObjects.size();
+	UpdateQueryHierarchy(aScene);
+
+	auto overlapsBox = [&aBox](const Math::AABB3D<float>& aBounds) { return Math::IntersectionBetweenAABBS(aBox, aBounds); };
+
+	QueryColliders(aScene, overlapsBox, [&aBox, &outGameObjects](Collider* aCollider, GameObject* aGameObject)
+		{
+			if (aCollider->TestCollision(aBox))
+			{
+				outGameObjects.emplace_back(aGameObject);
+			}
+		});
+
+	return static_cast<unsigned>(outGameObjects.size() - firstObject);
+}
+
+bool CollisionHandler::Raycast(Scene& aScene, Math::Vector3f aOrigin, Math::Vector3f aDirection, Math::Vector3f& aHitPoint)
+{
+	RaycastHit hit;
+	if (RaycastClosest(aScene, Math::Ray<float>(aOrigin, aDirection), hit))
+	{
+		aHitPoint = hit.point;
+		return true;
+	}
+
 	aHitPoint = { 0, 0, 0 };
 	return false;
 }
@@ -1,6 +1,42 @@
 #pragma once
+#include "Math/Ray.hpp"
+#include "Math/AABB3D.hpp"
+#include "Math/BoundingVolumeHierarchy.hpp"
+#include "Math/IntersectionBatch.hpp"
+#include "ComponentSystem/EntityHandle.h"
 
 class Scene;
+class Collider;
+class GameObject;
+enum class CollisionEvent : uint8_t;
+
+struct RaycastHit
+{
+    GameObject* gameObject = nullptr;
+    Collider* collider = nullptr;
+    // World space point the ray enters the collider at, the ray's origin if it starts inside it.
+    Math::Vector3f point;
+    float distance = 0;
+};
+
+// Pair counts from the last TestCollisions, to see how much the broadphase and the collision layers save.
+struct CollisionStats
+{
+    // Moving collider pairs the sweep compared bounds for. Layers that don't collide with each other aren't swept at all.
+    unsigned sweptPairs = 0;
+    // Pairs whose bounds overlap, moving against moving and moving against static.
+    unsigned overlappingPairs = 0;
+    // Overlapping pairs skipped because one's layer isn't in the other's mask.
+    unsigned maskedPairs = 0;
+    // Pairs that went through the narrowphase, and how many of those collide.
+    unsigned testedPairs = 0;
+    unsigned collidingPairs = 0;
+    // Colliding pairs that weren't touching the frame before, and pairs that stopped touching since.
+    unsigned enteredPairs = 0;
+    unsigned exitedPairs = 0;
+    // Collision callbacks called, only for the events the colliders asked for.
+    unsigned callbacks = 0;
+};
 
 class CollisionHandler
 {
@@ -9,6 +45,132 @@ public:
     ~CollisionHandler();
 
     void TestCollisions(Scene& aScene);
+    const CollisionStats& GetStats() const { return myStats; }
+
+    // Scene queries, over a bounding volume hierarchy of the moving colliders and the scene's static index.
+    // The hierarchy is rebuilt when objects or colliders were added or removed since the last query, and refitted when
+    // something moved, so queries see the scene as it is. Hits are on active colliders of active game objects.
+
+    // Returns the hit closest to the ray's origin within aMaxDistance.
+    bool RaycastClosest(Scene& aScene, const Math::Ray<float>& aRay, RaycastHit& outHit, const float aMaxDistance = FLT_MAX);
+    // Appends every hit within aMaxDistance to outHits, closest first. Returns the amount of hits.
+    unsigned RaycastAll(Scene& aScene, const Math::Ray<float>& aRay, std::vector<RaycastHit>& outHits, const float aMaxDistance = FLT_MAX);
+    // Finds the closest hit for each ray in one go, outHits[i] is for aRays[i] and has no game object if the ray missed.
+    // Returns the amount of rays that hit something.
+    unsigned RaycastClosestBatch(Scene& aScene, const std::vector<Math::Ray<float>>& aRays, std::vector<RaycastHit>& outHits, const float aMaxDistance = FLT_MAX);
+    // Append the game objects whose colliders overlap the world space shape to outGameObjects. Return the amount found.
+    unsigned OverlapSphere(Scene& aScene, const Math::Vector3f& aCenter, const float aRadius, std::vector<GameObject*>& outGameObjects);
+    unsigned OverlapBox(Scene& aScene, const Math::AABB3D<float>& aBox, std::vector<GameObject*>& outGameObjects);
+
     bool Raycast(Scene& aScene, Math::Vector3f aOrigin, Math::Vector3f aDirection, Math::Vector3f& aHitPoint);
+private:
+    // A moving collider's world bounds in the broadphase, kept sorted on the sweep axis across frames.
+    struct BroadphaseProxy
+    {
+        float sweepMin = 0;
+        float sweepMax = 0;
+        Math::Vector3f min;
+        Math::Vector3f max;
+        unsigned layer = 0;
+        Collider* collider = nullptr;
+    };
+
+    // The sorted proxies on one layer, and the union of their masks.
+    struct LayerRun
+    {
+        uint32_t begin = 0;
+        uint32_t end = 0;
+        uint32_t masks = 0;
+    };
+
+    // Two colliders that might touch, or do. They're ordered by their objects' handles and their collider IDs so a pair
+    // always has the same key, and sorting by it gives the same order in every run. A contact outlives the frame it was
+    // found in, so its colliders are only looked at through GetContactCollider.
+    struct Contact
+    {
+        Collider* colliderA = nullptr;
+        Collider* colliderB = nullptr;
+        EntityHandle handleA;
+        EntityHandle handleB;
+        uint64_t colliderIDA = 0;
+        uint64_t colliderIDB = 0;
+    };
+
+    // A moving collider in the query hierarchy. The hierarchy is rebuilt before a query if any collider was removed, so
+    // the collider is alive, but its object's handle still tells whether it's active.
+    struct QueryItem
+    {
+        Collider* collider = nullptr;
+        EntityHandle handle;
+    };
+
+    // Brings the proxies up to date with myColliders: drops the ones that are gone, adds new ones and re-sorts.
+    void UpdateBroadphase();
+    static bool IsProxySortedBefore(const BroadphaseProxy& aProxyA, const BroadphaseProxy& aProxyB);
+    // Sweeps a layer's proxies against each other, and two layers' proxies against the other layer's.
+    void SweepLayer(const LayerRun& aRun);
+    void SweepLayers(const LayerRun& aRunA, const LayerRun& aRunB);
+    // Tests a proxy against the sorted proxies in [aBegin, aEnd): bounds first, then masks, then the narrowphase.
+    void TestProxyAgainst(const uint32_t aProxy, const uint32_t aBegin, const uint32_t aEnd);
+    void AddCandidate(Collider* aColliderA, const EntityHandle aHandleA, Collider* aColliderB, const EntityHandle aHandleB);
+    // Runs the narrowphase on the candidate pairs, spread over the job system's workers if the scene updates in parallel.
+    void TestCandidates(Scene& aScene);
+    // Compares this frame's contacts to last frame's, sends the collision events and updates the debug flags.
+    void UpdateContacts(Scene& aScene);
+    // Sends aEvent to the contact's colliders that asked for it and are still on their objects.
+    void SendContactEvent(Scene& aScene, const Contact& aContact, const CollisionEvent aEvent);
+    // The collider if it's still one of aGameObject's components and hasn't been replaced by a new one at the same address,
+    // otherwise nullptr. Nothing is read through aCollider until it's known to be alive.
+    static Collider* GetContactCollider(GameObject* aGameObject, Collider* aCollider, const uint64_t aColliderID);
+    // Objects are ordered by their handles, colliders on the same object by ID.
+    static bool IsColliderSortedBefore(const EntityHandle aHandleA, const uint64_t aColliderIDA, const EntityHandle aHandleB, const uint64_t aColliderIDB);
+    static bool IsContactSortedBefore(const Contact& aContactA, const Contact& aContactB);
+    // Rebuilds the query hierarchy from the scene's moving colliders if it was built for another scene or the scene's
+    // objects changed since, and refits it to the colliders' bounds if any transforms moved.
+    void UpdateQueryHierarchy(Scene& aScene);
+    // Calls aFunction(collider, gameObject) for every active collider whose bounds pass aOverlapTest(const Math::AABB3D<float>&).
+    // The query hierarchy is used as it is, UpdateQueryHierarchy has to be called first.
+    template <typename OverlapTest, typename Function>
+    void QueryColliders(Scene& aScene, OverlapTest&& aOverlapTest, Function&& aFunction);
+    // RaycastClosest without updating the query hierarchy, so a batch of rays only updates it once.
+    bool RaycastClosestInHierarchy(Scene& aScene, const Math::Ray<float>& aRay, RaycastHit& outHit, const float aMaxDistance);
+
+    // Active colliders on moving objects. Colliders on static objects are found through the scene's static index instead,
+    // and never tested against each other.
+    std::vector<Collider*> myColliders;
+    // Pairs the broadphase found this frame, that pass their masks. The narrowphase runs on them in batches, each
+    // batch writing the ones that touch to its own list.
+    static constexpr size_t NarrowphaseBatchSize = 256;
+    std::vector<Contact> myCandidates;
+    std::vector<std::vector<Contact>> myContactBatches;
+    // Pairs touching since the last TestCollisions and the ones touching in this one, sorted.
+    std::vector<Contact> myContacts;
+    std::vector<Contact> myNewContacts;
+    const Scene* myContactScene = nullptr;
+    // Sweep and prune over the moving colliders, sorted by layer and then along the sweep axis. Objects barely move
+    // between frames, so last frame's order is nearly sorted and an insertion sort gets it back in close to linear time.
+    std::vector<BroadphaseProxy> myProxies;
+    std::vector<BroadphaseProxy> myNewProxies;
+    // The sorted proxies' bounds, packed so a proxy can be tested against the ones after it in groups.
+    Math::AABBBatch myProxyBounds;
+    // The sorted proxies' masks, so pairs can be rejected without looking at the colliders.
+    std::vector<uint32_t> myProxyMasks;
+    // Where each layer's proxies are, indexed by layer.
+    std::vector<LayerRun> myLayerRuns;
+    // Indices of the proxies that overlap the one being swept.
+    std::vector<uint32_t> myOverlappingProxies;
+    std::vector<uint8_t> myProxyIsCurrent;
+    // Handles of the proxies' game objects, in the same order.
+    std::vector<EntityHandle> myProxyHandles;
+    int mySweepAxis = 0;
+    CollisionStats myStats;
+
+    Math::BoundingVolumeHierarchy<float> myQueryHierarchy;
+    std::vector<QueryItem> myQueryItems;
+    std::vector<Math::AABB3D<float>> myQueryItemBounds;
+    // The scene the hierarchy was built for, and its generations as of the last rebuild or refit.
+    const Scene* myQueryScene = nullptr;
+    unsigned myQueryObjectsGeneration = 0;
+    unsigned myQueryTransformsGeneration = 0;
 };
 
@@ -0,0 +1,19 @@
+#pragma once
+#include "ComponentType.h"
+
+class GameObject;
+class Component;
+
+// All game objects in a scene that share the exact same set of component types.
+// Each column holds pointers to one component type's components, row by row with gameObjects. The components themselves
+// stay owned and allocated by their game objects, so a typed iteration over the scene skips the archetypes and game
+// objects it doesn't need, but still goes through a pointer for every component it reads.
+// They can't be moved into the columns while GetComponent hands out shared_ptrs to them: adding or removing a component
+// moves an object to another archetype, which would leave those pointing at the old rows. What locality there is comes
+// from the per-type object pools the components are allocated from.
+struct Archetype
+{
+	ComponentMask signature;
+	std::vector<GameObject*> gameObjects;
+	std::array<std::vector<Component*>, MAX_COMPONENT_TYPES> columns;
+};
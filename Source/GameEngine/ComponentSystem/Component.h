@@ -3,6 +3,17 @@
 class GameObject;
 struct GameObjectEvent;
 
+// Where a component's Update is allowed to run when the scene updates in parallel.
+enum class ComponentUpdateThreading
+{
+    // Update touches other game objects or shared engine state, so it runs on the main thread.
+    MainThread,
+    // Update only reads and writes its own game object (and reads shared state that doesn't change during the update,
+    // such as the timer), so different game objects can run it concurrently. It must not send events, add/remove components,
+    // or instantiate/destroy game objects.
+    ThreadSafe
+};
+
 class Component
 {
 public:
@@ -14,6 +25,13 @@ public:
     // Is called every frame.
     virtual void Update() = 0;
 
+    // Override to let the scene run Update on a worker thread, see ComponentUpdateThreading.
+    virtual ComponentUpdateThreading GetUpdateThreading() const { return ComponentUpdateThreading::MainThread; }
+
+    // Override to return false if Update has nothing to do on a static game object (see GameObject::SetStatic),
+    // static objects then skip it, and skip updating altogether if none of their components need it.
+    virtual bool GetUpdatesWhenStatic() const { return true; }
+
 
     void SetActive(bool aActive) { myIsActive = aActive; }
     bool GetActive() const { return myIsActive; }
@@ -0,0 +1,58 @@
+#include "Enginepch.h"
+
+#include "ComponentType.h"
+#include "Component.h"
+
+std::array<ComponentTypeRegistry::IsAFunction, MAX_COMPONENT_TYPES> ComponentTypeRegistry::ourIsAFunctions = {};
+std::array<ComponentTypeRegistry::CloneFunction, MAX_COMPONENT_TYPES> ComponentTypeRegistry::ourCloneFunctions = {};
+std::array<ComponentMask, MAX_COMPONENT_TYPES> ComponentTypeRegistry::ourTypeMasks = {};
+std::array<std::atomic<unsigned>, MAX_COMPONENT_TYPES> ComponentTypeRegistry::ourTypeMaskGenerations = {};
+std::atomic<unsigned> ComponentTypeRegistry::ourTypeCount = 0;
+std::mutex ComponentTypeRegistry::ourRegisterMutex;
+
+ComponentTypeID ComponentTypeRegistry::Register(IsAFunction aIsAFunction, CloneFunction aCloneFunction)
+{
+	std::scoped_lock lock(ourRegisterMutex);
+
+	const unsigned id = ourTypeCount.load(std::memory_order_relaxed);
+	assert(id < MAX_COMPONENT_TYPES && "Too many component types, increase MAX_COMPONENT_TYPES!");
+
+	ourIsAFunctions[id] = aIsAFunction;
+	ourCloneFunctions[id] = aCloneFunction;
+	ourTypeCount.store(id + 1, std::memory_order_release);
+	return id;
+}
+
+std::shared_ptr<Component> ComponentTypeRegistry::Clone(ComponentTypeID aConcreteTypeID, const Component& aComponent)
+{
+	const CloneFunction cloneFunction = ourCloneFunctions[aConcreteTypeID];
+	return cloneFunction ? cloneFunction(aComponent) : nullptr;
+}
+
+const ComponentMask& ComponentTypeRegistry::GetTypeMask(ComponentTypeID aConcreteTypeID, const Component* aComponent)
+{
+	if (ourTypeMaskGenerations[aConcreteTypeID].load(std::memory_order_acquire) == GetGeneration())
+	{
+		return ourTypeMasks[aConcreteTypeID];
+	}
+
+	std::scoped_lock lock(ourRegisterMutex);
+
+	const unsigned generation = GetGeneration();
+	if (ourTypeMaskGenerations[aConcreteTypeID].load(std::memory_order_relaxed) != generation)
+	{
+		ComponentMask mask;
+		for (unsigned id = 0; id < generation; id++)
+		{
+			if (ourIsAFunctions[id](aComponent))
+			{
+				mask.set(id);
+			}
+		}
+
+		ourTypeMasks[aConcreteTypeID] = mask;
+		ourTypeMaskGenerations[aConcreteTypeID].store(generation, std::memory_order_release);
+	}
+
+	return ourTypeMasks[aConcreteTypeID];
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include "EngineDefines.h"
+#include "ObjectPool.h"
+
+class Component;
+
+using ComponentTypeID = unsigned;
+using ComponentMask = std::bitset<MAX_COMPONENT_TYPES>;
+
+// Hands out a unique ID per component type the first time that type is used, and keeps track of which
+// registered types a component "is a" (so that looking up a base class such as Collider finds a BoxCollider).
+// The RTTI check only runs when a type mask is (re)built, never on lookups.
+class ComponentTypeRegistry
+{
+public:
+    using IsAFunction = bool(*)(const Component*);
+    // Copy constructs a component of the registered type, nullptr for types that can't be copied.
+    using CloneFunction = std::shared_ptr<Component>(*)(const Component&);
+
+    static ComponentTypeID Register(IsAFunction aIsAFunction, CloneFunction aCloneFunction);
+
+    // Copies aComponent, whose concrete type must be aConcreteTypeID. Returns nullptr if that type can't be copied.
+    static std::shared_ptr<Component> Clone(ComponentTypeID aConcreteTypeID, const Component& aComponent);
+    static const bool IsCloneable(ComponentTypeID aConcreteTypeID) { return ourCloneFunctions[aConcreteTypeID] != nullptr; }
+
+    // Increases every time a new type is registered, masks built before that need to be rebuilt.
+    static unsigned GetGeneration() { return ourTypeCount.load(std::memory_order_acquire); }
+
+    // Returns the mask of all registered types that a component of the given concrete type satisfies.
+    // Safe to call from several threads, a stale mask is rebuilt under the registry lock.
+    static const ComponentMask& GetTypeMask(ComponentTypeID aConcreteTypeID, const Component* aComponent);
+
+private:
+    static std::array<IsAFunction, MAX_COMPONENT_TYPES> ourIsAFunctions;
+    static std::array<CloneFunction, MAX_COMPONENT_TYPES> ourCloneFunctions;
+    static std::array<ComponentMask, MAX_COMPONENT_TYPES> ourTypeMasks;
+    static std::array<std::atomic<unsigned>, MAX_COMPONENT_TYPES> ourTypeMaskGenerations;
+    static std::atomic<unsigned> ourTypeCount;
+    static std::mutex ourRegisterMutex;
+};
+
+template <typename T>
+constexpr ComponentTypeRegistry::CloneFunction GetComponentCloneFunction()
+{
+    if constexpr (std::is_copy_constructible_v<T>)
+    {
+        return [](const Component& aComponent) -> std::shared_ptr<Component> { return MakePooled<T>(static_cast<const T&>(aComponent)); };
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
+template <typename T>
+ComponentTypeID GetComponentTypeID()
+{
+    static const ComponentTypeID id = ComponentTypeRegistry::Register([](const Component* aComponent) { return dynamic_cast<const T*>(aComponent) != nullptr; }, GetComponentCloneFunction<T>());
+    return id;
+}
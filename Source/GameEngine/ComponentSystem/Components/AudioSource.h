@@ -23,6 +23,10 @@ public:
         SourceType sourceType = SourceType::Non3D;
     };
 
+    AudioSource() = default;
+    // Audio instances are playing FMOD events, a copy would control the same sounds as the original.
+    AudioSource(const AudioSource&) = delete;
+
     void Start() override;
     void Update() override;
     void ReceiveEvent(const GameObjectEvent& aEvent) override;
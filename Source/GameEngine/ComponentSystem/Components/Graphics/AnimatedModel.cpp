@@ -399,7 +399,7 @@ void AnimatedModel::UpdateAnimationLayer(AnimationLayer& aAnimationLayer)
     {
         UpdateAnimationState(*aAnimationLayer.nextState);
 
-        aAnimationLayer.currentBlendTime += Engine::Get().GetTimer().GetDeltaTime();
+        aAnimationLayer.currentBlendTime += Engine::Get().GetTimer().GetFixedDeltaTime();
         float blendFactor = aAnimationLayer.currentBlendTime / aAnimationLayer.maxBlendTime;
         BlendPoses(aAnimationLayer, blendFactor);
         if (aAnimationLayer.currentBlendTime >= aAnimationLayer.maxBlendTime)
@@ -425,7 +425,7 @@ void AnimatedModel::UpdateAnimationLayer(AnimationLayer& aAnimationLayer)
 
 void AnimatedModel::UpdateAnimationState(AnimationState& aAnimationState)
 {
-    aAnimationState.currentTime += Engine::Get().GetTimer().GetDeltaTime();
+    aAnimationState.currentTime += Engine::Get().GetTimer().GetFixedDeltaTime();
     if (aAnimationState.currentTime < aAnimationState.frameTime) return;
 
     aAnimationState.currentTime = 0;
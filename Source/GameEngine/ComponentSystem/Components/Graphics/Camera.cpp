@@ -115,19 +115,7 @@ Math::PlaneVolume<float> Camera::GetFrustumPlaneVolume(Math::Matrix4x4f aToObjec
 
 bool Camera::GetViewcullingIntersection(std::shared_ptr<Transform> aObjectTransform, Math::AABB3D<float> aObjectAABB)
 {
-	std::shared_ptr<Transform> goTransform = gameObject->GetComponent<Transform>();
-	Math::Matrix4x4f objectMatrix = aObjectTransform->GetWorldMatrix();
-
-	if (goTransform->IsScaled())
-	{
-		objectMatrix = objectMatrix.GetInverse();
-	}
-	else
-	{
-		objectMatrix = objectMatrix.GetFastInverse();
-	}
-
-	return Math::IntersectionBetweenPlaneVolumeAABB(GetFrustumPlaneVolume(objectMatrix), aObjectAABB);
+	return Math::IntersectionBetweenPlaneVolumeAABB(GetFrustumPlaneVolume(aObjectTransform->GetInverseWorldMatrix()), aObjectAABB);
 }
 
 bool Camera::Serialize(nl::json& outJsonObject)
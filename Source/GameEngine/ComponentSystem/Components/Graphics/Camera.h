@@ -17,6 +17,8 @@ public:
 	Camera(float aLeft, float aRight, float aTop, float aBottom, float aNear, float aFar);
 	void Start() override;
 	void Update() override;
+	ComponentUpdateThreading GetUpdateThreading() const override { return ComponentUpdateThreading::ThreadSafe; }
+	bool GetUpdatesWhenStatic() const override { return false; }
 
 	void InitPerspectiveProjection(float aFOV, float aNearPlane, float aFarPlane, Math::Vector2f aResolution);
 	void InitOrtographicProjection(float aLeft, float aRight, float aTop, float aBottom, float aNearPlane, float aFarPlane);
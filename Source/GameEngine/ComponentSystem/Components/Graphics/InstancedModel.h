@@ -9,9 +9,13 @@ class InstancedModel : public Component
 public:
     ~InstancedModel() override;
     InstancedModel() = default;
+    // The instance buffer belongs to this component, copies would end up writing to the same GPU buffer.
+    InstancedModel(const InstancedModel&) = delete;
 
     void Start() override;
     void Update() override;
+    ComponentUpdateThreading GetUpdateThreading() const override { return ComponentUpdateThreading::ThreadSafe; }
+    bool GetUpdatesWhenStatic() const override { return false; }
 
     void SetMesh(std::shared_ptr<Mesh> aMesh);
     std::shared_ptr<Mesh> GetMesh() { return myMesh; }
@@ -18,6 +18,8 @@ public:
 
     void Start() override;
     void Update() override;
+    ComponentUpdateThreading GetUpdateThreading() const override { return ComponentUpdateThreading::ThreadSafe; }
+    bool GetUpdatesWhenStatic() const override { return false; }
 
     void SetMesh(std::shared_ptr<Mesh> aMesh);
     std::shared_ptr<Mesh> GetMesh() { return myMesh; }
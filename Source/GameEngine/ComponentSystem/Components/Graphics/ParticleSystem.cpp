@@ -17,7 +17,7 @@ void ParticleSystem::Start()
 
 void ParticleSystem::Update()
 {
-	float dt = Engine::Get().GetTimer().GetDeltaTime();
+	float dt = Engine::Get().GetTimer().GetFixedDeltaTime();
 
 	for (auto& emitter : myEmitters)
 	{
@@ -25,6 +25,14 @@ void ParticleSystem::Update()
 	}
 }
 
+void ParticleSystem::UploadVertexBuffers()
+{
+	for (auto& emitter : myEmitters)
+	{
+		emitter.UploadVertexBuffer();
+	}
+}
+
 ParticleEmitter& ParticleSystem::AddEmitter(const ParticleEmitterSettings& aSettings)
 {
 	ParticleEmitter& emitter = myEmitters.emplace_back(ParticleEmitter());
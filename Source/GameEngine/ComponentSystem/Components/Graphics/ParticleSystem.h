@@ -7,9 +7,15 @@ class ParticleSystem : public Component
 public:
 	~ParticleSystem() override;
 	ParticleSystem() = default;
+	// Emitters own their vertex buffers, so particle systems can't be copied.
+	ParticleSystem(const ParticleSystem&) = delete;
 
 	void Start() override;
+	// Update only simulates the emitters, so it can run on a worker thread. Their vertex buffers are uploaded on the main
+	// thread through UploadVertexBuffers, which the render assembler calls before drawing them.
 	void Update() override;
+	ComponentUpdateThreading GetUpdateThreading() const override { return ComponentUpdateThreading::ThreadSafe; }
+	void UploadVertexBuffers();
 
 	ParticleEmitter& AddEmitter(const ParticleEmitterSettings& aSettings);
 
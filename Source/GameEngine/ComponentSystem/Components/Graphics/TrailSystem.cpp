@@ -18,7 +18,7 @@ void TrailSystem::Start()
 
 void TrailSystem::Update()
 {
-	float dt = Engine::Get().GetTimer().GetDeltaTime();
+	float dt = Engine::Get().GetTimer().GetFixedDeltaTime();
 
 	for (auto& emitter : myEmitters)
 	{
@@ -26,6 +26,14 @@ void TrailSystem::Update()
 	}
 }
 
+void TrailSystem::UploadVertexBuffers()
+{
+	for (auto& emitter : myEmitters)
+	{
+		emitter.UploadVertexBuffer();
+	}
+}
+
 TrailEmitter& TrailSystem::AddEmitter(const TrailEmitterSettings& aSettings)
 {
 	TrailEmitter& emitter = myEmitters.emplace_back(TrailEmitter());
@@ -7,9 +7,15 @@ class TrailSystem : public Component
 public:
 	~TrailSystem() override;
 	TrailSystem() = default;
+	// Emitters own their vertex buffers, so trail systems can't be copied.
+	TrailSystem(const TrailSystem&) = delete;
 
 	void Start() override;
+	// Update only simulates the emitters, so it can run on a worker thread. Their vertex buffers are uploaded on the main
+	// thread through UploadVertexBuffers, which the render assembler calls before drawing them.
 	void Update() override;
+	ComponentUpdateThreading GetUpdateThreading() const override { return ComponentUpdateThreading::ThreadSafe; }
+	void UploadVertexBuffers();
 
 	TrailEmitter& AddEmitter(const TrailEmitterSettings& aSettings);
 
@@ -23,7 +23,7 @@ void VFXModel::Start()
 
 void VFXModel::Update()
 {
-	myCurrentTimeAlive += Engine::Get().GetTimer().GetDeltaTime();
+	myCurrentTimeAlive += Engine::Get().GetTimer().GetFixedDeltaTime();
 	myCustomShaderParameters.y = myCurrentTimeAlive;
 
 	if (myLifetime <= 0)
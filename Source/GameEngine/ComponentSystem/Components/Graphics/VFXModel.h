@@ -21,7 +21,9 @@ public:
 	VFXModel(VFXData aVFXData);
 
 	void Start() override;
+	// Update only sets CPU-side values on its own game object's Model, which the render assembler reads on the main thread.
 	void Update() override;
+	ComponentUpdateThreading GetUpdateThreading() const override { return ComponentUpdateThreading::ThreadSafe; }
 
 	void PlayVFX();
 	void ReceiveEvent(const GameObjectEvent& aEvent) override;
@@ -13,6 +13,8 @@ public:
 	~AmbientLight() override;
 	void Start() override;
 	void Update() override;
+	ComponentUpdateThreading GetUpdateThreading() const override { return ComponentUpdateThreading::ThreadSafe; }
+	bool GetUpdatesWhenStatic() const override { return false; }
 	void SetColor(Math::Vector3f aColor);
 	void SetIntensity(float aIntensity);
 	void SetCubemap(std::shared_ptr<Texture> aCubemap);
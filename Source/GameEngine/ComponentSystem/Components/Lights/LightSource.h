@@ -9,9 +9,13 @@ class LightSource : public Component
 {
 public:
 	LightSource(float aIntensity = 1.0f, Math::Vector3f aColor = { 1.0f, 1.0f, 1.0f });
+	// Each light owns its shadow map, so lights can't be copied (or cloned from a prefab).
+	LightSource(const LightSource&) = delete;
 	~LightSource() override;
 	void Start() override;
 	void Update() override;
+	ComponentUpdateThreading GetUpdateThreading() const override { return ComponentUpdateThreading::ThreadSafe; }
+	bool GetUpdatesWhenStatic() const override { return false; }
 	virtual void EnableShadowCasting(unsigned aShadowMapWidth, unsigned aShadowMapHeight);
 
 	void SetColor(Math::Vector3f aColor);
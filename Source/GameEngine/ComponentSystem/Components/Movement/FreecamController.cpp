@@ -36,7 +36,7 @@ void FreecamController::Start()
 
 void FreecamController::Update()
 {
-	float deltaTime = Engine::Get().GetTimer().GetDeltaTime();
+	float deltaTime = Engine::Get().GetTimer().GetFixedDeltaTime();
 	InputHandler& inputHandler = Engine::Get().GetInputHandler();
 
 	if (!inputHandler.GetBinaryAction("CameraActivate"))
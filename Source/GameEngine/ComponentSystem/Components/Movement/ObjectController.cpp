@@ -28,7 +28,7 @@ void ObjectController::Start()
 
 void ObjectController::Update()
 {
-	float deltaTime = Engine::Get().GetTimer().GetDeltaTime();
+	float deltaTime = Engine::Get().GetTimer().GetFixedDeltaTime();
 	InputHandler& inputHandler = Engine::Get().GetInputHandler();
 
 	if (inputHandler.GetBinaryAction("ObjectSpeedUp"))
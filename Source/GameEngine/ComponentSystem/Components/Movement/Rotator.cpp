@@ -14,13 +14,13 @@ Rotator::Rotator(const Math::Vector3f& aRotationVector)
 
 void Rotator::Start()
 {
-	myCurrentRot = Math::Quatf(gameObject->GetComponent<Transform>()->GetRotation() * 3.14f / 180.0f);
+	myCurrentRot = gameObject->GetComponent<Transform>()->GetRotationQuaternion();
 	myGoalRot = myCurrentRot;
 }
 
 void Rotator::Update()
 {
-	float deltaTime = Engine::Get().GetTimer().GetDeltaTime();
+	float deltaTime = Engine::Get().GetTimer().GetFixedDeltaTime();
     myCurrentRotationTime += deltaTime;
 
 	if (myCurrentRotationTime >= myMaxRotationTime)
@@ -30,7 +30,7 @@ void Rotator::Update()
 
 	float rotTimeDelta = myCurrentRotationTime / myMaxRotationTime;
 	Math::Quatf rot = Math::Quatf::Slerp(myCurrentRot, myGoalRot, rotTimeDelta);
-	gameObject->GetComponent<Transform>()->SetRotation(rot.GetEulerAnglesDegrees());
+	gameObject->GetComponent<Transform>()->SetRotationQuaternion(rot);
 }
 
 void Rotator::SetRotationPerSecond(const Math::Vector3f& aRotationVector)
@@ -12,6 +12,7 @@ public:
 	
 	void Start() override;
 	void Update() override;
+	ComponentUpdateThreading GetUpdateThreading() const override { return ComponentUpdateThreading::ThreadSafe; }
 
 	void SetRotationPerSecond(const Math::Vector3f& aRotationVector);
 
@@ -21,7 +21,7 @@ bool BoxCollider::TestCollision(const BoxCollider* aCollider) const
 {
     std::shared_ptr<Transform> transform = gameObject->GetComponent<Transform>();
     std::shared_ptr<Transform> collTransform = aCollider->gameObject->GetComponent<Transform>();
-    Math::AABB3D<float> otherAABBinMySpace = aCollider->GetAABB().GetAABBinNewSpace(collTransform->GetWorldMatrix() * transform->GetWorldMatrix().GetFastInverse());
+    Math::AABB3D<float> otherAABBinMySpace = aCollider->GetAABB().GetAABBinNewSpace(Math::Matrix4x4f::MultiplyAffine(collTransform->GetWorldMatrix(), transform->GetInverseWorldMatrix()));
 
     return Math::IntersectionBetweenAABBS(GetAABB(), otherAABBinMySpace);
 }
@@ -30,7 +30,7 @@ bool BoxCollider::TestCollision(const SphereCollider* aCollider) const
 {
     std::shared_ptr<Transform> transform = gameObject->GetComponent<Transform>();
     std::shared_ptr<Transform> collTransform = aCollider->gameObject->GetComponent<Transform>();
-    Math::Sphere<float> sphereInMySpace = aCollider->GetSphere().GetSphereinNewSpace(collTransform->GetWorldMatrix() * transform->GetWorldMatrix().GetFastInverse());
+    Math::Sphere<float> sphereInMySpace = aCollider->GetSphere().GetSphereinNewSpace(Math::Matrix4x4f::MultiplyAffine(collTransform->GetWorldMatrix(), transform->GetInverseWorldMatrix()));
 
     Math::Vector3f intersectionPoint;
     return Math::IntersectionSphereAABB(sphereInMySpace, GetAABB(), intersectionPoint);
@@ -39,10 +39,38 @@ bool BoxCollider::TestCollision(const SphereCollider* aCollider) const
 bool BoxCollider::TestCollision(const Math::Ray<float> aRay, Math::Vector3f& outHitPoint) const
 {
     std::shared_ptr<Transform> transform = gameObject->GetComponent<Transform>();
-    Math::Ray<float> rayInMySpace = aRay.GetRayinNewSpace(transform->GetWorldMatrix().GetFastInverse());
+    Math::Ray<float> rayInMySpace = aRay.GetRayinNewSpace(transform->GetInverseWorldMatrix());
 
-    outHitPoint;
-    return Math::IntersectionAABBRay(myAABB, rayInMySpace);
+    Math::Vector3f hitPointInMySpace;
+    if (!Math::IntersectionAABBRay(myAABB, rayInMySpace, hitPointInMySpace))
+    {
+        return false;
+    }
+
+    outHitPoint = Math::ToVector3(Math::ToVector4(hitPointInMySpace, 1.0f) * transform->GetWorldMatrix());
+    return true;
+}
+
+bool BoxCollider::TestCollision(const Math::Sphere<float>& aSphere) const
+{
+    std::shared_ptr<Transform> transform = gameObject->GetComponent<Transform>();
+    Math::Sphere<float> sphereInMySpace = aSphere.GetSphereinNewSpace(transform->GetInverseWorldMatrix());
+
+    return Math::IntersectionSphereAABB(sphereInMySpace, GetAABB());
+}
+
+bool BoxCollider::TestCollision(const Math::AABB3D<float>& aAABB) const
+{
+    std::shared_ptr<Transform> transform = gameObject->GetComponent<Transform>();
+    Math::AABB3D<float> aabbInMySpace = aAABB.GetAABBinNewSpace(transform->GetInverseWorldMatrix());
+
+    return Math::IntersectionBetweenAABBS(GetAABB(), aabbInMySpace);
+}
+
+Math::AABB3D<float> BoxCollider::GetWorldBounds() const
+{
+    std::shared_ptr<Transform> transform = gameObject->GetComponent<Transform>();
+    return myAABB.GetAABBinNewSpace(transform->GetWorldMatrix());
 }
 
 const Math::AABB3D<float>& BoxCollider::GetAABB() const
@@ -85,5 +113,6 @@ bool BoxCollider::Deserialize(nl::json& aJsonObject)
     }
 
     myAABB.InitWithCenterAndExtents(centerOffset, extents);
+    DeserializeCollisionLayers(aJsonObject);
     return true;
 }
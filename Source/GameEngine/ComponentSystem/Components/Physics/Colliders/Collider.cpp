@@ -1,15 +1,76 @@
 #include "Enginepch.h"
 #include "Collider.h"
 
+void Collider::SetCollisionCallback(const CollisionCallback& aCallback, std::initializer_list<CollisionEvent> aEvents)
+{
+	myCollisionCallback = aCallback;
+	myCollisionEvents = 0;
+
+	if (!aCallback) return;
+
+	for (const CollisionEvent event : aEvents)
+	{
+		myCollisionEvents |= 1u << static_cast<uint8_t>(event);
+	}
+}
+
 void Collider::SetCollisionResponse(const std::function<void()>& aCallback)
 {
-	myCollisionResponse = aCallback;
+	if (!aCallback)
+	{
+		SetCollisionCallback(nullptr, {});
+		return;
+	}
+
+	SetCollisionCallback([aCallback](const CollisionEvent, GameObject*) { aCallback(); }, { CollisionEvent::Enter });
+}
+
+void Collider::TriggerCollisionCallback(const CollisionEvent aEvent, GameObject* aOther) const
+{
+	if (HasCollisionCallback(aEvent))
+	{
+		myCollisionCallback(aEvent, aOther);
+	}
 }
 
-void Collider::TriggerCollisionResponse() const
+void Collider::SetCollisionLayer(const unsigned aLayer)
 {
-	if (myCollisionResponse)
+	if (aLayer >= LayerCount)
 	{
-		myCollisionResponse();
+		LOG(LogComponentSystem, Warning, "Collision layer {} is out of range, colliders only have {} layers!", aLayer, LayerCount);
+		return;
+	}
+
+	myCollisionLayer = aLayer;
+}
+
+void Collider::SetCollisionMask(const uint32_t aMask)
+{
+	myCollisionMask = aMask;
+}
+
+void Collider::DeserializeCollisionLayers(nl::json& aJsonObject)
+{
+	if (aJsonObject.contains("Layer"))
+	{
+		SetCollisionLayer(aJsonObject["Layer"].get<unsigned>());
+	}
+
+	if (aJsonObject.contains("CollidesWith"))
+	{
+		uint32_t mask = 0;
+		for (auto& layer : aJsonObject["CollidesWith"])
+		{
+			const unsigned layerIndex = layer.get<unsigned>();
+			if (layerIndex >= LayerCount)
+			{
+				LOG(LogComponentSystem, Warning, "Collision layer {} is out of range, colliders only have {} layers!", layerIndex, LayerCount);
+				continue;
+			}
+
+			mask |= 1u << layerIndex;
+		}
+
+		SetCollisionMask(mask);
 	}
 }
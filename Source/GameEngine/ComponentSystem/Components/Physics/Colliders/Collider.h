@@ -1,27 +1,83 @@
 #pragma once
+#include <atomic>
 #include "ComponentSystem/Component.h"
 #include "Math/Ray.hpp"
+#include "Math/AABB3D.hpp"
+#include "Math/Sphere.hpp"
 
 class BoxCollider;
 class SphereCollider;
+class GameObject;
+
+// Touching transitions between two colliders, reported once per pair and frame.
+enum class CollisionEvent : uint8_t
+{
+    Enter,
+    Stay,
+    Exit
+};
 
 class Collider : public Component
 {
     friend class CollisionHandler;
 public:
+    Collider() = default;
+    // Copies don't take the collision callback along, it's usually bound to the original object.
+    Collider(const Collider& aCollider) : Component(aCollider), debugColliding(aCollider.debugColliding), myCollisionLayer(aCollider.myCollisionLayer), myCollisionMask(aCollider.myCollisionMask) {}
+
     void Start() override {}
     void Update() override {}
+    ComponentUpdateThreading GetUpdateThreading() const override { return ComponentUpdateThreading::ThreadSafe; }
+    bool GetUpdatesWhenStatic() const override { return false; }
 
     virtual bool TestCollision(const Collider* aCollider) const = 0;
     virtual bool TestCollision(const BoxCollider* aCollider) const = 0;
     virtual bool TestCollision(const SphereCollider* aCollider) const = 0;
+    // The ray is in world space, outHitPoint is set to the world space point the ray enters the collider at.
     virtual bool TestCollision(const Math::Ray<float> aRay, Math::Vector3f& outHitPoint) const = 0;
+    // World space shapes, for overlap queries.
+    virtual bool TestCollision(const Math::Sphere<float>& aSphere) const = 0;
+    virtual bool TestCollision(const Math::AABB3D<float>& aAABB) const = 0;
+
+    // World space AABB around the collider, used to find colliders that might touch before testing them properly.
+    virtual Math::AABB3D<float> GetWorldBounds() const = 0;
 
+    // aCallback gets the other collider's game object, and is only called for the events in aEvents. Exit comes the frame
+    // the colliders stop touching, or when one of them is deactivated, removed or destroyed. The other object is nullptr
+    // if its collider was removed or destroyed.
+    using CollisionCallback = std::function<void(const CollisionEvent aEvent, GameObject* aOther)>;
+    void SetCollisionCallback(const CollisionCallback& aCallback, std::initializer_list<CollisionEvent> aEvents);
+    // Called when the collider starts touching another one.
     void SetCollisionResponse(const std::function<void()>& aCallback);
+    const bool HasCollisionCallback(const CollisionEvent aEvent) const { return myCollisionEvents & (1u << static_cast<uint8_t>(aEvent)); }
+
+    // Two colliders are only tested against each other if each one's layer is in the other's mask.
+    // Colliders start on layer 0 and collide with every layer. Static colliders' layers are picked up when the scene's
+    // static index is built, so a static collider's layer should be set before it's made static.
+    static constexpr unsigned LayerCount = 32;
+    void SetCollisionLayer(const unsigned aLayer);
+    void SetCollisionMask(const uint32_t aMask);
+    const unsigned GetCollisionLayer() const { return myCollisionLayer; }
+    const uint32_t GetCollisionMask() const { return myCollisionMask; }
+    const uint32_t GetCollisionLayerBit() const { return 1u << myCollisionLayer; }
+    const bool CanCollideWith(const Collider& aCollider) const { return (myCollisionMask & aCollider.GetCollisionLayerBit()) && (aCollider.myCollisionMask & GetCollisionLayerBit()); }
 
     bool debugColliding = false;
+protected:
+    // Reads "Layer" and "CollidesWith" (a list of layers) if the collider's json has them.
+    void DeserializeCollisionLayers(nl::json& aJsonObject);
 private:
-    void TriggerCollisionResponse() const;
-    std::function<void()> myCollisionResponse;
+    void TriggerCollisionCallback(const CollisionEvent aEvent, GameObject* aOther) const;
+    CollisionCallback myCollisionCallback;
+    // A bit per CollisionEvent that's passed on to the callback.
+    uint8_t myCollisionEvents = 0;
+    unsigned myCollisionLayer = 0;
+    uint32_t myCollisionMask = UINT32_MAX;
+    // Index of the collider's proxy in the collision handler's broadphase, only trusted if the proxy points back at it.
+    uint32_t myBroadphaseProxy = UINT32_MAX;
+    // Unique for the program's lifetime, copies get their own. Colliders are pooled, so a new one can take the address of
+    // one that was just removed, but never its ID.
+    static inline std::atomic<uint64_t> ourNextColliderID = 1;
+    uint64_t myColliderID = ourNextColliderID.fetch_add(1, std::memory_order_relaxed);
 };
 
@@ -25,7 +25,7 @@ bool SphereCollider::TestCollision(const SphereCollider* aCollider) const
 {
     std::shared_ptr<Transform> transform = gameObject->GetComponent<Transform>();
     std::shared_ptr<Transform> collTransform = aCollider->gameObject->GetComponent<Transform>();
-    Math::Sphere<float> otherSphereInMySpace = aCollider->GetSphere().GetSphereinNewSpace(collTransform->GetWorldMatrix() * transform->GetWorldMatrix().GetFastInverse());
+    Math::Sphere<float> otherSphereInMySpace = aCollider->GetSphere().GetSphereinNewSpace(Math::Matrix4x4f::MultiplyAffine(collTransform->GetWorldMatrix(), transform->GetInverseWorldMatrix()));
 
     return Math::IntersectionBetweenSpheres(GetSphere(), otherSphereInMySpace);
 }
@@ -33,10 +33,35 @@ bool SphereCollider::TestCollision(const SphereCollider* aCollider) const
 bool SphereCollider::TestCollision(const Math::Ray<float> aRay, Math::Vector3f& outHitPoint) const
 {
     std::shared_ptr<Transform> transform = gameObject->GetComponent<Transform>();
-    Math::Ray<float> rayInMySpace = aRay.GetRayinNewSpace(transform->GetWorldMatrix().GetFastInverse());
-    
-    outHitPoint;
-    return Math::IntersectionSphereRay(mySphere, rayInMySpace);
+    Math::Sphere<float> sphereInWorldSpace = mySphere.GetSphereinNewSpace(transform->GetWorldMatrix());
+
+    return Math::IntersectionSphereRay(sphereInWorldSpace, aRay, outHitPoint);
+}
+
+bool SphereCollider::TestCollision(const Math::Sphere<float>& aSphere) const
+{
+    std::shared_ptr<Transform> transform = gameObject->GetComponent<Transform>();
+    Math::Sphere<float> sphereInWorldSpace = mySphere.GetSphereinNewSpace(transform->GetWorldMatrix());
+
+    return Math::IntersectionBetweenSpheres(sphereInWorldSpace, aSphere);
+}
+
+bool SphereCollider::TestCollision(const Math::AABB3D<float>& aAABB) const
+{
+    std::shared_ptr<Transform> transform = gameObject->GetComponent<Transform>();
+    Math::Sphere<float> sphereInWorldSpace = mySphere.GetSphereinNewSpace(transform->GetWorldMatrix());
+
+    return Math::IntersectionSphereAABB(sphereInWorldSpace, aAABB);
+}
+
+Math::AABB3D<float> SphereCollider::GetWorldBounds() const
+{
+    std::shared_ptr<Transform> transform = gameObject->GetComponent<Transform>();
+    Math::Sphere<float> sphereInWorldSpace = mySphere.GetSphereinNewSpace(transform->GetWorldMatrix());
+
+    const float radius = sphereInWorldSpace.GetRadius();
+    const Math::Vector3f extents(radius, radius, radius);
+    return Math::AABB3D<float>(sphereInWorldSpace.GetPoint() - extents, sphereInWorldSpace.GetPoint() + extents);
 }
 
 const Math::Sphere<float>& SphereCollider::GetSphere() const
@@ -66,5 +91,6 @@ bool SphereCollider::Deserialize(nl::json& aJsonObject)
     }
 
     mySphere.InitWithCenterAndRadius(centerOffset, radius);
+    DeserializeCollisionLayers(aJsonObject);
     return true;
 }
@@ -14,6 +14,9 @@ public:
     bool TestCollision(const BoxCollider* aCollider) const override;
     bool TestCollision(const SphereCollider* aCollider) const override;
     bool TestCollision(const Math::Ray<float> aRay, Math::Vector3f& outHitPoint) const override;
+    bool TestCollision(const Math::Sphere<float>& aSphere) const override;
+    bool TestCollision(const Math::AABB3D<float>& aAABB) const override;
+    Math::AABB3D<float> GetWorldBounds() const override;
 
     const Math::Sphere<float>& GetSphere() const;
 
@@ -1,15 +1,76 @@
 #include "Enginepch.h"
 
 #include "Transform.h"
+#include "ComponentSystem/GameObject.h"
 #include "CommonUtilities/SerializationUtils.hpp"
 
+namespace
+{
+	// A thread's own counts. Only that thread writes them, the atomics just let GetTotals read them while it does.
+	struct ThreadTransformStats
+	{
+		std::atomic<size_t> inverseWorldMatrixRequests = 0;
+		std::atomic<size_t> inverseWorldMatrixComputations = 0;
+
+		ThreadTransformStats();
+		~ThreadTransformStats();
+	};
+
+	std::mutex statsMutex;
+	std::vector<const ThreadTransformStats*> threadStats;
+	TransformStats exitedThreadStats;
+
+	ThreadTransformStats::ThreadTransformStats()
+	{
+		std::scoped_lock lock(statsMutex);
+		threadStats.emplace_back(this);
+	}
+
+	ThreadTransformStats::~ThreadTransformStats()
+	{
+		std::scoped_lock lock(statsMutex);
+		std::erase(threadStats, this);
+		exitedThreadStats.inverseWorldMatrixRequests += inverseWorldMatrixRequests;
+		exitedThreadStats.inverseWorldMatrixComputations += inverseWorldMatrixComputations;
+	}
+
+	thread_local ThreadTransformStats localStats;
+
+	void Increment(std::atomic<size_t>& aCounter)
+	{
+		aCounter.store(aCounter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	}
+}
+
+TransformStats TransformStats::GetTotals()
+{
+	std::scoped_lock lock(statsMutex);
+	TransformStats totals = exitedThreadStats;
+	for (const ThreadTransformStats* stats : threadStats)
+	{
+		totals.inverseWorldMatrixRequests += stats->inverseWorldMatrixRequests.load(std::memory_order_relaxed);
+		totals.inverseWorldMatrixComputations += stats->inverseWorldMatrixComputations.load(std::memory_order_relaxed);
+	}
+
+	return totals;
+}
+
 Transform::Transform(Math::Vector3f aPosition, Math::Vector3f aRotation, Math::Vector3f aScale)
 {
 	myPosition = aPosition;
-	myRotation = aRotation;
+	SetEulerRotation(aRotation);
 	myScale = aScale;
 }
 
+Transform::Transform(const Transform& aTransform) : Component(aTransform)
+{
+	myPosition = aTransform.myPosition;
+	myRotation = aTransform.myRotation;
+	myEulerRotation = aTransform.myEulerRotation;
+	myEulerRotationIsDirty = aTransform.myEulerRotationIsDirty;
+	myScale = aTransform.myScale;
+}
+
 void Transform::Start()
 {
 
@@ -20,60 +81,82 @@ void Transform::Update()
 
 }
 
-void Transform::UpdateToWorldMatrix(Math::Matrix4x4f aToWorldMatrix, Math::Matrix4x4f aToWorldMatrixNoScale)
+void Transform::SetIsDirty()
+{
+	myIsDirty = true;
+	SetWorldIsDirty();
+}
+
+void Transform::SetWorldIsDirty()
 {
-	myToWorldMatrix = aToWorldMatrix;
-	myToWorldMatrixNoScale = aToWorldMatrixNoScale;
+	// A dirty transform's subtree is dirty already.
+	if (myWorldIsDirty) return;
 
-	for (auto& child : myChildren)
+	myWorldIsDirty = true;
+
+	// Whatever was worked out from the resolved world matrix, like collider bounds, is out of date now.
+	if (gameObject)
 	{
-		child->UpdateToWorldMatrix(GetMatrix() * aToWorldMatrix, GetMatrix(true) * aToWorldMatrixNoScale);
+		gameObject->OnTransformMoved();
 	}
-}
 
-void Transform::UpdateChildrenToWorldMatrix()
-{
 	for (auto& child : myChildren)
 	{
-		child->UpdateToWorldMatrix(GetMatrix() * myToWorldMatrix, GetMatrix(true) * myToWorldMatrixNoScale);
+		child->SetWorldIsDirty();
 	}
 }
 
-void Transform::SetIsDirty()
+void Transform::UpdateLocalMatrix() const
 {
-	myIsDirty = true;
+	if (!myIsDirty) return;
 
-	UpdateChildrenToWorldMatrix();
-}
+	// Scale * rotation * translation written out directly: the rotation's rows scaled, and the translation as row 4.
+	myCachedMatrixNoScale = Math::Matrix4x4f::CreateRotationMatrixFromQuaternionVectorXYZW({ myRotation.x, myRotation.y, myRotation.z, myRotation.w });
+	myCachedMatrixNoScale(4, 1) = myPosition.x;
+	myCachedMatrixNoScale(4, 2) = myPosition.y;
+	myCachedMatrixNoScale(4, 3) = myPosition.z;
 
-const Math::Matrix4x4f& Transform::GetMatrix(bool aNoScale)
-{
-	if (myIsDirty)
+	myCachedMatrix = myCachedMatrixNoScale;
+	for (int column = 1; column <= 3; column++)
 	{
-		myCachedMatrix = Math::Matrix4x4f();
-		myCachedMatrixNoScale = Math::Matrix4x4f();
+		myCachedMatrix(1, column) *= myScale.x;
+		myCachedMatrix(2, column) *= myScale.y;
+		myCachedMatrix(3, column) *= myScale.z;
+	}
 
-		Math::Matrix4x4f scaleMatrix;
-		scaleMatrix(1, 1) = myScale.x;
-		scaleMatrix(2, 2) = myScale.y;
-		scaleMatrix(3, 3) = myScale.z;
+	myIsDirty = false;
+}
 
-		myCachedMatrix *= scaleMatrix;
+void Transform::ResolveWorldMatrix() const
+{
+	if (!myWorldIsDirty) return;
 
-		Math::Matrix4x4f rotationMatrix = Math::Matrix4x4f::CreateRollPitchYawMatrix(myRotation);
-		myCachedMatrix *= rotationMatrix;
-		myCachedMatrixNoScale *= rotationMatrix;
+	constexpr float scaleTolerance = 0.0001f;
+	myWorldIsScaled = std::abs(myScale.x - 1.0f) > scaleTolerance || std::abs(myScale.y - 1.0f) > scaleTolerance || std::abs(myScale.z - 1.0f) > scaleTolerance;
 
-		Math::Matrix4x4f translationMatrix;
-		translationMatrix(4, 1) = myPosition.x;
-		translationMatrix(4, 2) = myPosition.y;
-		translationMatrix(4, 3) = myPosition.z;
+	if (myParent)
+	{
+		myParent->ResolveWorldMatrix();
+		myToWorldMatrix = myParent->myWorldMatrix;
+		myToWorldMatrixNoScale = myParent->myWorldMatrixNoScale;
+		myWorldIsScaled = myWorldIsScaled || myParent->myWorldIsScaled;
+	}
+	else
+	{
+		myToWorldMatrix = Math::Matrix4x4f();
+		myToWorldMatrixNoScale = Math::Matrix4x4f();
+	}
 
-		myCachedMatrix *= translationMatrix;
-		myCachedMatrixNoScale *= translationMatrix;
+	UpdateLocalMatrix();
+	myWorldMatrix = Math::Matrix4x4f::MultiplyAffine(myCachedMatrix, myToWorldMatrix);
+	myWorldMatrixNoScale = Math::Matrix4x4f::MultiplyAffine(myCachedMatrixNoScale, myToWorldMatrixNoScale);
+	myWorldIsDirty = false;
+	myInverseWorldMatrixIsDirty = true;
+}
 
-		myIsDirty = false;
-	}
+const Math::Matrix4x4f& Transform::GetMatrix(bool aNoScale)
+{
+	UpdateLocalMatrix();
 
 	if (aNoScale)
 	{
@@ -85,20 +168,39 @@ const Math::Matrix4x4f& Transform::GetMatrix(bool aNoScale)
 	}
 }
 
-const Math::Matrix4x4f Transform::GetWorldMatrix(bool aNoScale)
+const Math::Matrix4x4f& Transform::GetWorldMatrix(bool aNoScale)
 {
+	ResolveWorldMatrix();
+
 	if (aNoScale)
 	{
-		return GetMatrix(true) * myToWorldMatrixNoScale;
+		return myWorldMatrixNoScale;
 	}
 	else
 	{
-		return GetMatrix(false) * myToWorldMatrix;
+		return myWorldMatrix;
 	}
 }
 
-const Math::Matrix4x4f Transform::GetToWorldMatrix(bool aNoScale)
+const Math::Matrix4x4f& Transform::GetInverseWorldMatrix()
 {
+	ResolveWorldMatrix();
+	Increment(localStats.inverseWorldMatrixRequests);
+
+	if (myInverseWorldMatrixIsDirty)
+	{
+		myInverseWorldMatrix = myWorldIsScaled ? myWorldMatrix.GetInverse() : myWorldMatrix.GetFastInverse();
+		myInverseWorldMatrixIsDirty = false;
+		Increment(localStats.inverseWorldMatrixComputations);
+	}
+
+	return myInverseWorldMatrix;
+}
+
+const Math::Matrix4x4f& Transform::GetToWorldMatrix(bool aNoScale)
+{
+	ResolveWorldMatrix();
+
 	if (aNoScale)
 	{
 		return myToWorldMatrixNoScale;
@@ -132,16 +234,7 @@ void Transform::SetParent(Transform* aTransform)
 		myParent = aTransform;
 	}
 
-	if (myParent)
-	{
-		myParent->UpdateChildrenToWorldMatrix();
-	}
-	else
-	{
-		myToWorldMatrix = Math::Matrix4x4f();
-		myToWorldMatrixNoScale = Math::Matrix4x4f();
-		UpdateChildrenToWorldMatrix();
-	}
+	SetWorldIsDirty();
 }
 
 void Transform::SetParentInternal(Transform* aTransform)
@@ -156,16 +249,7 @@ void Transform::SetParentInternal(Transform* aTransform)
 		myParent = aTransform;
 	}
 
-	if (myParent)
-	{
-		myParent->UpdateChildrenToWorldMatrix();
-	}
-	else
-	{
-		myToWorldMatrix = Math::Matrix4x4f();
-		myToWorldMatrixNoScale = Math::Matrix4x4f();
-		UpdateChildrenToWorldMatrix();
-	}
+	SetWorldIsDirty();
 }
 
 void Transform::AddChild(Transform* aTransform)
@@ -180,7 +264,6 @@ void Transform::AddChild(Transform* aTransform)
 
 	aTransform->SetParentInternal(this);
 	myChildren.emplace_back(aTransform);
-	UpdateChildrenToWorldMatrix();
 }
 
 void Transform::RemoveChild(Transform* aTransform)
@@ -193,6 +276,7 @@ void Transform::RemoveChild(Transform* aTransform)
 		if (myChildren[i] == aTransform)
 		{
 			aTransform->myParent = nullptr;
+			aTransform->SetWorldIsDirty();
 			myChildren.erase(myChildren.begin() + i);
 			break;
 		}
@@ -239,6 +323,7 @@ const Math::Vector3f Transform::GetTranslation(bool aInWorldSpace) const
 {
 	if (aInWorldSpace)
 	{
+		ResolveWorldMatrix();
 		return Math::ToVector3(Math::ToVector4(myPosition) * myToWorldMatrix);
 	}
 	else
@@ -251,11 +336,18 @@ const Math::Vector3f Transform::GetRotation(bool aInWorldSpace) const
 {
 	if (aInWorldSpace)
 	{
-		return Math::ToVector3(Math::ToVector4(myRotation) * myToWorldMatrix);
+		ResolveWorldMatrix();
+		return Math::ToVector3(Math::ToVector4(GetRotation()) * myToWorldMatrix);
 	}
 	else
 	{
-		return myRotation;
+		if (myEulerRotationIsDirty)
+		{
+			myEulerRotation = myRotation.GetEulerAnglesDegrees();
+			myEulerRotationIsDirty = false;
+		}
+
+		return myEulerRotation;
 	}
 }
 
@@ -263,6 +355,7 @@ const Math::Vector3f Transform::GetScale(bool aInWorldSpace) const
 {
 	if (aInWorldSpace)
 	{
+		ResolveWorldMatrix();
 		return Math::ToVector3(Math::ToVector4(myScale) * myToWorldMatrix);
 	}
 	else
@@ -297,32 +390,42 @@ void Transform::AddTranslation(const float aX, const float aY, const float aZ)
 
 void Transform::SetRotation(const Math::Vector3f aRotationInDegrees)
 {
-	myRotation = aRotationInDegrees;
+	SetEulerRotation(aRotationInDegrees);
 	SetIsDirty();
 }
 
 void Transform::SetRotation(const float aPitch, const float aYaw, const float aRoll)
 {
-	myRotation.x = aPitch;
-	myRotation.y = aYaw;
-	myRotation.z = aRoll;
+	SetEulerRotation({ aPitch, aYaw, aRoll });
 	SetIsDirty();
 }
 
 void Transform::AddRotation(const Math::Vector3f aRotationInDegrees)
 {
-	myRotation += aRotationInDegrees;
+	SetEulerRotation(GetRotation() + aRotationInDegrees);
 	SetIsDirty();
 }
 
 void Transform::AddRotation(const float aPitch, const float aYaw, const float aRoll)
 {
-	myRotation.x += aPitch;
-	myRotation.y += aYaw;
-	myRotation.z += aRoll;
+	SetEulerRotation(GetRotation() + Math::Vector3f(aPitch, aYaw, aRoll));
 	SetIsDirty();
 }
 
+void Transform::SetRotationQuaternion(const Math::Quatf& aRotation)
+{
+	myRotation = aRotation;
+	myEulerRotationIsDirty = true;
+	SetIsDirty();
+}
+
+void Transform::SetEulerRotation(const Math::Vector3f& aRotationInDegrees)
+{
+	myEulerRotation = aRotationInDegrees;
+	myEulerRotationIsDirty = false;
+	myRotation = Math::Quatf(aRotationInDegrees * Math::DEGREES_TO_RADIANS);
+}
+
 void Transform::SetScale(const Math::Vector3f aScale)
 {
 	myScale = aScale;
@@ -4,15 +4,31 @@
 #include "Math/Vector.hpp"
 #include "Math/Quaternion.hpp"
 
+// How often inverse world matrices were asked for and how often they actually had to be computed, summed over all transforms.
+// Every thread counts in its own copy, so worker threads asking for them at once don't contend on a shared counter.
+struct TransformStats
+{
+	size_t inverseWorldMatrixRequests = 0;
+	size_t inverseWorldMatrixComputations = 0;
+
+	// The counts of every thread so far, including threads that have exited.
+	static TransformStats GetTotals();
+};
+
 
 
 class Transform : public Component
 {
 public:
 	Transform(Math::Vector3f aPosition = { 0, 0, 0 }, Math::Vector3f aRotation = { 0, 0, 0 }, Math::Vector3f aScale = { 1, 1, 1 });
+	// Copies the local position, rotation and scale, the copy starts out without a parent or children.
+	Transform(const Transform& aTransform);
+	Transform& operator=(const Transform&) = delete;
 
     void Start() override;
     void Update() override;
+    ComponentUpdateThreading GetUpdateThreading() const override { return ComponentUpdateThreading::ThreadSafe; }
+    bool GetUpdatesWhenStatic() const override { return false; }
 
 	void SetParent(Transform* aTransform);
 	void AddChild(Transform* aTransform);
@@ -20,10 +36,15 @@ public:
 
 	const Transform* GetParent() const { return myParent; }
 	const std::vector<Transform*> GetChildren() const { return myChildren; }
+	const bool IsInHierarchy() const { return myParent || !myChildren.empty(); }
 
 	const Math::Matrix4x4f& GetMatrix(bool aNoScale = false);
-	const Math::Matrix4x4f GetWorldMatrix(bool aNoScale = false);
-	const Math::Matrix4x4f GetToWorldMatrix(bool aNoScale = false);
+	// World matrices are resolved on demand, parents first, and cached. Moving a transform only flags it and its subtree,
+	// so a parent can be moved any number of times a frame and its children are only recomputed once they are read.
+	const Math::Matrix4x4f& GetWorldMatrix(bool aNoScale = false);
+	const Math::Matrix4x4f& GetToWorldMatrix(bool aNoScale = false);
+	// Inverse of GetWorldMatrix(), worked out the first time it's asked for after the transform or a parent moved.
+	const Math::Matrix4x4f& GetInverseWorldMatrix();
 
 	const Math::Vector3f GetRightVector(bool aInWorldSpace = false);
 	const Math::Vector3f GetUpVector(bool aInWorldSpace = false);
@@ -37,10 +58,13 @@ public:
 	void AddTranslation(const Math::Vector3f aTranslation);
 	void AddTranslation(const float aX, const float aY, const float aZ);
 
+	// The rotation is stored as a quaternion, the Euler angle getters and setters (in degrees) convert to and from it.
 	void SetRotation(const Math::Vector3f aRotationInDegrees);
 	void SetRotation(const float aPitch, const float aYaw, const float aRoll);
 	void AddRotation(const Math::Vector3f aRotationInDegrees);
 	void AddRotation(const float aPitch, const float aYaw, const float aRoll);
+	void SetRotationQuaternion(const Math::Quatf& aRotation);
+	const Math::Quatf& GetRotationQuaternion() const { return myRotation; }
 
 	void SetScale(const Math::Vector3f aScale);
 	void SetScale(const float aX, const float aY, const float aZ);
@@ -54,20 +78,38 @@ public:
 	bool Serialize(nl::json& outJsonObject) override;
 	bool Deserialize(nl::json& aJsonObject) override;
 private:
-	void UpdateToWorldMatrix(Math::Matrix4x4f aToWorldMatrix, Math::Matrix4x4f aToWorldMatrixNoScale);
-	void UpdateChildrenToWorldMatrix();
+	void SetEulerRotation(const Math::Vector3f& aRotationInDegrees);
+	void UpdateLocalMatrix() const;
+	void ResolveWorldMatrix() const;
 	void SetIsDirty();
+	void SetWorldIsDirty();
 	void SetParentInternal(Transform* aTransform);
-	Math::Matrix4x4f myCachedMatrix;
-	Math::Matrix4x4f myCachedMatrixNoScale;
-	bool myIsDirty = true;
 
-	Math::Matrix4x4f myToWorldMatrix;
-	Math::Matrix4x4f myToWorldMatrixNoScale;
+	// The caches are filled in by const getters too, so they're mutable. Filling them in isn't thread-safe: during a
+	// parallel scene update only the worker updating an object touches its transform, and Scene resolves the world matrices
+	// of the objects that stay on the main thread beforehand, so workers only read those.
+	mutable Math::Matrix4x4f myCachedMatrix;
+	mutable Math::Matrix4x4f myCachedMatrixNoScale;
+	mutable bool myIsDirty = true;
+
+	// The parent's world matrix and this transform's own. While myWorldIsDirty is set, so is every descendant's.
+	mutable Math::Matrix4x4f myToWorldMatrix;
+	mutable Math::Matrix4x4f myToWorldMatrixNoScale;
+	mutable Math::Matrix4x4f myWorldMatrix;
+	mutable Math::Matrix4x4f myWorldMatrixNoScale;
+	mutable bool myWorldIsDirty = true;
+	// Whether this transform or a parent has a scale other than 1, the inverse can be a transpose if not.
+	mutable bool myWorldIsScaled = false;
+
+	mutable Math::Matrix4x4f myInverseWorldMatrix;
+	mutable bool myInverseWorldMatrixIsDirty = true;
 
 	Math::Vector3f myPosition;
-	Math::Vector3f myRotation;
+	Math::Quatf myRotation;
 	Math::Vector3f myScale;
+	// The rotation as it was last set in degrees, or converted from myRotation when it's read after setting a quaternion.
+	mutable Math::Vector3f myEulerRotation;
+	mutable bool myEulerRotationIsDirty = false;
 
 	Transform* myParent = nullptr;
 	std::vector<Transform*> myChildren;
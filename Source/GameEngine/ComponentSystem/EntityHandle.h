@@ -0,0 +1,16 @@
+#pragma once
+#include <cstdint>
+
+// Weak, non-owning reference to a game object in a scene.
+// Resolving a handle through its scene is a constant time lookup that returns nullptr once the object has been destroyed,
+// even if its slot has been reused by a newer object since (the generations won't match).
+struct EntityHandle
+{
+    static constexpr uint32_t InvalidIndex = UINT32_MAX;
+
+    uint32_t index = InvalidIndex;
+    uint32_t generation = 0;
+
+    const bool IsValid() const { return index != InvalidIndex; }
+    bool operator==(const EntityHandle& aOther) const = default;
+};
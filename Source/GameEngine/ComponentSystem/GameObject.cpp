@@ -1,6 +1,7 @@
 #include "Enginepch.h"
 
 #include "ComponentSystem/GameObject.h"
+#include "ComponentSystem/Scene.h"
 #include "Engine.h"
 #include "Time/Timer.h"
 
@@ -17,11 +18,33 @@ void GameObject::Update()
 {
 	if (!GetActive()) return;
 
-	myTimeAlive += Engine::Get().GetTimer().GetDeltaTime();
+	myTimeAlive += Engine::Get().GetTimer().GetFixedDeltaTime();
 
 	for (auto& comp : myComponents)
 	{
-		if (comp->GetActive())
+		if (comp->GetActive() && (!myIsStatic || comp->GetUpdatesWhenStatic()))
+		{
+			comp->Update();
+		}
+	}
+}
+
+void GameObject::UpdateThreadSafe()
+{
+	UpdateComponents(ComponentUpdateThreading::ThreadSafe);
+}
+
+void GameObject::UpdateMainThread()
+{
+	myTimeAlive += Engine::Get().GetTimer().GetFixedDeltaTime();
+	UpdateComponents(ComponentUpdateThreading::MainThread);
+}
+
+void GameObject::UpdateComponents(const ComponentUpdateThreading aThreading)
+{
+	for (auto& comp : myComponents)
+	{
+		if (comp->GetActive() && comp->GetUpdateThreading() == aThreading && (!myIsStatic || comp->GetUpdatesWhenStatic()))
 		{
 			comp->Update();
 		}
@@ -38,9 +61,172 @@ void GameObject::SetActive(bool aActive)
 	}
 }
 
+std::shared_ptr<GameObject> GameObject::Clone() const
+{
+	std::shared_ptr<GameObject> clone = MakePooled<GameObject>();
+	clone->myName = myName;
+	clone->myIsActive = myIsActive;
+	clone->myIsStatic = myIsStatic;
+	clone->myComponents.reserve(myComponents.size());
+	clone->myComponentTypeIDs.reserve(myComponentTypeIDs.size());
+
+	for (size_t i = 0; i < myComponents.size(); i++)
+	{
+		std::shared_ptr<Component> component = ComponentTypeRegistry::Clone(myComponentTypeIDs[i], *myComponents[i]);
+		if (!component) continue;
+
+		component->gameObject = clone.get();
+		clone->myComponents.emplace_back(std::move(component));
+		clone->myComponentTypeIDs.emplace_back(myComponentTypeIDs[i]);
+	}
+
+	clone->OnComponentsChanged();
+
+	for (auto& component : clone->myComponents)
+	{
+		component->Start();
+	}
+
+	return clone;
+}
+
+const bool GameObject::IsCloneable() const
+{
+	for (const ComponentTypeID typeID : myComponentTypeIDs)
+	{
+		if (!ComponentTypeRegistry::IsCloneable(typeID)) return false;
+	}
+
+	return true;
+}
+
 void GameObject::SetStatic(bool aStatic)
 {
+	if (myIsStatic == aStatic) return;
+
 	myIsStatic = aStatic;
+
+	if (myScene)
+	{
+		myScene->OnGameObjectStaticChanged(this);
+	}
+}
+
+const bool GameObject::NeedsUpdate()
+{
+	if (!myIsStatic) return true;
+
+	RefreshComponentTable();
+	return myHasStaticUpdates;
+}
+
+void GameObject::SetName(const std::string& aName)
+{
+	const std::string oldName = myName;
+	myName = aName;
+
+	if (myScene)
+	{
+		myScene->OnGameObjectNameChanged(this, oldName);
+	}
+}
+
+void GameObject::SetID(const unsigned aID)
+{
+	const unsigned oldID = myID;
+	myID = aID;
+
+	if (myScene)
+	{
+		myScene->OnGameObjectIDChanged(this, oldID);
+	}
+}
+
+void GameObject::SetNetworkID(const unsigned aNetworkID)
+{
+	const unsigned oldNetworkID = myNetworkID;
+	myNetworkID = aNetworkID;
+
+	if (myScene)
+	{
+		myScene->OnGameObjectNetworkIDChanged(this, oldNetworkID);
+	}
+}
+
+const bool GameObject::OwnsComponent(const Component* aComponent) const
+{
+	for (const std::shared_ptr<Component>& component : myComponents)
+	{
+		if (component.get() == aComponent) return true;
+	}
+
+	return false;
+}
+
+const ComponentMask& GameObject::GetComponentMask()
+{
+	RefreshComponentTable();
+	return myComponentMask;
+}
+
+void GameObject::OnComponentsChanged()
+{
+	myComponentTableIsDirty = true;
+
+	if (myScene)
+	{
+		myScene->RefreshArchetype(this);
+
+		if (myIsStatic)
+		{
+			myScene->OnGameObjectStaticChanged(this);
+		}
+	}
+}
+
+void GameObject::OnTransformMoved()
+{
+	if (myScene)
+	{
+		myScene->OnTransformMoved();
+	}
+}
+
+void GameObject::RebuildComponentTable()
+{
+	const unsigned generation = ComponentTypeRegistry::GetGeneration();
+
+	myComponentMask.reset();
+	myComponentSlots.fill(InvalidComponentSlot);
+	myHasStaticUpdates = false;
+
+	for (size_t i = 0; i < myComponents.size(); i++)
+	{
+		myHasStaticUpdates |= myComponents[i]->GetUpdatesWhenStatic();
+
+		const ComponentMask& typeMask = ComponentTypeRegistry::GetTypeMask(myComponentTypeIDs[i], myComponents[i].get());
+
+		for (ComponentTypeID id = 0; id < generation; id++)
+		{
+			if (typeMask.test(id) && !myComponentMask.test(id))
+			{
+				myComponentSlots[id] = static_cast<uint8_t>(i);
+			}
+		}
+
+		myComponentMask |= typeMask;
+	}
+
+	myComponentTableGeneration = generation;
+	myComponentTableIsDirty = false;
+}
+
+Component* GameObject::FindComponentByTypeID(const ComponentTypeID aTypeID)
+{
+	RefreshComponentTable();
+
+	const uint8_t slot = myComponentSlots[aTypeID];
+	return slot == InvalidComponentSlot ? nullptr : myComponents[slot].get();
 }
 
 void GameObject::SendEvent(const GameObjectEvent aEvent)
@@ -2,26 +2,43 @@
 #include "EngineDefines.h"
 
 #include "Component.h"
+#include "ComponentType.h"
+#include "EntityHandle.h"
+#include "ObjectPool.h"
 #include "GameObjectEvent.h"
 
+class Scene;
+class StaticSceneIndex;
+struct Archetype;
+
 class GameObject final
 {
 public:
+    friend class Scene;
+    friend class StaticSceneIndex;
+    friend class Transform;
+
     GameObject();
     virtual ~GameObject();
     void Update();
     void SetActive(bool aActive);
     bool GetActive() const { return myIsActive; }
+    // Static objects promise not to move. Their world bounds are worked out once and kept in the scene's static index,
+    // which culling and collision use instead of testing them one by one, and they skip component updates they don't need.
+    // To move one anyway, make it non-static first.
     void SetStatic(bool aStatic);
     bool GetStatic() const { return myIsStatic; }
 
-    void SetName(const std::string& aName) { myName = aName; }
+    void SetName(const std::string& aName);
     const std::string& GetName() const { return myName; }
 
-    void SetID(const unsigned aID) { myID = aID; }
+    void SetID(const unsigned aID);
     const unsigned GetID() const { return myID; }
-    void SetNetworkID(const unsigned aNetworkID) { myNetworkID = aNetworkID; }
+    // A network ID of 0 means the object is not replicated.
+    void SetNetworkID(const unsigned aNetworkID);
     const unsigned GetNetworkID() const { return myNetworkID; }
+    // Handle to this object in the scene it's instantiated in, invalid until it has been instantiated.
+    const EntityHandle GetHandle() const { return myHandle; }
 
     // COMPONENTS
     template <typename T, typename... Args>
@@ -35,6 +52,22 @@ public:
 
     template <typename T>
     const std::vector<std::shared_ptr<T>> GetComponents();
+
+    template <typename T>
+    const bool HasComponent();
+    // Whether aComponent is one of this object's components. Only its address is compared, so it's safe to ask about a
+    // component that might have been removed and freed since.
+    const bool OwnsComponent(const Component* aComponent) const;
+
+    // Mask of every registered component type this object has a component of (including base types).
+    const ComponentMask& GetComponentMask();
+
+    // Returns a new object with the same name, flags and copies of the components, made with the components' copy
+    // constructors so shared assets are pointed at rather than loaded again. Components of types that can't be copied
+    // (see ComponentTypeRegistry::IsCloneable) are left out. The copy isn't in a scene or a transform hierarchy.
+    std::shared_ptr<GameObject> Clone() const;
+    // False if Clone would leave out any of this object's components.
+    const bool IsCloneable() const;
     // --
 
     // INTERNAL EVENT HANDLER
@@ -45,25 +78,61 @@ public:
     // --
 
 private:
+    static constexpr uint8_t InvalidComponentSlot = UINT8_MAX;
+
+    // Used by the scene's parallel update instead of Update. UpdateThreadSafe runs on a worker thread, UpdateMainThread
+    // afterwards on the main thread, so thread-safe components update before the rest of the object's components.
+    void UpdateThreadSafe();
+    void UpdateMainThread();
+    void UpdateComponents(const ComponentUpdateThreading aThreading);
+    // False for static objects where no component has anything to do in Update.
+    const bool NeedsUpdate();
+
+    void OnComponentsChanged();
+    void OnTransformMoved();
+    void RefreshComponentTable();
+    void RebuildComponentTable();
+    Component* FindComponentByTypeID(const ComponentTypeID aTypeID);
 
     std::vector<std::shared_ptr<Component>> myComponents;
+    std::vector<ComponentTypeID> myComponentTypeIDs;
+
+    // Per component type ID, the index in myComponents of the first component of that type (or InvalidComponentSlot).
+    std::array<uint8_t, MAX_COMPONENT_TYPES> myComponentSlots;
+    ComponentMask myComponentMask;
+    unsigned myComponentTableGeneration = 0;
+    bool myComponentTableIsDirty = true;
+    bool myHasStaticUpdates = true;
+
+    // Set by the scene this object is instantiated in.
+    Scene* myScene = nullptr;
+    Archetype* myArchetype = nullptr;
+    EntityHandle myHandle;
+    size_t myArchetypeRow = 0;
+    // Index of this object's entry in the scene's static index, UINT32_MAX while it isn't in it.
+    uint32_t myStaticIndex = UINT32_MAX;
+    bool myIsPendingDestroy = false;
+
     bool myIsActive = true;
     bool myIsStatic = false;
     float myTimeAlive = 0;
 
     std::string myName;
-    unsigned myID;
-    unsigned myNetworkID;
+    unsigned myID = 0;
+    unsigned myNetworkID = 0;
 };
 
 template<class T, typename... Args>
 const std::shared_ptr<T> GameObject::AddComponent(Args&&... args)
 {
-    std::shared_ptr<Component> newComponent = myComponents.emplace_back(std::make_shared<T>(args...));
+    std::shared_ptr<Component> newComponent = myComponents.emplace_back(MakePooled<T>(args...));
 
     if (newComponent.get())
     {
+        assert(myComponents.size() < InvalidComponentSlot && "Too many components on one game object!");
+        myComponentTypeIDs.emplace_back(GetComponentTypeID<T>());
         newComponent->gameObject = this;
+        OnComponentsChanged();
         newComponent->Start();
 
         return std::dynamic_pointer_cast<T>(newComponent);
@@ -83,6 +152,8 @@ inline const bool GameObject::RemoveComponent()
             if (comp == myComponents[i])
             {
                 myComponents.erase(myComponents.begin() + i);
+                myComponentTypeIDs.erase(myComponentTypeIDs.begin() + i);
+                OnComponentsChanged();
                 return true;
             }
         }
@@ -94,16 +165,16 @@ inline const bool GameObject::RemoveComponent()
 template<typename T>
 inline const std::shared_ptr<T> GameObject::GetComponent()
 {
-    for (auto& comp : myComponents)
+    const ComponentTypeID typeID = GetComponentTypeID<T>();
+    RefreshComponentTable();
+
+    const uint8_t slot = myComponentSlots[typeID];
+    if (slot == InvalidComponentSlot)
     {
-        std::shared_ptr<T> castedComp = std::dynamic_pointer_cast<T>(comp);
-        if (castedComp.get())
-        {
-            return castedComp;
-        }
+        return std::shared_ptr<T>();
     }
 
-    return std::shared_ptr<T>();
+    return std::static_pointer_cast<T>(myComponents[slot]);
 }
 
 template<typename T>
@@ -111,14 +182,38 @@ inline const std::vector<std::shared_ptr<T>> GameObject::GetComponents()
 {
     std::vector<std::shared_ptr<T>> componentVector;
 
-    for (auto& comp : myComponents)
+    const ComponentTypeID typeID = GetComponentTypeID<T>();
+    RefreshComponentTable();
+
+    if (!myComponentMask.test(typeID))
     {
-        std::shared_ptr<T> castedComp = std::dynamic_pointer_cast<T>(comp);
-        if (castedComp.get())
+        return componentVector;
+    }
+
+    for (size_t i = myComponentSlots[typeID]; i < myComponents.size(); i++)
+    {
+        if (ComponentTypeRegistry::GetTypeMask(myComponentTypeIDs[i], myComponents[i].get()).test(typeID))
         {
-            componentVector.emplace_back(castedComp);
+            componentVector.emplace_back(std::static_pointer_cast<T>(myComponents[i]));
         }
     }
 
     return componentVector;
 }
+
+template<typename T>
+inline const bool GameObject::HasComponent()
+{
+    const ComponentTypeID typeID = GetComponentTypeID<T>();
+    RefreshComponentTable();
+
+    return myComponentMask.test(typeID);
+}
+
+inline void GameObject::RefreshComponentTable()
+{
+    if (myComponentTableIsDirty || myComponentTableGeneration != ComponentTypeRegistry::GetGeneration())
+    {
+        RebuildComponentTable();
+    }
+}
@@ -0,0 +1,137 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <mutex>
+#include <atomic>
+
+// Allocation counters summed over every object pool.
+struct ObjectPoolStats
+{
+    // Heap allocations made by pools, one per chunk.
+    static inline std::atomic<size_t> heapAllocations = 0;
+    // Objects handed out by pools, including reused slots.
+    static inline std::atomic<size_t> poolAllocations = 0;
+    static inline std::atomic<size_t> liveObjects = 0;
+};
+
+// Slab allocator for objects of a single type. Memory is taken from the heap in chunks of ObjectsPerChunk slots and freed
+// slots go on a free list, so objects of the same type sit next to each other and allocating stops touching the heap
+// once the pool has grown to its working size.
+template <typename T>
+class ObjectPool
+{
+public:
+    static constexpr size_t ObjectsPerChunk = 256;
+
+    static ObjectPool& Get()
+    {
+        static ObjectPool instance;
+        return instance;
+    }
+
+    T* Allocate();
+    void Free(T* aObject);
+
+    size_t GetChunkCount() const { return myChunks.size(); }
+    size_t GetLiveObjectCount() const { return myLiveObjectCount; }
+
+private:
+    ObjectPool() = default;
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    union Slot
+    {
+        Slot* nextFree;
+        alignas(T) std::byte storage[sizeof(T)];
+    };
+
+    std::vector<std::unique_ptr<Slot[]>> myChunks;
+    Slot* myFreeList = nullptr;
+    size_t myLiveObjectCount = 0;
+    std::mutex myMutex;
+};
+
+template<typename T>
+inline T* ObjectPool<T>::Allocate()
+{
+    std::scoped_lock lock(myMutex);
+
+    if (!myFreeList)
+    {
+        std::unique_ptr<Slot[]>& chunk = myChunks.emplace_back(std::make_unique<Slot[]>(ObjectsPerChunk));
+        for (size_t i = ObjectsPerChunk; i > 0; i--)
+        {
+            chunk[i - 1].nextFree = myFreeList;
+            myFreeList = &chunk[i - 1];
+        }
+
+        ObjectPoolStats::heapAllocations++;
+    }
+
+    Slot* slot = myFreeList;
+    myFreeList = slot->nextFree;
+    myLiveObjectCount++;
+
+    ObjectPoolStats::poolAllocations++;
+    ObjectPoolStats::liveObjects++;
+    return reinterpret_cast<T*>(slot->storage);
+}
+
+template<typename T>
+inline void ObjectPool<T>::Free(T* aObject)
+{
+    std::scoped_lock lock(myMutex);
+
+    Slot* slot = reinterpret_cast<Slot*>(aObject);
+    slot->nextFree = myFreeList;
+    myFreeList = slot;
+    myLiveObjectCount--;
+
+    ObjectPoolStats::liveObjects--;
+}
+
+// Standard allocator on top of ObjectPool. std::allocate_shared rebinds it to its combined control block and object type,
+// so every pooled type gets its own pool and the shared_ptr's bookkeeping lives in the same slot as the object.
+template <typename T>
+class PoolAllocator
+{
+public:
+    using value_type = T;
+
+    PoolAllocator() = default;
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>&) {}
+
+    T* allocate(size_t aCount)
+    {
+        if (aCount != 1)
+        {
+            return static_cast<T*>(::operator new(aCount * sizeof(T)));
+        }
+
+        return ObjectPool<T>::Get().Allocate();
+    }
+
+    void deallocate(T* aObject, size_t aCount)
+    {
+        if (aCount != 1)
+        {
+            ::operator delete(aObject);
+            return;
+        }
+
+        ObjectPool<T>::Get().Free(aObject);
+    }
+
+    template <typename U>
+    bool operator==(const PoolAllocator<U>&) const { return true; }
+};
+
+// Pooled replacement for std::make_shared, use it for game objects and components.
+template <typename T, typename... Args>
+std::shared_ptr<T> MakePooled(Args&&... aArgs)
+{
+    return std::allocate_shared<T>(PoolAllocator<T>(), std::forward<Args>(aArgs)...);
+}
@@ -0,0 +1,154 @@
+#include "Enginepch.h"
+
+#include "PrefabRegistry.h"
+#include "Scene.h"
+#include "ComponentSystem/Components/Transform.h"
+
+PrefabID PrefabRegistry::Register(const std::string& aName, std::shared_ptr<GameObject> aRoot, const std::vector<std::shared_ptr<GameObject>>& aDescendants)
+{
+	if (!aRoot)
+	{
+		LOG(LogComponentSystem, Warning, "Tried to register prefab {} without a game object!", aName);
+		return InvalidID;
+	}
+
+	Prefab prefab;
+	prefab.name = aName;
+	prefab.objects.emplace_back(aRoot);
+	prefab.parents.emplace_back(-1);
+
+	// Walk the template's hierarchy breadth first so every object comes after its parent.
+	for (size_t index = 0; index < prefab.objects.size(); index++)
+	{
+		std::shared_ptr<Transform> transform = prefab.objects[index]->GetComponent<Transform>();
+		if (!transform) continue;
+
+		for (Transform* child : transform->GetChildren())
+		{
+			auto it = std::find_if(aDescendants.begin(), aDescendants.end(), [child](const std::shared_ptr<GameObject>& aObject) { return aObject.get() == child->gameObject; });
+			if (it == aDescendants.end())
+			{
+				LOG(LogComponentSystem, Warning, "Prefab {} has child {} that wasn't passed in with it, it's left out.", aName, child->gameObject->GetName());
+				continue;
+			}
+
+			prefab.objects.emplace_back(*it);
+			prefab.parents.emplace_back(static_cast<int>(index));
+		}
+	}
+
+	for (auto& object : prefab.objects)
+	{
+		if (!object->IsCloneable())
+		{
+			LOG(LogComponentSystem, Warning, "Prefab {} has components on {} that can't be cloned, spawned objects won't have them.", aName, object->GetName());
+		}
+	}
+
+	if (auto it = myPrefabIDs.find(aName); it != myPrefabIDs.end())
+	{
+		myPrefabs[it->second] = std::move(prefab);
+		return it->second;
+	}
+
+	const PrefabID id = static_cast<PrefabID>(myPrefabs.size());
+	myPrefabs.emplace_back(std::move(prefab));
+	myPrefabIDs.emplace(aName, id);
+	return id;
+}
+
+const PrefabID PrefabRegistry::GetPrefabID(const std::string& aName) const
+{
+	auto it = myPrefabIDs.find(aName);
+	return it != myPrefabIDs.end() ? it->second : InvalidID;
+}
+
+std::shared_ptr<GameObject> PrefabRegistry::GetTemplate(const PrefabID aID) const
+{
+	return IsValid(aID) ? myPrefabs[aID].objects.front() : nullptr;
+}
+
+EntityHandle PrefabRegistry::Instantiate(Scene& aScene, const PrefabID aID, const Math::Vector3f& aPosition, const Math::Vector3f& aRotation)
+{
+	if (!IsValid(aID))
+	{
+		LOG(LogComponentSystem, Warning, "Tried to instantiate a prefab that doesn't exist!");
+		return EntityHandle();
+	}
+
+	return Spawn(aScene, aID, aPosition, &aRotation);
+}
+
+void PrefabRegistry::InstantiateMany(Scene& aScene, const PrefabID aID, const std::vector<Math::Vector3f>& aPositions, std::vector<EntityHandle>* outHandles)
+{
+	PIXScopedEvent(PIX_COLOR_INDEX(4), "Instantiate Prefabs");
+
+	if (!IsValid(aID))
+	{
+		LOG(LogComponentSystem, Warning, "Tried to instantiate a prefab that doesn't exist!");
+		return;
+	}
+
+	aScene.Reserve(aPositions.size() * myPrefabs[aID].objects.size());
+
+	if (outHandles)
+	{
+		outHandles->reserve(outHandles->size() + aPositions.size());
+	}
+
+	for (const Math::Vector3f& position : aPositions)
+	{
+		const EntityHandle handle = Spawn(aScene, aID, position, nullptr);
+		if (outHandles)
+		{
+			outHandles->emplace_back(handle);
+		}
+	}
+}
+
+void PrefabRegistry::Clear()
+{
+	myPrefabs.clear();
+	myPrefabIDs.clear();
+}
+
+EntityHandle PrefabRegistry::Spawn(Scene& aScene, const PrefabID aID, const Math::Vector3f& aPosition, const Math::Vector3f* aRotation)
+{
+	// Cloning starts the components, which may spawn or register prefabs themselves. That can replace this prefab or move
+	// it in myPrefabs, so its objects are held on to for the spawn and the clones are kept in a vector of its own.
+	const std::vector<std::shared_ptr<GameObject>> objects = myPrefabs[aID].objects;
+	const std::vector<int> parents = myPrefabs[aID].parents;
+
+	std::vector<std::shared_ptr<GameObject>> spawnedObjects;
+	spawnedObjects.reserve(objects.size());
+	for (auto& object : objects)
+	{
+		spawnedObjects.emplace_back(object->Clone());
+	}
+
+	// Place the root before attaching the children, so they're only brought up to date once.
+	std::shared_ptr<GameObject>& root = spawnedObjects.front();
+	if (std::shared_ptr<Transform> transform = root->GetComponent<Transform>())
+	{
+		transform->SetTranslation(aPosition);
+		if (aRotation)
+		{
+			transform->SetRotation(*aRotation);
+		}
+	}
+
+	for (size_t i = 1; i < spawnedObjects.size(); i++)
+	{
+		std::shared_ptr<Transform> parentTransform = spawnedObjects[parents[i]]->GetComponent<Transform>();
+		std::shared_ptr<Transform> transform = spawnedObjects[i]->GetComponent<Transform>();
+		parentTransform->AddChild(transform.get());
+	}
+
+	// Children go in first, the same order the scene loader instantiates a hierarchy in.
+	for (size_t i = spawnedObjects.size() - 1; i > 0; i--)
+	{
+		aScene.Instantiate(spawnedObjects[i]);
+	}
+
+	return aScene.Instantiate(root);
+}
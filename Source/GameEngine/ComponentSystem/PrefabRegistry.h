@@ -0,0 +1,49 @@
+#pragma once
+#include "GameObject.h"
+#include "EntityHandle.h"
+#include "Math/Vector.hpp"
+
+class Scene;
+
+using PrefabID = uint32_t;
+
+// Game object templates that are set up once and spawned by cloning them (see GameObject::Clone), instead of building
+// every object from JSON and looking its components and assets up by name. Templates are never in a scene themselves.
+class PrefabRegistry
+{
+public:
+	static constexpr PrefabID InvalidID = UINT32_MAX;
+
+	// Registers aRoot as a template together with aDescendants, the objects attached below it with Transform::AddChild.
+	// Registering a name again replaces that template, objects spawned from the old one are left alone.
+	PrefabID Register(const std::string& aName, std::shared_ptr<GameObject> aRoot, const std::vector<std::shared_ptr<GameObject>>& aDescendants = {});
+	// Resolve the ID once and spawn through it, InvalidID if there's no prefab with that name.
+	const PrefabID GetPrefabID(const std::string& aName) const;
+	const bool IsValid(const PrefabID aID) const { return aID < myPrefabs.size(); }
+	// Changes to the template apply to objects spawned afterwards.
+	std::shared_ptr<GameObject> GetTemplate(const PrefabID aID) const;
+	const size_t GetPrefabAmount() const { return myPrefabs.size(); }
+
+	// Spawns the prefab into aScene with its root at aPosition and aRotation (in degrees), keeping the template's scale.
+	// Returns the handle of the spawned root, or an invalid handle if aID isn't a prefab.
+	EntityHandle Instantiate(Scene& aScene, const PrefabID aID, const Math::Vector3f& aPosition, const Math::Vector3f& aRotation = { 0, 0, 0 });
+	// Spawns one copy of the prefab per position, with the template's rotation. Space in the scene is reserved up front.
+	// The roots' handles are appended to outHandles if it's given.
+	void InstantiateMany(Scene& aScene, const PrefabID aID, const std::vector<Math::Vector3f>& aPositions, std::vector<EntityHandle>* outHandles = nullptr);
+
+	void Clear();
+private:
+	struct Prefab
+	{
+		std::string name;
+		// The root first, then the rest of its hierarchy with every object after its parent.
+		std::vector<std::shared_ptr<GameObject>> objects;
+		// Per object, the index in objects of the object its transform is attached to, -1 for the root.
+		std::vector<int> parents;
+	};
+
+	EntityHandle Spawn(Scene& aScene, const PrefabID aID, const Math::Vector3f& aPosition, const Math::Vector3f* aRotation);
+
+	std::vector<Prefab> myPrefabs;
+	std::unordered_map<std::string, PrefabID> myPrefabIDs;
+};
@@ -1,10 +1,13 @@
 #include "Enginepch.h"
 
 #include "Scene.h"
+#ifndef FRAGILE_HEADLESS
 #include "GraphicsEngine.h"
 #include "Objects/Sprite.h"
+#endif
 #include "ComponentSystem/GameObject.h"
 #include "ComponentSystem/Components/Transform.h"
+#ifndef FRAGILE_HEADLESS
 #include "ComponentSystem/Components/Graphics/Model.h"
 #include "ComponentSystem/Components/Graphics/AnimatedModel.h"
 #include "ComponentSystem/Components/Graphics/DebugModel.h"
@@ -15,9 +18,13 @@
 #include "ComponentSystem/Components/Lights/SpotLight.h"
 
 #include "RenderAssembler/RenderAssembler.h"
+#endif
 #include "Engine.h"
+#include "JobSystem/JobSystem.h"
 #include "DebugDrawer/DebugDrawer.h"
+#ifndef FRAGILE_HEADLESS
 #include "AssetManager.h"
+#endif
 
 #include "Math/Vector.hpp"
 
@@ -32,7 +39,24 @@ Scene::~Scene()
 	myMainCamera = nullptr;
 	myPointLights.clear();
 	mySpotLights.clear();
+
+	for (auto& gameObject : myGameObjects)
+	{
+		gameObject->myScene = nullptr;
+		gameObject->myArchetype = nullptr;
+		gameObject->myHandle = EntityHandle();
+		gameObject->myStaticIndex = StaticSceneIndex::InvalidIndex;
+	}
+
 	myGameObjects.clear();
+	myGameObjectsByName.clear();
+	myGameObjectsByID.clear();
+	myGameObjectsByNetworkID.clear();
+	myEntitySlots.clear();
+	myFreeEntitySlots.clear();
+	myArchetypeLookup.clear();
+	myArchetypes.clear();
+	myStaticIndex.Clear();
 }
 
 void Scene::Update()
@@ -40,37 +64,109 @@ void Scene::Update()
 	PIXScopedEvent(PIX_COLOR_INDEX(7), "Update GameObjects in Scene");
 	myActiveGameObjectAmount = 0;
 
-	for (auto& gameObject : myGameObjectsToDestroy)
+	DestroyQueuedGameObjects();
+
+	if (myStaticIndexIsDirty)
 	{
-		if (auto goTransform = gameObject->GetComponent<Transform>())
+		myStaticIndex.Build(myGameObjects);
+		myStaticIndexIsDirty = false;
+		OnObjectsChanged();
+	}
+
+	if (myUpdateMode == SceneUpdateMode::Parallel && Engine::Get().GetJobSystem().GetWorkerCount() > 0)
+	{
+		UpdateParallel();
+	}
+	else
+	{
+		UpdateSerial();
+	}
+}
+
+void Scene::UpdateSerial()
+{
+	for (auto& gameObject : myGameObjects)
+	{
+		if (gameObject->GetActive())
 		{
-			DestroyHierarchy(goTransform.get());
+			if (gameObject->NeedsUpdate())
+			{
+				gameObject->Update();
+			}
+
+			myActiveGameObjectAmount++;
 		}
-		else
+	}
+}
+
+void Scene::UpdateParallel()
+{
+	myParallelGameObjects.clear();
+
+	for (auto& gameObject : myGameObjects)
+	{
+		if (!gameObject->GetActive()) continue;
+
+		// Rebuild any stale component tables up front so workers never have to.
+		gameObject->RefreshComponentTable();
+
+		// Moving an object in a transform hierarchy flags its relatives too, and resolving a world matrix reads the parents,
+		// so those stay on the main thread.
+		std::shared_ptr<Transform> transform = gameObject->GetComponent<Transform>();
+		if (gameObject->NeedsUpdate() && (!transform || !transform->IsInHierarchy()))
 		{
-			DestroyInternal(gameObject.get());
+			myParallelGameObjects.emplace_back(gameObject.get());
+		}
+		else if (transform)
+		{
+			// World matrices are cached the first time they're read. Resolving the ones that don't move on a worker thread
+			// here leaves several workers looking at the same object only reading it.
+			transform->GetWorldMatrix();
 		}
 	}
 
-	myGameObjectsToDestroy.clear();
+	{
+		PIXScopedEvent(PIX_COLOR_INDEX(7), "Update Thread-Safe Components");
+		Engine::Get().GetJobSystem().ParallelFor(myParallelGameObjects.size(), ParallelUpdateBatchSize, [this](size_t aBegin, size_t aEnd)
+			{
+				for (size_t i = aBegin; i < aEnd; i++)
+				{
+					myParallelGameObjects[i]->UpdateThreadSafe();
+				}
+			});
+	}
 
+	PIXScopedEvent(PIX_COLOR_INDEX(7), "Update Main Thread Components");
+	size_t parallelIndex = 0;
 	for (auto& gameObject : myGameObjects)
 	{
-		if (gameObject->GetActive())
+		// myParallelGameObjects is in scene order, so this tells whether the object already ran its thread-safe components.
+		const bool hasUpdatedThreadSafe = parallelIndex < myParallelGameObjects.size() && myParallelGameObjects[parallelIndex] == gameObject.get();
+		if (hasUpdatedThreadSafe)
+		{
+			parallelIndex++;
+		}
+
+		if (!gameObject->GetActive()) continue;
+
+		if (hasUpdatedThreadSafe)
+		{
+			gameObject->UpdateMainThread();
+		}
+		else if (gameObject->NeedsUpdate())
 		{
 			gameObject->Update();
-			myActiveGameObjectAmount++;
 		}
-	}
 
-	SortGameObjects();
+		myActiveGameObjectAmount++;
+	}
 }
 
 std::shared_ptr<GameObject> Scene::FindGameObjectByName(const std::string& aName)
 {
-	if (auto go = std::find_if(myGameObjects.begin(), myGameObjects.end(), [aName](const std::shared_ptr<GameObject>& object) { return object->GetName() == aName; }); *go != nullptr)
+	if (auto it = myGameObjectsByName.find(aName); it != myGameObjectsByName.end() && !it->second.empty())
 	{
-		return *go;
+		return it->second.front();
 	}
 
 	LOG(LogScene, Warning, "Could not find game object with name {} in the scene!", aName);
@@ -79,9 +175,9 @@ std::shared_ptr<GameObject> Scene::FindGameObjectByName(const std::string& aName
 
 std::shared_ptr<GameObject> Scene::FindGameObjectByID(const unsigned aID)
 {
-	if (auto go = std::find_if(myGameObjects.begin(), myGameObjects.end(), [aID](const std::shared_ptr<GameObject>& object) { return object->GetID() == aID; }); go != myGameObjects.end() && *go != nullptr)
+	if (auto it = myGameObjectsByID.find(aID); it != myGameObjectsByID.end())
 	{
-		return *go;
+		return it->second;
 	}
 
 	LOG(LogScene, Warning, "Could not find game object with ID {} in the scene!", aID);
@@ -90,21 +186,39 @@ std::shared_ptr<GameObject> Scene::FindGameObjectByID(const unsigned aID)
 
 std::shared_ptr<GameObject> Scene::FindGameObjectByNetworkID(const unsigned aNetworkID)
 {
-	if (auto go = std::find_if(myGameObjects.begin(), myGameObjects.end(), [aNetworkID](const std::shared_ptr<GameObject>& object) { return object->GetNetworkID() == aNetworkID; }); go != myGameObjects.end() && *go != nullptr)
+	if (auto it = myGameObjectsByNetworkID.find(aNetworkID); it != myGameObjectsByNetworkID.end())
 	{
-		return *go;
+		return it->second;
 	}
 
 	LOG(LogScene, Warning, "Could not find game object with network ID {} in the scene!", aNetworkID);
 	return std::shared_ptr<GameObject>();
 }
 
-void Scene::Instantiate(std::shared_ptr<GameObject> aGameObject)
+void Scene::Reserve(const size_t aAmount)
+{
+	myGameObjects.reserve(myGameObjects.size() + aAmount);
+	myGameObjectsByID.reserve(myGameObjectsByID.size() + aAmount);
+
+	if (aAmount > myFreeEntitySlots.size())
+	{
+		myEntitySlots.reserve(myEntitySlots.size() + aAmount - myFreeEntitySlots.size());
+	}
+}
+
+EntityHandle Scene::Instantiate(std::shared_ptr<GameObject> aGameObject)
 {
 	if (!aGameObject)
 	{
 		LOG(LogScene, Warning, "Tried to instantiate a non-existing gameobject!");
-		return;
+		return EntityHandle();
+	}
+
+	// A second archetype row and entity slot for the same object would be left behind dangling once it's destroyed.
+	if (aGameObject->myScene)
+	{
+		LOG(LogScene, Warning, "Tried to instantiate GameObject {}, which is already in a scene!", aGameObject->GetName());
+		return aGameObject->myScene == this ? aGameObject->myHandle : EntityHandle();
 	}
 
 	UpdateBoundingBox(aGameObject);
@@ -113,33 +227,45 @@ void Scene::Instantiate(std::shared_ptr<GameObject> aGameObject)
 	myCurrentGameObjectID++;
 	myGameObjects.emplace_back(aGameObject);
 
+	aGameObject->myScene = this;
+	aGameObject->myIsPendingDestroy = false;
+	aGameObject->myHandle = AllocateHandle(aGameObject);
+	AddToArchetype(aGameObject.get());
+	AddToIndices(aGameObject);
+
+	if (aGameObject->GetStatic())
+	{
+		OnGameObjectStaticChanged(aGameObject.get());
+	}
+
+#ifndef FRAGILE_HEADLESS
 	// Temp
-	if (aGameObject->GetComponent<AmbientLight>())
+	if (aGameObject->HasComponent<AmbientLight>())
 	{
 		myAmbientLight = aGameObject;
 	}
-	else if (aGameObject->GetComponent<DirectionalLight>())
+	else if (aGameObject->HasComponent<DirectionalLight>())
 	{
 		myDirectionalLight = aGameObject;
 #ifdef _DEBUG
 		myDirectionalLight->AddComponent<DebugModel>(AssetManager::Get().GetAsset<MeshAsset>("EngineAssets/Models/SM_DirectionalLightGizmo.fbx")->mesh);
 #endif
 	}
-	else if (aGameObject->GetComponent<PointLight>())
+	else if (aGameObject->HasComponent<PointLight>())
 	{
 #ifdef _DEBUG
 		aGameObject->AddComponent<DebugModel>(AssetManager::Get().GetAsset<MeshAsset>("EngineAssets/Models/SM_PointLightGizmo.fbx")->mesh);
 #endif
 		myPointLights.emplace_back(aGameObject);
 	}
-	else if (aGameObject->GetComponent<SpotLight>())
+	else if (aGameObject->HasComponent<SpotLight>())
 	{
 #ifdef _DEBUG
 		aGameObject->AddComponent<DebugModel>(AssetManager::Get().GetAsset<MeshAsset>("EngineAssets/Models/SM_SpotLightGizmo.fbx")->mesh);
 #endif
 		mySpotLights.emplace_back(aGameObject);
 	}
-	else if (aGameObject->GetComponent<Camera>())
+	else if (aGameObject->HasComponent<Camera>())
 	{
 		if (aGameObject->GetName() == "MainCamera")
 		{
@@ -147,8 +273,10 @@ void Scene::Instantiate(std::shared_ptr<GameObject> aGameObject)
 			Engine::Get().GetAudioEngine().SetListener(aGameObject);
 		}
 	}
+#endif
 
 	LOG(LogScene, Log, "Created GameObject {}!", aGameObject->GetName());
+	return aGameObject->myHandle;
 }
 
 void Scene::Destroy(std::shared_ptr<GameObject> aGameObject)
@@ -159,99 +287,88 @@ void Scene::Destroy(std::shared_ptr<GameObject> aGameObject)
 		return;
 	}
 
-	for (size_t i = 0; i < myGameObjects.size(); i++)
+	if (aGameObject->myScene != this)
 	{
-		if (myGameObjects[i].get() == aGameObject.get())
-		{
-			myGameObjectsToDestroy.push_back(aGameObject);
-			return;
-		}
+		LOG(LogScene, Warning, "Could not find GameObject {} in scene!", aGameObject->GetName());
+		return;
 	}
 
-	LOG(LogScene, Warning, "Could not find GameObject {} in scene!", aGameObject->GetName());
+	if (aGameObject->myIsPendingDestroy) return;
+
+	aGameObject->myIsPendingDestroy = true;
+	myGameObjectsToDestroy.push_back(aGameObject);
 }
 
-void Scene::SortGameObjects()
+void Scene::Destroy(const EntityHandle aHandle)
 {
-	PIXScopedEvent(PIX_COLOR_INDEX(8), "Sort GameObjects in Scene");
-	Math::Vector3f camPos = myMainCamera->GetComponent<Transform>()->GetTranslation(true);
+	GameObject* gameObject = Resolve(aHandle);
+	if (!gameObject)
+	{
+		LOG(LogScene, Warning, "Tried to destroy a game object through an invalid or stale handle!");
+		return;
+	}
 
-	std::stable_sort(myGameObjects.begin(), myGameObjects.end(), [this, camPos](const std::shared_ptr<GameObject> lhs, const std::shared_ptr<GameObject> rhs)
-		{
-			std::shared_ptr<Model> model1 = lhs->GetComponent<Model>();
-			std::shared_ptr<Model> model2 = rhs->GetComponent<Model>();
-			std::shared_ptr<AnimatedModel> animModel1 = lhs->GetComponent<AnimatedModel>();
-			std::shared_ptr<AnimatedModel> animModel2 = rhs->GetComponent<AnimatedModel>();
+	Destroy(GetOwningPointer(gameObject));
+}
 
-			bool hasBlendState1 = false;
-			bool hasBlendState2 = false;
+GameObject* Scene::Resolve(const EntityHandle aHandle) const
+{
+	if (aHandle.index >= myEntitySlots.size()) return nullptr;
 
-			if (model1)
-			{
-				hasBlendState1 = model1->GetMaterialOnSlot(0)->GetPSO()->BlendState != nullptr;
-			}
-			else if (animModel1)
-			{
-				hasBlendState1 = animModel1->GetMaterialOnSlot(0)->GetPSO()->BlendState != nullptr;
-			}
+	const EntitySlot& slot = myEntitySlots[aHandle.index];
+	return slot.generation == aHandle.generation ? slot.gameObject.get() : nullptr;
+}
 
-			if (model2)
-			{
-				hasBlendState2 = model2->GetMaterialOnSlot(0)->GetPSO()->BlendState != nullptr;
-			}
-			else if (animModel2)
-			{
-				hasBlendState2 = animModel2->GetMaterialOnSlot(0)->GetPSO()->BlendState != nullptr;
-			}
+void Scene::DestroyQueuedGameObjects()
+{
+	if (myGameObjectsToDestroy.empty()) return;
 
-			if (hasBlendState1 && !hasBlendState2)
-			{
-				return false;
-			}
-			else if (!hasBlendState1 && hasBlendState2)
-			{
-				return true;
-			}
-			else if (hasBlendState1 && hasBlendState2)
-			{
-				std::shared_ptr<Transform> transform1 = lhs->GetComponent<Transform>();
-				std::shared_ptr<Transform> transform2 = rhs->GetComponent<Transform>();
-				if (transform1 && transform2)
-				{
-					float distTo1 = Math::Vector3f(camPos - transform1->GetTranslation(true)).LengthSqr();
-					float distTo2 = Math::Vector3f(camPos - transform2->GetTranslation(true)).LengthSqr();
+	PIXScopedEvent(PIX_COLOR_INDEX(8), "Destroy GameObjects in Scene");
 
-					return distTo1 > distTo2;
-				}
-			}
-			else
-			{
-				std::shared_ptr<Transform> transform1 = lhs->GetComponent<Transform>();
-				std::shared_ptr<Transform> transform2 = rhs->GetComponent<Transform>();
-				if (transform1 && transform2)
-				{
-					float distTo1 = Math::Vector3f(camPos - transform1->GetTranslation(true)).LengthSqr();
-					float distTo2 = Math::Vector3f(camPos - transform2->GetTranslation(true)).LengthSqr();
+	// Objects are unregistered in the order they were queued (children before their parent),
+	// then removed from myGameObjects in a single pass that keeps the order of the remaining objects.
+	for (auto& gameObject : myGameObjectsToDestroy)
+	{
+		if (auto goTransform = gameObject->GetComponent<Transform>())
+		{
+			DestroyHierarchy(goTransform.get());
+		}
+		else
+		{
+			DestroyInternal(gameObject.get());
+		}
+	}
 
-					return distTo1 < distTo2;
-				}
-			}
+	myGameObjectsToDestroy.clear();
 
-			return false;
-		});
+	auto isDestroyed = [](const std::shared_ptr<GameObject>& object) { return object->myIsPendingDestroy; };
+	std::erase_if(myGameObjects, isDestroyed);
+
+	// Many objects can share a name, so the name index is compacted here in one pass instead of per destroyed object.
+	for (auto it = myGameObjectsByName.begin(); it != myGameObjectsByName.end();)
+	{
+		std::erase_if(it->second, isDestroyed);
+		it = it->second.empty() ? myGameObjectsByName.erase(it) : std::next(it);
+	}
 }
 
 void Scene::DestroyInternal(GameObject* aGameObject)
 {
-	for (size_t i = 0; i < myGameObjects.size(); i++)
+	// Already destroyed as part of another queued hierarchy.
+	if (aGameObject->myScene != this) return;
+
+	LOG(LogScene, Log, "Destroyed GameObject {}!", aGameObject->GetName());
+	RemoveFromArchetype(aGameObject);
+	RemoveFromIndices(aGameObject);
+	ReleaseHandle(aGameObject);
+
+	if (aGameObject->myStaticIndex != StaticSceneIndex::InvalidIndex)
 	{
-		if (myGameObjects[i].get() == aGameObject)
-		{
-			LOG(LogScene, Log, "Destroyed GameObject {}!", aGameObject->GetName());
-			myGameObjects.erase(myGameObjects.begin() + i);
-			return;
-		}
+		OnGameObjectStaticChanged(aGameObject);
 	}
+
+	aGameObject->myScene = nullptr;
+	aGameObject->myIsPendingDestroy = true;
 }
 
 void Scene::DestroyHierarchy(Transform* aTransform)
@@ -264,15 +381,228 @@ void Scene::DestroyHierarchy(Transform* aTransform)
 	DestroyInternal(aTransform->gameObject);
 }
 
+EntityHandle Scene::AllocateHandle(const std::shared_ptr<GameObject>& aGameObject)
+{
+	uint32_t index;
+	if (!myFreeEntitySlots.empty())
+	{
+		index = myFreeEntitySlots.back();
+		myFreeEntitySlots.pop_back();
+	}
+	else
+	{
+		index = static_cast<uint32_t>(myEntitySlots.size());
+		myEntitySlots.emplace_back();
+	}
+
+	myEntitySlots[index].gameObject = aGameObject;
+	return EntityHandle{ index, myEntitySlots[index].generation };
+}
+
+void Scene::ReleaseHandle(GameObject* aGameObject)
+{
+	const EntityHandle handle = aGameObject->myHandle;
+	if (handle.index >= myEntitySlots.size()) return;
+
+	EntitySlot& slot = myEntitySlots[handle.index];
+	slot.gameObject = nullptr;
+	slot.generation++;
+	myFreeEntitySlots.emplace_back(handle.index);
+
+	aGameObject->myHandle = EntityHandle();
+}
+
+const std::shared_ptr<GameObject>& Scene::GetOwningPointer(const GameObject* aGameObject) const
+{
+	const EntitySlot& slot = myEntitySlots[aGameObject->myHandle.index];
+	assert(slot.gameObject.get() == aGameObject && "Game object isn't instantiated in this scene!");
+	return slot.gameObject;
+}
+
+void Scene::AddToIndices(const std::shared_ptr<GameObject>& aGameObject)
+{
+	myGameObjectsByName[aGameObject->GetName()].emplace_back(aGameObject);
+	myGameObjectsByID[aGameObject->GetID()] = aGameObject;
+
+	if (aGameObject->GetNetworkID() != 0)
+	{
+		myGameObjectsByNetworkID[aGameObject->GetNetworkID()] = aGameObject;
+	}
+}
+
+void Scene::RemoveFromIndices(GameObject* aGameObject)
+{
+	if (auto it = myGameObjectsByID.find(aGameObject->GetID()); it != myGameObjectsByID.end() && it->second.get() == aGameObject)
+	{
+		myGameObjectsByID.erase(it);
+	}
+
+	if (auto it = myGameObjectsByNetworkID.find(aGameObject->GetNetworkID()); it != myGameObjectsByNetworkID.end() && it->second.get() == aGameObject)
+	{
+		myGameObjectsByNetworkID.erase(it);
+	}
+}
+
+void Scene::OnGameObjectNameChanged(GameObject* aGameObject, const std::string& aOldName)
+{
+	if (auto it = myGameObjectsByName.find(aOldName); it != myGameObjectsByName.end())
+	{
+		std::erase_if(it->second, [aGameObject](const std::shared_ptr<GameObject>& object) { return object.get() == aGameObject; });
+		if (it->second.empty())
+		{
+			myGameObjectsByName.erase(it);
+		}
+	}
+
+	myGameObjectsByName[aGameObject->GetName()].emplace_back(GetOwningPointer(aGameObject));
+}
+
+void Scene::OnGameObjectIDChanged(GameObject* aGameObject, const unsigned aOldID)
+{
+	auto it = myGameObjectsByID.find(aOldID);
+	if (it == myGameObjectsByID.end() || it->second.get() != aGameObject) return;
+
+	std::shared_ptr<GameObject> gameObject = it->second;
+	myGameObjectsByID.erase(it);
+	myGameObjectsByID[aGameObject->GetID()] = gameObject;
+}
+
+void Scene::OnGameObjectNetworkIDChanged(GameObject* aGameObject, const unsigned aOldNetworkID)
+{
+	if (auto it = myGameObjectsByNetworkID.find(aOldNetworkID); it != myGameObjectsByNetworkID.end() && it->second.get() == aGameObject)
+	{
+		myGameObjectsByNetworkID.erase(it);
+	}
+
+	if (aGameObject->GetNetworkID() != 0)
+	{
+		myGameObjectsByNetworkID[aGameObject->GetNetworkID()] = GetOwningPointer(aGameObject);
+	}
+}
+
+void Scene::OnGameObjectStaticChanged(GameObject* aGameObject)
+{
+	aGameObject->myStaticIndex = StaticSceneIndex::InvalidIndex;
+	myStaticIndexIsDirty = true;
+	OnObjectsChanged();
+}
+
+void Scene::OnTransformMoved()
+{
+	if (!myTransformsMoved.load(std::memory_order_relaxed))
+	{
+		myTransformsMoved.store(true, std::memory_order_relaxed);
+	}
+}
+
+const unsigned Scene::GetTransformsGeneration()
+{
+	if (myTransformsMoved.exchange(false, std::memory_order_relaxed))
+	{
+		myTransformsGeneration++;
+	}
+
+	return myTransformsGeneration;
+}
+
+void Scene::RefreshArchetype(GameObject* aGameObject)
+{
+	RemoveFromArchetype(aGameObject);
+	AddToArchetype(aGameObject);
+}
+
+void Scene::AddToArchetype(GameObject* aGameObject)
+{
+	const ComponentMask& signature = aGameObject->GetComponentMask();
+	Archetype& archetype = GetOrCreateArchetype(signature);
+
+	OnObjectsChanged();
+	aGameObject->myArchetype = &archetype;
+	aGameObject->myArchetypeRow = archetype.gameObjects.size();
+	archetype.gameObjects.emplace_back(aGameObject);
+
+	for (ComponentTypeID id = 0; id < ComponentTypeRegistry::GetGeneration(); id++)
+	{
+		if (signature.test(id))
+		{
+			archetype.columns[id].emplace_back(aGameObject->FindComponentByTypeID(id));
+		}
+	}
+}
+
+void Scene::RemoveFromArchetype(GameObject* aGameObject)
+{
+	Archetype* archetype = aGameObject->myArchetype;
+	if (!archetype) return;
+
+	OnObjectsChanged();
+
+	// Swap-and-pop so the columns stay packed, the last row takes the removed row's place.
+	const size_t row = aGameObject->myArchetypeRow;
+	const size_t lastRow = archetype->gameObjects.size() - 1;
+
+	if (row != lastRow)
+	{
+		archetype->gameObjects[row] = archetype->gameObjects[lastRow];
+		archetype->gameObjects[row]->myArchetypeRow = row;
+	}
+
+	archetype->gameObjects.pop_back();
+
+	for (ComponentTypeID id = 0; id < ComponentTypeRegistry::GetGeneration(); id++)
+	{
+		if (archetype->signature.test(id))
+		{
+			archetype->columns[id][row] = archetype->columns[id][lastRow];
+			archetype->columns[id].pop_back();
+		}
+	}
+
+	aGameObject->myArchetype = nullptr;
+	aGameObject->myArchetypeRow = 0;
+}
+
+void Scene::SyncArchetypes()
+{
+	// A component type registered after objects were sorted into archetypes may change their signatures.
+	if (myArchetypeGeneration == ComponentTypeRegistry::GetGeneration()) return;
+
+	PIXScopedEvent(PIX_COLOR_INDEX(8), "Rebuild Scene Archetypes");
+	myArchetypeGeneration = ComponentTypeRegistry::GetGeneration();
+
+	myArchetypeLookup.clear();
+	myArchetypes.clear();
+
+	for (auto& gameObject : myGameObjects)
+	{
+		gameObject->myArchetype = nullptr;
+		AddToArchetype(gameObject.get());
+	}
+}
+
+Archetype& Scene::GetOrCreateArchetype(const ComponentMask& aSignature)
+{
+	if (auto it = myArchetypeLookup.find(aSignature); it != myArchetypeLookup.end())
+	{
+		return *it->second;
+	}
+
+	Archetype* newArchetype = myArchetypes.emplace_back(std::make_unique<Archetype>()).get();
+	newArchetype->signature = aSignature;
+	myArchetypeLookup.emplace(aSignature, newArchetype);
+	return *newArchetype;
+}
+
 void Scene::UpdateBoundingBox(std::shared_ptr<GameObject> aGameObject)
 {
-	if (aGameObject->GetComponent<Transform>())
+	if (aGameObject->HasComponent<Transform>())
 	{
 		Math::Vector3f bbMin = myBoundingBox.GetMin();
 		Math::Vector3f bbMax = myBoundingBox.GetMax();
 		std::shared_ptr<Transform> objectTransform = aGameObject->GetComponent<Transform>();
 
-		if (aGameObject->GetComponent<Model>())
+#ifndef FRAGILE_HEADLESS
+		if (aGameObject->HasComponent<Model>())
 		{
 			auto& corners = aGameObject->GetComponent<Model>()->GetBoundingBox().GetCorners();
 
@@ -288,7 +618,7 @@ void Scene::UpdateBoundingBox(std::shared_ptr<GameObject> aGameObject)
 				bbMax.z = std::fmaxf(corner.z, bbMax.z);
 			}
 		}
-		else if (aGameObject->GetComponent<AnimatedModel>())
+		else if (aGameObject->HasComponent<AnimatedModel>())
 		{
 			auto& corners = aGameObject->GetComponent<AnimatedModel>()->GetBoundingBox().GetCorners();
 			for (Math::Vector3f corner : corners)
@@ -304,6 +634,7 @@ void Scene::UpdateBoundingBox(std::shared_ptr<GameObject> aGameObject)
 			}
 		}
 		else
+#endif
 		{
 			Math::Vector3f point = objectTransform->GetTranslation(true);
 
@@ -1,5 +1,9 @@
 #pragma once
+#include <atomic>
 #include "Math/AABB3D.hpp"
+#include "Archetype.h"
+#include "GameObject.h"
+#include "StaticSceneIndex.h"
 
 
 class GameObject;
@@ -7,6 +11,14 @@ class Camera;
 class Transform;
 struct PipelineStateObject;
 
+enum class SceneUpdateMode
+{
+	// Updates every game object on the main thread, in scene order.
+	Serial,
+	// Runs the thread-safe components of independent game objects on the job system first, then the rest on the main thread.
+	Parallel
+};
+
 class Scene final
 {
 public:
@@ -22,17 +34,74 @@ public:
 	std::shared_ptr<GameObject> FindGameObjectByID(const unsigned aID);
 	std::shared_ptr<GameObject> FindGameObjectByNetworkID(const unsigned aNetworkID);
 
-	void Instantiate(std::shared_ptr<GameObject> aGameObject);
+	// Returns the handle the game object can be resolved through for as long as it's in this scene.
+	EntityHandle Instantiate(std::shared_ptr<GameObject> aGameObject);
+	// Makes room for aAmount more game objects, so instantiating them in bulk doesn't keep growing the containers.
+	void Reserve(const size_t aAmount);
+	// Queues the game object (and its children) for destruction. Queued objects are removed together at the
+	// start of the next Update, in the order they were queued, and the remaining objects keep their relative order.
 	void Destroy(std::shared_ptr<GameObject> aGameObject);
+	void Destroy(const EntityHandle aHandle);
+
+	// Returns the game object the handle refers to, or nullptr if it has been destroyed or the handle is invalid.
+	// Doesn't touch any reference counts, so prefer storing handles over shared_ptrs to objects you don't own.
+	GameObject* Resolve(const EntityHandle aHandle) const;
 
 	const unsigned GetObjectAmount() const { return static_cast<unsigned>(myGameObjects.size()); }
 	const unsigned GetActiveObjectAmount() const { return myActiveGameObjectAmount; }
 
+	void SetUpdateMode(SceneUpdateMode aUpdateMode) { myUpdateMode = aUpdateMode; }
+	const SceneUpdateMode GetUpdateMode() const { return myUpdateMode; }
+
 	void SetActive(bool aIsActive) { myIsActive = aIsActive; }
 	const bool GetActive() const { return myIsActive; }
 
+	// Calls aFunction(Ts&...) for every active game object that has all of the given component types.
+	// Only archetypes containing those types are visited. Components are reached through the archetype's pointer columns
+	// and the active flag through the game object, so this saves the per object lookups, not the pointer chasing.
+	// Adding/removing components or instantiating/destroying game objects from inside aFunction is not allowed.
+	template <typename... Ts, typename Function>
+	void Each(Function&& aFunction);
+
 private:
-	void SortGameObjects();
+	friend class GameObject;
+
+	struct EntitySlot
+	{
+		std::shared_ptr<GameObject> gameObject;
+		uint32_t generation = 0;
+	};
+
+	EntityHandle AllocateHandle(const std::shared_ptr<GameObject>& aGameObject);
+	void ReleaseHandle(GameObject* aGameObject);
+	// The shared_ptr this scene holds aGameObject through, which must be instantiated in this scene.
+	const std::shared_ptr<GameObject>& GetOwningPointer(const GameObject* aGameObject) const;
+
+	void AddToIndices(const std::shared_ptr<GameObject>& aGameObject);
+	// Removes the object from the ID indices, DestroyQueuedGameObjects takes destroyed objects out of the name index.
+	void RemoveFromIndices(GameObject* aGameObject);
+	void OnGameObjectNameChanged(GameObject* aGameObject, const std::string& aOldName);
+	void OnGameObjectIDChanged(GameObject* aGameObject, const unsigned aOldID);
+	void OnGameObjectNetworkIDChanged(GameObject* aGameObject, const unsigned aOldNetworkID);
+	void OnGameObjectStaticChanged(GameObject* aGameObject);
+	void OnObjectsChanged() { myObjectsGeneration = ourNextObjectsGeneration++; }
+	// Called by the objects' transforms when they move, which can be from several worker threads at once.
+	void OnTransformMoved();
+	// Changes whenever any of the scene's transforms moved since the last time it was asked for.
+	const unsigned GetTransformsGeneration();
+	// Index of the object's entry in myStaticIndex, StaticSceneIndex::InvalidIndex if it's handled as a moving object.
+	const uint32_t GetStaticIndexOf(const GameObject& aGameObject) const { return aGameObject.myStaticIndex; }
+
+	void RefreshArchetype(GameObject* aGameObject);
+	void AddToArchetype(GameObject* aGameObject);
+	void RemoveFromArchetype(GameObject* aGameObject);
+	void SyncArchetypes();
+	Archetype& GetOrCreateArchetype(const ComponentMask& aSignature);
+
+	void UpdateSerial();
+	void UpdateParallel();
+
+	void DestroyQueuedGameObjects();
 	void DestroyInternal(GameObject* aGameObject);
 	void DestroyHierarchy(Transform* aTransform);
 	void UpdateBoundingBox(std::shared_ptr<GameObject> aGameObject);
@@ -41,10 +110,44 @@ private:
 	std::vector<std::shared_ptr<GameObject>> myGameObjectsToDestroy;
 	unsigned myActiveGameObjectAmount = 0;
 	bool myIsActive = false;
+	SceneUpdateMode myUpdateMode = SceneUpdateMode::Serial;
+
+	// Game objects updated on the job system this frame, kept as a member to reuse the allocation.
+	std::vector<GameObject*> myParallelGameObjects;
+	static constexpr size_t ParallelUpdateBatchSize = 64;
 	Math::AABB3D<float> myBoundingBox;
 
+	// Rebuilt at the start of the next Update whenever a static object is added, removed or changed. Until then the
+	// affected objects are handled like moving ones.
+	StaticSceneIndex myStaticIndex;
+	bool myStaticIndexIsDirty = false;
+
+	// Changes whenever objects are added or removed, gain or lose components, or go in or out of the static index, so
+	// anything built from the scene's objects can tell it's out of date. Every scene draws from the same counter, so a
+	// scene created where another one was destroyed never repeats a generation seen before.
+	static inline unsigned ourNextObjectsGeneration = 0;
+	unsigned myObjectsGeneration = ourNextObjectsGeneration++;
+	// Only written when it isn't set already, so transforms moving on several threads don't keep taking the cache line
+	// from each other. GetTransformsGeneration turns it into a new generation.
+	std::atomic<bool> myTransformsMoved = false;
+	unsigned myTransformsGeneration = 0;
+
 	unsigned myCurrentGameObjectID = 0;
 
+	// Lookup indices for the finders, kept up to date on Instantiate, Destroy and SetName/SetID/SetNetworkID.
+	// Names don't have to be unique, FindGameObjectByName returns the first instantiated object with that name.
+	std::unordered_map<std::string, std::vector<std::shared_ptr<GameObject>>> myGameObjectsByName;
+	std::unordered_map<unsigned, std::shared_ptr<GameObject>> myGameObjectsByID;
+	std::unordered_map<unsigned, std::shared_ptr<GameObject>> myGameObjectsByNetworkID;
+
+	// Slots are reused through the free list, the generation is bumped on release so stale handles stop resolving.
+	std::vector<EntitySlot> myEntitySlots;
+	std::vector<uint32_t> myFreeEntitySlots;
+
+	std::vector<std::unique_ptr<Archetype>> myArchetypes;
+	std::unordered_map<ComponentMask, Archetype*> myArchetypeLookup;
+	unsigned myArchetypeGeneration = 0;
+
 	// TEMP (?)
 	std::shared_ptr<GameObject> myMainCamera;
 	std::shared_ptr<GameObject> myAmbientLight;
@@ -52,3 +155,27 @@ private:
 	std::vector<std::shared_ptr<GameObject>> myPointLights;
 	std::vector<std::shared_ptr<GameObject>> mySpotLights;
 };
+
+template <typename... Ts, typename Function>
+inline void Scene::Each(Function&& aFunction)
+{
+	ComponentMask requiredMask;
+	(requiredMask.set(GetComponentTypeID<Ts>()), ...);
+
+	SyncArchetypes();
+
+	for (auto& archetype : myArchetypes)
+	{
+		if ((archetype->signature & requiredMask) != requiredMask) continue;
+
+		auto columns = std::make_tuple(archetype->columns[GetComponentTypeID<Ts>()].data()...);
+		const std::vector<GameObject*>& gameObjects = archetype->gameObjects;
+
+		for (size_t row = 0; row < gameObjects.size(); row++)
+		{
+			if (!gameObjects[row]->GetActive()) continue;
+
+			std::apply([&aFunction, row](auto*... aColumns) { aFunction(*static_cast<Ts*>(aColumns[row])...); }, columns);
+		}
+	}
+}
@@ -0,0 +1,84 @@
+#include "Enginepch.h"
+
+#include "StaticSceneIndex.h"
+#include "ComponentSystem/Components/Transform.h"
+#ifndef FRAGILE_HEADLESS
+#include "ComponentSystem/Components/Graphics/Model.h"
+#include "ComponentSystem/Components/Graphics/AnimatedModel.h"
+#include "ComponentSystem/Components/Graphics/InstancedModel.h"
+#endif
+
+void StaticSceneIndex::Build(const std::vector<std::shared_ptr<GameObject>>& aGameObjects)
+{
+	PIXScopedEvent(PIX_COLOR_INDEX(7), "Build Static Scene Index");
+	Clear();
+
+	std::vector<Math::AABB3D<float>> renderBounds;
+	std::vector<Math::AABB3D<float>> colliderBounds;
+
+	for (auto& gameObject : aGameObjects)
+	{
+		gameObject->myStaticIndex = InvalidIndex;
+		if (!gameObject->GetStatic()) continue;
+
+		std::shared_ptr<Transform> transform = gameObject->GetComponent<Transform>();
+		if (!transform) continue;
+
+		const uint32_t index = static_cast<uint32_t>(myEntries.size());
+		Entry& entry = myEntries.emplace_back();
+		entry.gameObject = gameObject.get();
+		entry.worldMatrix = transform->GetWorldMatrix();
+
+#ifndef FRAGILE_HEADLESS
+		Math::AABB3D<float> localBounds;
+		if (std::shared_ptr<Model> model = gameObject->GetComponent<Model>())
+		{
+			localBounds = model->GetBoundingBox();
+			entry.hasRenderBounds = true;
+		}
+		else if (std::shared_ptr<AnimatedModel> animModel = gameObject->GetComponent<AnimatedModel>())
+		{
+			localBounds = animModel->GetBoundingBox();
+			entry.hasRenderBounds = true;
+		}
+		else if (std::shared_ptr<InstancedModel> instancedModel = gameObject->GetComponent<InstancedModel>())
+		{
+			localBounds = instancedModel->GetBoundingBox();
+			entry.hasRenderBounds = true;
+		}
+
+		if (entry.hasRenderBounds)
+		{
+			entry.renderBounds = localBounds.GetAABBinNewSpace(entry.worldMatrix);
+			renderBounds.emplace_back(entry.renderBounds);
+			myRenderEntries.emplace_back(index);
+		}
+#endif
+
+		if (std::shared_ptr<Collider> collider = gameObject->GetComponent<Collider>())
+		{
+			entry.collider = collider.get();
+			entry.colliderBounds = collider->GetWorldBounds();
+			colliderBounds.emplace_back(entry.colliderBounds);
+			myColliderEntries.emplace_back(index);
+			myColliderLayers |= collider->GetCollisionLayerBit();
+		}
+
+		gameObject->myStaticIndex = index;
+	}
+
+	myRenderHierarchy.Build(renderBounds);
+	myColliderHierarchy.Build(colliderBounds);
+
+	LOG(LogScene, Log, "Built static scene index with {} objects, {} renderable and {} with colliders.", myEntries.size(), myRenderEntries.size(), myColliderEntries.size());
+}
+
+void StaticSceneIndex::Clear()
+{
+	myEntries.clear();
+	myRenderEntries.clear();
+	myColliderEntries.clear();
+	myColliderLayers = 0;
+	myRenderHierarchy.Clear();
+	myColliderHierarchy.Clear();
+}
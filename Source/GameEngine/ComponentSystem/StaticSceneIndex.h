@@ -0,0 +1,104 @@
+#pragma once
+#include "Math/AABB3D.hpp"
+#include "Math/Matrix4x4.hpp"
+#include "Math/BoundingVolumeHierarchy.hpp"
+#include "GameObject.h"
+#include "ComponentSystem/Components/Physics/Colliders/Collider.h"
+
+// World space data for a scene's static game objects (see GameObject::SetStatic), worked out when the set of static
+// objects changes instead of every frame. Culling and collision query the two hierarchies, so static objects outside
+// the view or away from every moving collider aren't visited at all.
+class StaticSceneIndex
+{
+public:
+	static constexpr uint32_t InvalidIndex = UINT32_MAX;
+
+	struct Entry
+	{
+		GameObject* gameObject = nullptr;
+		Math::Matrix4x4f worldMatrix;
+		// World space bounds of the object's model, if it has one.
+		Math::AABB3D<float> renderBounds;
+		bool hasRenderBounds = false;
+		// The object's first collider and its world space bounds, if it has one.
+		Collider* collider = nullptr;
+		Math::AABB3D<float> colliderBounds;
+	};
+
+	// Indexes every static game object with a transform and points them at their entries.
+	void Build(const std::vector<std::shared_ptr<GameObject>>& aGameObjects);
+	void Clear();
+
+	const size_t GetEntryCount() const { return myEntries.size(); }
+	const Entry& GetEntry(const uint32_t aIndex) const { return myEntries[aIndex]; }
+	// Bits of every layer the indexed colliders were on when the index was built.
+	const uint32_t GetColliderLayers() const { return myColliderLayers; }
+
+	// Calls aFunction(entryIndex, entry) for every active entry with render bounds passing aOverlapTest(const Math::AABB3D<float>&).
+	template <typename OverlapTest, typename Function>
+	void QueryRenderBounds(OverlapTest&& aOverlapTest, Function&& aFunction) const;
+	// Calls aFunction(entryIndex, entry) for every active entry with an active collider whose bounds pass aOverlapTest(const Math::AABB3D<float>&).
+	template <typename OverlapTest, typename Function>
+	void QueryColliderBounds(OverlapTest&& aOverlapTest, Function&& aFunction) const;
+	// Calls aFunction(entryIndex, entry) for every active entry with an active collider whose bounds overlap aBounds.
+	template <typename Function>
+	void QueryColliders(const Math::AABB3D<float>& aBounds, Function&& aFunction) const;
+
+private:
+	// Objects that stopped being static or were destroyed since the last build still have entries, but no longer point at them.
+	const bool IsCurrent(const uint32_t aIndex) const { return myEntries[aIndex].gameObject->myStaticIndex == aIndex; }
+
+	std::vector<Entry> myEntries;
+
+	// Hierarchy item index to entry index, for entries with render bounds and with colliders respectively.
+	std::vector<uint32_t> myRenderEntries;
+	std::vector<uint32_t> myColliderEntries;
+	uint32_t myColliderLayers = 0;
+	Math::BoundingVolumeHierarchy<float> myRenderHierarchy;
+	Math::BoundingVolumeHierarchy<float> myColliderHierarchy;
+};
+
+template <typename OverlapTest, typename Function>
+inline void StaticSceneIndex::QueryRenderBounds(OverlapTest&& aOverlapTest, Function&& aFunction) const
+{
+	myRenderHierarchy.Query(aOverlapTest, [this, &aFunction](uint32_t aItem)
+		{
+			const uint32_t index = myRenderEntries[aItem];
+			if (IsCurrent(index) && myEntries[index].gameObject->GetActive())
+			{
+				aFunction(index, myEntries[index]);
+			}
+		});
+}
+
+template <typename OverlapTest, typename Function>
+inline void StaticSceneIndex::QueryColliderBounds(OverlapTest&& aOverlapTest, Function&& aFunction) const
+{
+	myColliderHierarchy.Query(aOverlapTest, [this, &aFunction](uint32_t aItem)
+		{
+			const uint32_t index = myColliderEntries[aItem];
+			const Entry& entry = myEntries[index];
+			if (IsCurrent(index) && entry.gameObject->GetActive() && entry.collider->GetActive())
+			{
+				aFunction(index, entry);
+			}
+		});
+}
+
+template <typename Function>
+inline void StaticSceneIndex::QueryColliders(const Math::AABB3D<float>& aBounds, Function&& aFunction) const
+{
+	const Math::Vector3f boundsMin = aBounds.GetMin();
+	const Math::Vector3f boundsMax = aBounds.GetMax();
+
+	auto overlapsBounds = [&boundsMin, &boundsMax](const Math::AABB3D<float>& aNodeBounds)
+		{
+			const Math::Vector3f nodeMin = aNodeBounds.GetMin();
+			const Math::Vector3f nodeMax = aNodeBounds.GetMax();
+			return nodeMin.x <= boundsMax.x && nodeMax.x >= boundsMin.x
+				&& nodeMin.y <= boundsMax.y && nodeMax.y >= boundsMin.y
+				&& nodeMin.z <= boundsMax.z && nodeMax.z >= boundsMin.z;
+		};
+
+	QueryColliderBounds(overlapsBounds, aFunction);
+}
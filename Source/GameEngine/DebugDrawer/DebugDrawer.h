@@ -4,8 +4,9 @@
 #include "Math/AABB3D.hpp"
 #include "Math/Sphere.hpp"
 
-
+#ifndef FRAGILE_HEADLESS
 #include "Objects/Vertices/DebugLineVertex.h"
+#endif
 #include "DebugDrawer/DebugLine.hpp"
 
 class Camera;
@@ -30,9 +31,10 @@ public:
     void DrawBoundingBox(std::shared_ptr<DebugModel> aModel, Math::Vector4f aColor = { 1.0f, 1.0f, 1.0f, 1.0f });
     void DrawBoundingSphere(Math::Sphere<float> aSphere, Math::Matrix4x4f aWorldMatrix = Math::Matrix4x4f(), Math::Vector4f aColor = { 1.0f, 1.0f, 1.0f, 1.0f });
 private:
-
+#ifndef FRAGILE_HEADLESS
     std::vector<DebugLineVertex> myLineVertices;
     std::shared_ptr<DynamicVertexBuffer> myLineBuffer;
+#endif
 
     bool myHasWarned = false;
 };
@@ -2,6 +2,7 @@
 
 #include "Engine.h"
 #include "Time/Timer.h"
+#include "Time/FixedTimestep.h"
 #include "Input/InputHandler.h"
 #include "GlobalEventHandler/GlobalEventHandler.h"
 #include "SceneHandler/SceneHandler.h"
@@ -14,6 +15,8 @@
 #include "Application/Window.h"
 #include "Application/WindowsEventHandler.h"
 #include "Application/AppSettings.h"
+#include "JobSystem/JobSystem.h"
+#include "ComponentSystem/Scene.h"
 
 static Engine* sInstance = nullptr;
 
@@ -33,12 +36,15 @@ void Engine::Initialize()
     instance.myWindow = std::make_unique<Window>();
     instance.myEventHandler = std::make_unique<WindowsEventHandler>();
     instance.myTimer = std::make_unique<Timer>();
+    instance.myFixedTimestep = std::make_unique<FixedTimestep>();
     instance.myInputHandler = std::make_unique<InputHandler>();
     instance.myGlobalEventHandler = std::make_unique<GlobalEventHandler>();
     instance.mySceneHandler = std::make_unique<SceneHandler>();
     instance.myDebugDrawer = std::make_unique<DebugDrawer>();
     instance.myAudioEngine = std::make_unique<AudioEngine>();
     instance.myImGuiHandler = std::make_unique<ImGuiHandler>();
+    instance.myJobSystem = std::make_unique<JobSystem>(AppSettings::Get().workerThreadCount);
+    instance.mySceneHandler->SetSceneUpdateMode(AppSettings::Get().parallelSceneUpdate ? SceneUpdateMode::Parallel : SceneUpdateMode::Serial);
 
     instance.myTitle = AppSettings::Get().title;
     instance.myContentRoot = AppSettings::Get().contentRoot;
@@ -49,6 +55,7 @@ void Engine::Initialize()
     instance.myIsBorderless = AppSettings::Get().isBorderless;
     instance.myAllowDropFiles = AppSettings::Get().allowDropFiles;
     instance.myAutoRegisterAssets = AppSettings::Get().autoRegisterAssets;
+    instance.SetFixedTimestep(AppSettings::Get().simulationRate, AppSettings::Get().maxSimulationStepsPerFrame);
     AppSettings::Destroy();
 
     instance.myWindow->InitializeWindow(instance.myTitle, instance.myWindowSize, instance.myWindowPos, instance.myIsFullscreen, instance.myIsBorderless, instance.myAllowDropFiles);
@@ -88,7 +95,13 @@ void Engine::Prepare()
 void Engine::Update()
 {
     myTimer->Update();
-    mySceneHandler->UpdateActiveScene();
+
+    mySimulationStepCount = myFixedTimestep->Advance(myTimer->GetUnscaledDeltaTime());
+    for (unsigned step = 0; step < mySimulationStepCount; step++)
+    {
+        mySceneHandler->UpdateActiveScene();
+    }
+
     myInputHandler->UpdateInput();
     myAudioEngine->Update();
     myImGuiHandler->Update();
@@ -102,6 +115,19 @@ void Engine::Render()
     GraphicsEngine::Get().EndFrame();
 }
 
+void Engine::SetFixedTimestep(float aStepsPerSecond, unsigned aMaxStepsPerFrame)
+{
+    myFixedTimestep->SetStepsPerSecond(aStepsPerSecond);
+    myFixedTimestep->SetMaxStepsPerFrame(aMaxStepsPerFrame);
+    myTimer->SetFixedDeltaTime(myFixedTimestep->GetStepTime());
+    LOG(LogGameEngine, Log, "Simulating at {} steps per second (0 is once per frame).", myFixedTimestep->GetStepsPerSecond());
+}
+
+float Engine::GetInterpolationAlpha() const
+{
+    return myFixedTimestep->GetInterpolationAlpha();
+}
+
 const std::filesystem::path& Engine::GetContentRootPath()
 {
     return myContentRoot;
@@ -13,12 +13,19 @@ class ImGuiHandler;
 class Application;
 class WindowsEventHandler;
 class Window;
+class JobSystem;
+class FixedTimestep;
 
 class Engine
 {
 public:
     static Engine& Get();
+#ifndef FRAGILE_HEADLESS
     static void Initialize();
+#else
+    // Headless builds have no AppSettings to read the worker count from, 0 picks it from the hardware.
+    static void Initialize(unsigned aWorkerThreadCount = 0);
+#endif
     static void Shutdown();
 
     void Prepare();
@@ -26,14 +33,27 @@ public:
     void Render();
 
     Timer& GetTimer() { return *myTimer; }
-    InputHandler& GetInputHandler() { return *myInputHandler; }
     GlobalEventHandler& GetGlobalEventHandler() { return *myGlobalEventHandler; }
-    SceneHandler& GetSceneHandler() { return *mySceneHandler; }
     DebugDrawer& GetDebugDrawer() { return *myDebugDrawer; }
+    JobSystem& GetJobSystem() { return *myJobSystem; }
+#ifndef FRAGILE_HEADLESS
+    InputHandler& GetInputHandler() { return *myInputHandler; }
+    SceneHandler& GetSceneHandler() { return *mySceneHandler; }
     AudioEngine& GetAudioEngine() { return *myAudioEngine; }
     ImGuiHandler& GetImGuiHandler() { return *myImGuiHandler; }
     WindowsEventHandler& GetWindowsEventHandler() { return *myEventHandler; }
     Window& GetApplicationWindow() { return *myWindow; }
+#endif
+
+    // Simulates at a fixed rate instead of once per frame with the frame's delta time, 0 steps per second goes back to that.
+    // Input is still gathered per frame, so a press can be seen by several steps of a frame or by none.
+    void SetFixedTimestep(float aStepsPerSecond, unsigned aMaxStepsPerFrame = 5);
+    const FixedTimestep& GetFixedTimestep() const { return *myFixedTimestep; }
+    // How far the current frame is between the last two simulation steps, for interpolating rendered state.
+    float GetInterpolationAlpha() const;
+    // Number of times the last Update simulated the active scene. Headless builds have no scene handler, whoever
+    // owns the scenes runs this many steps after Update.
+    const unsigned GetSimulationStepCount() const { return mySimulationStepCount; }
 
     const std::filesystem::path& GetContentRootPath();
     const std::string& GetApplicationTitle();
@@ -55,15 +75,25 @@ private:
     Engine(Engine const&) = delete;
     void operator=(Engine const&) = delete;
     
+#ifndef FRAGILE_HEADLESS
     std::unique_ptr<Window> myWindow;
     std::unique_ptr<WindowsEventHandler> myEventHandler;
+#endif
     std::unique_ptr<Timer> myTimer;
+    std::unique_ptr<FixedTimestep> myFixedTimestep;
+#ifndef FRAGILE_HEADLESS
     std::unique_ptr<InputHandler> myInputHandler;
+#endif
     std::unique_ptr<GlobalEventHandler> myGlobalEventHandler;
+#ifndef FRAGILE_HEADLESS
     std::unique_ptr<SceneHandler> mySceneHandler;
+#endif
     std::unique_ptr<DebugDrawer> myDebugDrawer;
+#ifndef FRAGILE_HEADLESS
     std::unique_ptr<AudioEngine> myAudioEngine;
     std::unique_ptr<ImGuiHandler> myImGuiHandler;
+#endif
+    std::unique_ptr<JobSystem> myJobSystem;
 
     std::string myTitle;
     std::filesystem::path myContentRoot;
@@ -74,4 +104,5 @@ private:
     bool myIsBorderless = true;
     bool myAllowDropFiles = false;
     bool myAutoRegisterAssets = true;
+    unsigned mySimulationStepCount = 0;
 };
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #define MAX_MODEL_MATERIALS 10
+#define MAX_COMPONENT_TYPES 64
 
 // These may need to be changed manually in shader code as well
 #define MAX_POINTLIGHTS 4
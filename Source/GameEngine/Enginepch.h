@@ -1,8 +1,12 @@
 #pragma once
+// FRAGILE_HEADLESS builds the simulation parts of the engine without Windows, graphics, audio or input,
+// see Platform/Headless.
+#ifndef FRAGILE_HEADLESS
 #include <WinSock2.h>
 #include <windows.h>
 #include <Windowsx.h>
 #include <wrl.h>
+#endif
 
 #include <memory>
 #include <functional>
@@ -23,7 +27,10 @@ namespace nl = nlohmann;
 #include <mutex>
 #include <shared_mutex>
 #include <thread>
+#include <atomic>
+#include <bitset>
 
+#ifndef FRAGILE_HEADLESS
 #include "AssetManager.h"
 #include "Engine.h"
 #include "Audio/AudioEngine.h"
@@ -35,12 +42,22 @@ namespace nl = nlohmann;
 #include "fmod/fmod.hpp"
 #include "fmod/fmod_studio.hpp"
 #include "fmod/fmod_common.h"
+#else
+#include <cassert>
+#include <cfloat>
+#include "Engine.h"
+#endif
 
 #ifndef _RETAIL
 #include "Logger/Logger.h"
 #define USE_PIX
 #endif
+
+#ifndef FRAGILE_HEADLESS
 #include "WinPixEventRuntime/pix3.h"
+#else
+#include "Platform/Headless/HeadlessPix.h"
+#endif
 
 #ifdef _DEBUG
 DECLARE_LOG_CATEGORY_WITH_NAME(LogGameEngine, GameEngine, Verbose);
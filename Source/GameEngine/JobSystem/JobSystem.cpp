@@ -0,0 +1,147 @@
+#include "Enginepch.h"
+
+#include "JobSystem.h"
+
+// Index of the queue owned by the current thread, 0 for threads outside the pool.
+static thread_local unsigned tQueueIndex = 0;
+
+JobSystem::JobSystem(unsigned aWorkerCount)
+{
+	if (aWorkerCount == 0)
+	{
+		const unsigned hardwareThreads = std::thread::hardware_concurrency();
+		aWorkerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+	}
+
+	for (unsigned i = 0; i < aWorkerCount + 1; i++)
+	{
+		myQueues.emplace_back(std::make_unique<WorkQueue>());
+	}
+
+	for (unsigned i = 0; i < aWorkerCount; i++)
+	{
+		myWorkers.emplace_back(&JobSystem::WorkerLoop, this, i + 1);
+	}
+
+	LOG(LogGameEngine, Log, "Started job system with {} worker threads.", aWorkerCount);
+}
+
+JobSystem::~JobSystem()
+{
+	{
+		std::scoped_lock lock(myWakeMutex);
+		myIsRunning = false;
+	}
+
+	myWakeCondition.notify_all();
+
+	for (auto& worker : myWorkers)
+	{
+		worker.join();
+	}
+}
+
+void JobSystem::ParallelFor(size_t aCount, size_t aBatchSize, const RangeFunction& aFunction)
+{
+	if (aCount == 0) return;
+
+	if (aBatchSize == 0)
+	{
+		aBatchSize = 1;
+	}
+
+	const size_t batchCount = (aCount + aBatchSize - 1) / aBatchSize;
+
+	if (myWorkers.empty() || batchCount == 1)
+	{
+		aFunction(0, aCount);
+		return;
+	}
+
+	std::atomic<size_t> remainingBatches = batchCount;
+	const unsigned queueCount = static_cast<unsigned>(myQueues.size());
+
+	// Spread the batches over all queues up front, stealing only has to even out the differences in batch cost.
+	for (size_t batch = 0; batch < batchCount; batch++)
+	{
+		const size_t begin = batch * aBatchSize;
+		const size_t end = begin + aBatchSize < aCount ? begin + aBatchSize : aCount;
+
+		Push(static_cast<unsigned>((tQueueIndex + batch) % queueCount), [&aFunction, &remainingBatches, begin, end]()
+			{
+				aFunction(begin, end);
+				remainingBatches.fetch_sub(1, std::memory_order_acq_rel);
+			});
+	}
+
+	{
+		// Makes sure no sleeping worker can miss the new jobs between checking for work and starting to wait.
+		std::scoped_lock lock(myWakeMutex);
+	}
+
+	myWakeCondition.notify_all();
+
+	while (remainingBatches.load(std::memory_order_acquire) > 0)
+	{
+		if (!TryRunJob(tQueueIndex))
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+void JobSystem::Push(unsigned aQueueIndex, Job&& aJob)
+{
+	WorkQueue& queue = *myQueues[aQueueIndex];
+	std::scoped_lock lock(queue.mutex);
+	queue.jobs.emplace_back(std::move(aJob));
+	myQueuedJobCount.fetch_add(1, std::memory_order_release);
+}
+
+bool JobSystem::TryRunJob(unsigned aQueueIndex)
+{
+	Job job;
+
+	{
+		WorkQueue& ownQueue = *myQueues[aQueueIndex];
+		std::scoped_lock lock(ownQueue.mutex);
+		if (!ownQueue.jobs.empty())
+		{
+			job = std::move(ownQueue.jobs.back());
+			ownQueue.jobs.pop_back();
+		}
+	}
+
+	const unsigned queueCount = static_cast<unsigned>(myQueues.size());
+	for (unsigned offset = 1; !job && offset < queueCount; offset++)
+	{
+		WorkQueue& otherQueue = *myQueues[(aQueueIndex + offset) % queueCount];
+		std::scoped_lock lock(otherQueue.mutex);
+		if (!otherQueue.jobs.empty())
+		{
+			job = std::move(otherQueue.jobs.front());
+			otherQueue.jobs.pop_front();
+		}
+	}
+
+	if (!job) return false;
+
+	myQueuedJobCount.fetch_sub(1, std::memory_order_relaxed);
+	job();
+	return true;
+}
+
+void JobSystem::WorkerLoop(unsigned aQueueIndex)
+{
+	tQueueIndex = aQueueIndex;
+
+	while (true)
+	{
+		if (TryRunJob(aQueueIndex)) continue;
+
+		std::unique_lock lock(myWakeMutex);
+		myWakeCondition.wait(lock, [this]() { return !myIsRunning || myQueuedJobCount.load(std::memory_order_acquire) > 0; });
+
+		if (!myIsRunning) return;
+	}
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <functional>
+#include <deque>
+#include <condition_variable>
+
+// Fixed pool of worker threads with one job queue per thread. A thread takes jobs from the back of its own queue and
+// steals from the front of the other queues when it runs dry, so uneven batches even out without a shared central queue.
+class JobSystem
+{
+public:
+	using Job = std::function<void()>;
+	using RangeFunction = std::function<void(size_t aBegin, size_t aEnd)>;
+
+	// A worker count of 0 creates one worker per hardware thread, minus one for the main thread.
+	JobSystem(unsigned aWorkerCount = 0);
+	~JobSystem();
+	JobSystem(const JobSystem&) = delete;
+	JobSystem& operator=(const JobSystem&) = delete;
+
+	// Calls aFunction on consecutive ranges of at most aBatchSize indices covering [0, aCount), and returns once every range is done.
+	// The calling thread runs batches as well while it waits, so this also works (serially) without any workers.
+	void ParallelFor(size_t aCount, size_t aBatchSize, const RangeFunction& aFunction);
+
+	unsigned GetWorkerCount() const { return static_cast<unsigned>(myWorkers.size()); }
+
+private:
+	struct WorkQueue
+	{
+		std::mutex mutex;
+		std::deque<Job> jobs;
+	};
+
+	void Push(unsigned aQueueIndex, Job&& aJob);
+	bool TryRunJob(unsigned aQueueIndex);
+	void WorkerLoop(unsigned aQueueIndex);
+
+	// Queue 0 belongs to the thread submitting work from outside the pool, worker N owns queue N + 1.
+	std::vector<std::unique_ptr<WorkQueue>> myQueues;
+	std::vector<std::thread> myWorkers;
+
+	std::mutex myWakeMutex;
+	std::condition_variable myWakeCondition;
+	std::atomic<unsigned> myQueuedJobCount = 0;
+	bool myIsRunning = true;
+};
@@ -8,6 +8,7 @@
 #include "DebugDrawer/DebugDrawer.h"
 #include "Math/Intersection3D.hpp"
 
+#include "ComponentSystem/Scene.h"
 #include "ComponentSystem/GameObject.h"
 #include "ComponentSystem/Components/Transform.h"
 
@@ -17,6 +18,30 @@ NavMeshAgent::NavMeshAgent(NavMesh* aNavMesh, float aMovementSpeed)
     SetMovementSpeed(aMovementSpeed);
 }
 
+NavMeshAgent::NavMeshAgent(const NavMeshAgent& aNavMeshAgent) : Component(aNavMeshAgent)
+{
+    myNavMesh = aNavMeshAgent.myNavMesh;
+    myMovementSpeed = aNavMeshAgent.myMovementSpeed;
+    myRotationSpeed = aNavMeshAgent.myRotationSpeed;
+    myCurrentRotationTime = aNavMeshAgent.myCurrentRotationTime;
+    myMaxRotationTime = aNavMeshAgent.myMaxRotationTime;
+    myStartRotation = aNavMeshAgent.myStartRotation;
+    myGoalRotation = aNavMeshAgent.myGoalRotation;
+    myShouldPathfind = aNavMeshAgent.myShouldPathfind;
+    myPath = aNavMeshAgent.myPath;
+    myCurrentGoalPoint = aNavMeshAgent.myCurrentGoalPoint;
+    myGoalTolerance = aNavMeshAgent.myGoalTolerance;
+
+#ifndef _RETAIL
+    myPathLines = aNavMeshAgent.myPathLines;
+#endif
+}
+
+NavMeshAgent::~NavMeshAgent()
+{
+    CancelPathRequest();
+}
+
 void NavMeshAgent::Start()
 {
     SetNavMesh(myNavMesh);
@@ -24,6 +49,16 @@ void NavMeshAgent::Start()
 
 void NavMeshAgent::Update()
 {
+    NavMeshPath foundPath;
+    if (myPathRequest != InvalidPathRequest && myNavMesh->TakePath(myPathRequest, foundPath))
+    {
+        myPathRequest = InvalidPathRequest;
+        if (!foundPath.Empty())
+        {
+            FollowPath(std::move(foundPath));
+        }
+    }
+
     if (myShouldPathfind)
     {
         MoveToNextPathPoint();
@@ -36,6 +71,7 @@ void NavMeshAgent::Update()
 
 void NavMeshAgent::SetNavMesh(NavMesh* aNavMesh)
 {
+    CancelPathRequest();
     myNavMesh = aNavMesh;
     if (myNavMesh)
     {
@@ -53,17 +89,55 @@ float NavMeshAgent::GetMovementSpeed() const
     return myMovementSpeed;
 }
 
-void NavMeshAgent::MoveToLocation(Math::Vector3f aPosition)
+void NavMeshAgent::MoveToLocation(Math::Vector3f aPosition, int aPathPriority)
 {
     if (!myNavMesh)
     {
         LOG(LogComponentSystem, Warning, "Navigation agent {} does not have a reference to the navmesh!", gameObject->GetName());
         return;
     }
-    NavMeshPath navPath = myNavMesh->FindPath(gameObject->GetComponent<Transform>()->GetTranslation(), aPosition);
-    if (navPath.Empty()) return;
 
-    myPath = navPath;
+    CancelPathRequest();
+    myPathRequest = myNavMesh->RequestPath(gameObject->GetComponent<Transform>()->GetTranslation(), aPosition, nullptr, aPathPriority);
+}
+
+void NavMeshAgent::Stop()
+{
+    CancelPathRequest();
+    myShouldPathfind = false;
+}
+
+void NavMeshAgent::UpdatePathRequests(Scene& aScene)
+{
+    // Agents mostly share one navmesh, so a short list is enough to update each only once.
+    std::vector<NavMesh*> navMeshes;
+    aScene.Each<NavMeshAgent>([&navMeshes](NavMeshAgent& aAgent)
+        {
+            if (aAgent.GetActive() && aAgent.myNavMesh && std::find(navMeshes.begin(), navMeshes.end(), aAgent.myNavMesh) == navMeshes.end())
+            {
+                navMeshes.emplace_back(aAgent.myNavMesh);
+            }
+        });
+
+    for (NavMesh* navMesh : navMeshes)
+    {
+        navMesh->UpdatePathRequests();
+    }
+}
+
+void NavMeshAgent::CancelPathRequest()
+{
+    if (myNavMesh && myPathRequest != InvalidPathRequest)
+    {
+        myNavMesh->CancelPathRequest(myPathRequest);
+    }
+
+    myPathRequest = InvalidPathRequest;
+}
+
+void NavMeshAgent::FollowPath(NavMeshPath&& aPath)
+{
+    myPath = std::move(aPath);
     myCurrentGoalPoint = 0;
     myShouldPathfind = true;
 
@@ -72,11 +146,6 @@ void NavMeshAgent::MoveToLocation(Math::Vector3f aPosition)
 #endif
 }
 
-void NavMeshAgent::Stop()
-{
-    myShouldPathfind = false;
-}
-
 bool NavMeshAgent::MoveToNextPathPoint()
 {
     auto transform = gameObject->GetComponent<Transform>();
@@ -96,7 +165,7 @@ bool NavMeshAgent::MoveToNextPathPoint()
     }
 
     Math::Vector3f direction = (myPath[myCurrentGoalPoint] - position).GetNormalized();
-    Math::Vector3f moveDelta = direction * myMovementSpeed * Engine::Get().GetTimer().GetDeltaTime();
+    Math::Vector3f moveDelta = direction * myMovementSpeed * Engine::Get().GetTimer().GetFixedDeltaTime();
     transform->SetTranslation(transform->GetTranslation() + moveDelta);
 
     RotateTowardsVelocity(direction);
@@ -106,11 +175,11 @@ bool NavMeshAgent::MoveToNextPathPoint()
 
 void NavMeshAgent::RotateTowardsVelocity(Math::Vector3f aDirection)
 {
-    myCurrentRotationTime += Engine::Get().GetTimer().GetDeltaTime();
+    myCurrentRotationTime += Engine::Get().GetTimer().GetFixedDeltaTime();
     float t = myCurrentRotationTime / myMaxRotationTime;
 
     Math::Quatf slerpedRotation = Math::Quatf::Slerp(myStartRotation, myGoalRotation, t);
-    gameObject->GetComponent<Transform>()->SetRotation(slerpedRotation.GetEulerAnglesDegrees());
+    gameObject->GetComponent<Transform>()->SetRotationQuaternion(slerpedRotation);
 
     if (t >= 0.99f)
     {
@@ -1,16 +1,21 @@
 #pragma once
 #include "ComponentSystem/Component.h"
 #include <Math/Vector.hpp>
+#include "Math/Quaternion.hpp"
 #include "DebugDrawer/DebugLine.hpp"
 #include "Pathfinding/NavMeshPath.h"
 
 class NavMesh;
+class Scene;
 
 class NavMeshAgent : public Component
 {
 public:
 	NavMeshAgent() = default;
 	NavMeshAgent(NavMesh* aNavMesh, float aMovementSpeed);
+	// Copies the settings and the path being followed, but not a path request still in flight, which stays the original's.
+	NavMeshAgent(const NavMeshAgent& aNavMeshAgent);
+	~NavMeshAgent() override;
 
 	void Start() override;
 	void Update() override;
@@ -19,14 +24,22 @@ public:
 	void SetMovementSpeed(float aSpeed);
 	float GetMovementSpeed() const;
 
-	void MoveToLocation(Math::Vector3f aPosition);
+	// Requests a path from the navmesh and starts following it once it's found, which takes a few frames at most.
+	// The agent keeps following its current path until then.
+	void MoveToLocation(Math::Vector3f aPosition, int aPathPriority = 0);
 	void Stop();
 
+	// Runs NavMesh::UpdatePathRequests once on every navmesh the active agents in aScene use.
+	static void UpdatePathRequests(Scene& aScene);
+
 private:
+	void CancelPathRequest();
+	void FollowPath(NavMeshPath&& aPath);
 	bool MoveToNextPathPoint();
 	void RotateTowardsVelocity(Math::Vector3f aDirection);
 
-	NavMesh* myNavMesh;
+	NavMesh* myNavMesh = nullptr;
+	PathRequestID myPathRequest = InvalidPathRequest;
 	float myMovementSpeed = 150.0f;
 	float myRotationSpeed = 20.0f;
 
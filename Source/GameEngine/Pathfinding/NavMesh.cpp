@@ -9,11 +9,227 @@
 #include "ComponentSystem/GameObject.h"
 #include "ComponentSystem/Components/Transform.h"
 
+namespace
+{
+	float GetDistanceSqr(const Math::Vector3f& aPosition, const Math::AABB3D<float>& aBounds)
+	{
+		const Math::Vector3f boundsMin = aBounds.GetMin();
+		const Math::Vector3f boundsMax = aBounds.GetMax();
+		const float x = aPosition.x < boundsMin.x ? boundsMin.x - aPosition.x : (aPosition.x > boundsMax.x ? aPosition.x - boundsMax.x : 0);
+		const float y = aPosition.y < boundsMin.y ? boundsMin.y - aPosition.y : (aPosition.y > boundsMax.y ? aPosition.y - boundsMax.y : 0);
+		const float z = aPosition.z < boundsMin.z ? boundsMin.z - aPosition.z : (aPosition.z > boundsMax.z ? aPosition.z - boundsMax.z : 0);
+		return x * x + y * y + z * z;
+	}
+
+	// Whether the bounds are straight above or below the position.
+	const bool IsInsideHorizontally(const Math::Vector3f& aPosition, const Math::AABB3D<float>& aBounds)
+	{
+		const Math::Vector3f boundsMin = aBounds.GetMin();
+		const Math::Vector3f boundsMax = aBounds.GetMax();
+		return aPosition.x >= boundsMin.x && aPosition.x <= boundsMax.x && aPosition.z >= boundsMin.z && aPosition.z <= boundsMax.z;
+	}
+
+	// Whether any point on the segment is within aMargin of the bounds on every axis. Points further away than
+	// aMargin fail, so it can rule out bounds when looking for things within aMargin of the segment.
+	const bool SegmentIntersectsBounds(const Math::Vector3f& aStart, const Math::Vector3f& aEnd, const Math::AABB3D<float>& aBounds, const float aMargin)
+	{
+		const Math::Vector3f boundsMin = aBounds.GetMin() - Math::Vector3f(aMargin, aMargin, aMargin);
+		const Math::Vector3f boundsMax = aBounds.GetMax() + Math::Vector3f(aMargin, aMargin, aMargin);
+		float entry = 0;
+		float exit = 1.0f;
+
+		auto clipAxis = [&entry, &exit](const float aStartValue, const float aEndValue, const float aMin, const float aMax)
+			{
+				const float delta = aEndValue - aStartValue;
+				if (delta == 0)
+				{
+					if (aStartValue < aMin || aStartValue > aMax) exit = -1.0f;
+					return;
+				}
+
+				const float t1 = (aMin - aStartValue) / delta;
+				const float t2 = (aMax - aStartValue) / delta;
+				entry = (t1 < t2 ? t1 : t2) > entry ? (t1 < t2 ? t1 : t2) : entry;
+				exit = (t1 < t2 ? t2 : t1) < exit ? (t1 < t2 ? t2 : t1) : exit;
+			};
+
+		clipAxis(aStart.x, aEnd.x, boundsMin.x, boundsMax.x);
+		clipAxis(aStart.y, aEnd.y, boundsMin.y, boundsMax.y);
+		clipAxis(aStart.z, aEnd.z, boundsMin.z, boundsMax.z);
+		return entry <= exit;
+	}
+
+	// Positions that compare equal hash the same, 0 and -0 included.
+	struct VertexPositionHash
+	{
+		size_t operator()(const Math::Vector3f& aPosition) const
+		{
+			auto getBits = [](const float aValue)
+				{
+					uint32_t bits = 0;
+					if (aValue != 0) std::memcpy(&bits, &aValue, sizeof(bits));
+					return static_cast<size_t>(bits);
+				};
+
+			size_t hash = getBits(aPosition.x);
+			hash = hash * 31 + getBits(aPosition.y);
+			hash = hash * 31 + getBits(aPosition.z);
+			return hash;
+		}
+	};
+
+	// The closest point on a polygon edge found so far. Ties go to the lowest polygon index, and to the first edge
+	// within a polygon, which is what going through them all in order gives.
+	struct ClosestEdgePoint
+	{
+		Math::Vector3f point;
+		float distanceSqr = FLT_MAX;
+		int polygon = -1;
+
+		void Consider(const Math::Vector3f& aPoint, const float aDistanceSqr, const int aPolygon)
+		{
+			if (aDistanceSqr < distanceSqr || (aDistanceSqr == distanceSqr && aPolygon < polygon))
+			{
+				point = aPoint;
+				distanceSqr = aDistanceSqr;
+				polygon = aPolygon;
+			}
+		}
+	};
+}
+
 void NavMesh::Init(std::vector<NavNode> aNavNodeList, std::vector<NavPolygon> aNavPolygonList, std::vector<NavPortal> aNavPortalList)
 {
 	myNodes = aNavNodeList;
 	myPolygons = aNavPolygonList;
 	myPortals = aNavPortalList;
+	BuildSpatialIndex();
+
+	myPortalEdges.clear();
+	for (const NavPortal& portal : myPortals)
+	{
+		myPortalEdges.insert({ portal.vertices[0], portal.vertices[1] });
+	}
+}
+
+size_t NavMesh::PortalEdgeHash::operator()(const PortalEdge& aEdge) const
+{
+	// Adding the vertex hashes makes both directions hash the same.
+	return VertexPositionHash()(aEdge.first) + VertexPositionHash()(aEdge.second);
+}
+
+std::vector<NavPortal> NavMesh::CreatePortals(const std::vector<NavPolygon>& aNavPolygonList, const std::vector<NavNode>& aNavNodeList)
+{
+	// Polygons sharing an edge share its vertices, so only the ones using one of a polygon's vertices need comparing to it.
+	std::unordered_map<Math::Vector3f, int, VertexPositionHash> vertexIndices;
+	std::vector<std::vector<int>> vertexPolygons;
+	vertexIndices.reserve(aNavPolygonList.size() * 3);
+
+	for (int i = 0; i < static_cast<int>(aNavPolygonList.size()); ++i)
+	{
+		for (const Math::Vector3f& vertexPos : aNavPolygonList[i].vertexPositions)
+		{
+			auto [vertex, isNew] = vertexIndices.try_emplace(vertexPos, static_cast<int>(vertexPolygons.size()));
+			if (isNew)
+			{
+				vertexPolygons.emplace_back();
+			}
+
+			std::vector<int>& polygons = vertexPolygons[vertex->second];
+			if (polygons.empty() || polygons.back() != i)
+			{
+				polygons.emplace_back(i);
+			}
+		}
+	}
+
+	std::vector<NavPortal> navPortals;
+	std::vector<int> neighbours;
+
+	for (int i = 0; i < static_cast<int>(aNavPolygonList.size()); ++i)
+	{
+		const NavPolygon& navPoly1 = aNavPolygonList[i];
+
+		neighbours.clear();
+		for (const Math::Vector3f& vertexPos : navPoly1.vertexPositions)
+		{
+			// Not found for NaN positions, which aren't equal to anything.
+			auto vertex = vertexIndices.find(vertexPos);
+			if (vertex == vertexIndices.end()) continue;
+
+			const std::vector<int>& polygons = vertexPolygons[vertex->second];
+			neighbours.insert(neighbours.end(), polygons.begin(), polygons.end());
+		}
+
+		std::sort(neighbours.begin(), neighbours.end());
+		neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+
+		for (const int j : neighbours)
+		{
+			if (i == j) continue;
+
+			const NavPolygon& navPoly2 = aNavPolygonList[j];
+
+			std::array<Math::Vector3f, 2> sharedVertices;
+			int sharedCount = 0;
+
+			for (int vertexPos = 0; vertexPos < static_cast<int>(navPoly2.vertexPositions.size()); vertexPos++)
+			{
+				const Math::Vector3f& vertexPosToTest = navPoly2.vertexPositions[vertexPos];
+				if (std::find(navPoly1.vertexPositions.begin(), navPoly1.vertexPositions.end(), vertexPosToTest) != navPoly1.vertexPositions.end())
+				{
+					assert(sharedCount < 2 && "More than 2 shared vertices means mesh is not triangulated, or polygon is really damn small");
+					sharedVertices[sharedCount++] = vertexPosToTest;
+				}
+			}
+
+			if (sharedCount == 2) // Polygons share an edge
+			{
+				NavPortal& navPortal = navPortals.emplace_back();
+				navPortal.nodes[0] = i;
+				navPortal.nodes[1] = j;
+				navPortal.vertices[0] = sharedVertices[0];
+				navPortal.vertices[1] = sharedVertices[1];
+				navPortal.cost = (aNavNodeList[i].position - aNavNodeList[j].position).Length();
+			}
+		}
+	}
+
+	return navPortals;
+}
+
+void NavMesh::BuildSpatialIndex()
+{
+	std::vector<Math::AABB3D<float>> bounds;
+	bounds.reserve(myPolygons.size());
+	const Math::Vector3f margin(PolygonBoundsMargin, PolygonBoundsMargin, PolygonBoundsMargin);
+	for (const NavPolygon& polygon : myPolygons)
+	{
+		Math::Vector3f boundsMin = polygon.vertexPositions[0];
+		Math::Vector3f boundsMax = polygon.vertexPositions[0];
+		for (const Math::Vector3f& vertex : polygon.vertexPositions)
+		{
+			boundsMin.x = vertex.x < boundsMin.x ? vertex.x : boundsMin.x;
+			boundsMin.y = vertex.y < boundsMin.y ? vertex.y : boundsMin.y;
+			boundsMin.z = vertex.z < boundsMin.z ? vertex.z : boundsMin.z;
+			boundsMax.x = vertex.x > boundsMax.x ? vertex.x : boundsMax.x;
+			boundsMax.y = vertex.y > boundsMax.y ? vertex.y : boundsMax.y;
+			boundsMax.z = vertex.z > boundsMax.z ? vertex.z : boundsMax.z;
+		}
+
+		bounds.emplace_back().InitWithMinAndMax(boundsMin - margin, boundsMax + margin);
+	}
+
+	myPolygonHierarchy.Build(bounds);
+
+	// Impassable nodes are kept, they're skipped when queried.
+	bounds.clear();
+	for (const NavNode& node : myNodes)
+	{
+		bounds.emplace_back().InitWithMinAndMax(node.position, node.position);
+	}
+
+	myNodeHierarchy.Build(bounds);
 }
 
 void NavMesh::SetBoundingBox(Math::Vector3f aCenter, Math::Vector3f aExtents)
@@ -69,117 +285,189 @@ void NavMesh::SnapGameObjectToNavMesh(GameObject& aGameObject)
 
 Math::Vector3f NavMesh::ClampToNavMesh(const Math::Vector3f& aPos) const
 {
-	for (int i = 0; i < (int)myPolygons.size(); ++i)
-	{
-		const NavPolygon& polygon = myPolygons[i];
+	// essentially we offset ray 50 cm upwards, and then have a threshold of 100cm of snapping to closest node downwards
+	// Only polygons below the offset position can be hit, and the first one in order is used.
+	const Math::Vector3f posOffset = aPos + Math::Vector3f(0.0f, 50.0f, 0.0);
+	int hitPolygon = -1;
+	Math::Vector3f hitPoint;
 
-		Math::Plane<float> plane;
-		plane.InitWith3Points(
-			polygon.vertexPositions[0],
-			polygon.vertexPositions[1],
-			polygon.vertexPositions[2]);
+	myPolygonHierarchy.Query([&posOffset](const Math::AABB3D<float>& aBounds)
+		{
+			return IsInsideHorizontally(posOffset, aBounds) && aBounds.GetMin().y <= posOffset.y;
+		},
+		[this, &posOffset, &hitPolygon, &hitPoint](uint32_t aPolygon)
+		{
+			const int polygonIndex = static_cast<int>(aPolygon);
+			if (hitPolygon >= 0 && polygonIndex > hitPolygon) return;
 
-		// essentially we offset ray 50 cm upwards, and then have a threshold of 100cm of snapping to closest node downwards
+			const NavPolygon& polygon = myPolygons[polygonIndex];
 
-		Math::Vector3f posOffset = aPos + Math::Vector3f(0.0f, 50.0f, 0.0);
-		Math::Vector3f polyIntersectionPoint;
-		bool polyIntersection = Math::IntersectionPlaneRay(plane, Math::Ray<float>(posOffset, Math::Vector3f(0, -1.0f, 0)), polyIntersectionPoint);
+			Math::Plane<float> plane;
+			plane.InitWith3Points(
+				polygon.vertexPositions[0],
+				polygon.vertexPositions[1],
+				polygon.vertexPositions[2]);
 
-		if (polyIntersection &&  IsPointInsidePolygon(myPolygons[i], polyIntersectionPoint))
-		{
-			return polyIntersectionPoint;
-		}
-	}
+			Math::Vector3f polyIntersectionPoint;
+			bool polyIntersection = Math::IntersectionPlaneRay(plane, Math::Ray<float>(posOffset, Math::Vector3f(0, -1.0f, 0)), polyIntersectionPoint);
 
-	Math::Vector3f closestPoint = aPos;
-	float closestPointDist = FLT_MAX;
+			if (polyIntersection && IsPointInsidePolygon(polygon, polyIntersectionPoint))
+			{
+				hitPolygon = polygonIndex;
+				hitPoint = polyIntersectionPoint;
+			}
+		});
 
-	for (int i = 0; i < (int)myPolygons.size(); ++i)
+	if (hitPolygon >= 0)
 	{
-		const NavPolygon& polygon = myPolygons[i];
+		return hitPoint;
+	}
 
-		for (int vertexIndex = 0; vertexIndex < polygon.vertexPositions.size(); ++vertexIndex)
-		{
-			int nextIndex = vertexIndex + 1 >= polygon.vertexPositions.size() ? 0 : vertexIndex + 1;
-			const Math::Vector3f& vertexPos1 = polygon.vertexPositions[vertexIndex];
-			const Math::Vector3f& vertexPos2 = polygon.vertexPositions[nextIndex];
+	ClosestEdgePoint closest;
+	closest.point = aPos;
 
-			const auto point = Math::Vector3f::ClosestPointOnSegment(vertexPos1, vertexPos2, aPos);
-			const float dist = (aPos - point).LengthSqr();
+	myPolygonHierarchy.Query([&aPos, &closest](const Math::AABB3D<float>& aBounds)
+		{
+			return GetDistanceSqr(aPos, aBounds) <= closest.distanceSqr;
+		},
+		[this, &aPos, &closest](uint32_t aPolygon)
+		{
+			const NavPolygon& polygon = myPolygons[aPolygon];
 
-			if (dist < closestPointDist)
+			for (int vertexIndex = 0; vertexIndex < polygon.vertexPositions.size(); ++vertexIndex)
 			{
-				closestPoint = point;
-				closestPointDist = dist;
+				int nextIndex = vertexIndex + 1 >= polygon.vertexPositions.size() ? 0 : vertexIndex + 1;
+				const Math::Vector3f& vertexPos1 = polygon.vertexPositions[vertexIndex];
+				const Math::Vector3f& vertexPos2 = polygon.vertexPositions[nextIndex];
+
+				const auto point = Math::Vector3f::ClosestPointOnSegment(vertexPos1, vertexPos2, aPos);
+				closest.Consider(point, (aPos - point).LengthSqr(), static_cast<int>(aPolygon));
 			}
-		}
-	}
+		});
 
-	return closestPoint;
+	return closest.point;
 }
 
 Math::Vector3f NavMesh::ClampToNearestEdge(const Math::Vector3f& aStart, const Math::Vector3f& aEnd) const
 {
-	Math::Vector3f closestPoint;
-	float closestPointDist = FLT_MAX;
+	ClosestEdgePoint closest;
 
-	for (int i = 0; i < (int)myPolygons.size(); ++i)
-	{
-		const NavPolygon& polygon = myPolygons[i];
-
-		for (int vertexIndex = 0; vertexIndex < polygon.vertexPositions.size(); ++vertexIndex)
+	myPolygonHierarchy.Query([&aStart, &aEnd, &closest](const Math::AABB3D<float>& aBounds)
+		{
+			return closest.polygon < 0 || SegmentIntersectsBounds(aStart, aEnd, aBounds, std::sqrt(closest.distanceSqr));
+		},
+		[this, &aStart, &aEnd, &closest](uint32_t aPolygon)
 		{
-			int nextIndex = vertexIndex + 1 >= polygon.vertexPositions.size() ? 0 : vertexIndex + 1;
-			const Math::Vector3f& vertexPos1 = polygon.vertexPositions[vertexIndex];
-			const Math::Vector3f& vertexPos2 = polygon.vertexPositions[nextIndex];
+			const NavPolygon& polygon = myPolygons[aPolygon];
 
-			auto closestPoints = Math::Vector3f::ClosestPointsSegmentSegment(aStart, aEnd, vertexPos1, vertexPos2);
+			for (int vertexIndex = 0; vertexIndex < polygon.vertexPositions.size(); ++vertexIndex)
+			{
+				int nextIndex = vertexIndex + 1 >= polygon.vertexPositions.size() ? 0 : vertexIndex + 1;
+				const Math::Vector3f& vertexPos1 = polygon.vertexPositions[vertexIndex];
+				const Math::Vector3f& vertexPos2 = polygon.vertexPositions[nextIndex];
 
-			Math::Vector3f point1 = std::get<0>(closestPoints);
-			Math::Vector3f point2 = std::get<1>(closestPoints);
-			const float dist = (point1 - point2).LengthSqr();
+				auto closestPoints = Math::Vector3f::ClosestPointsSegmentSegment(aStart, aEnd, vertexPos1, vertexPos2);
 
-			if (dist < closestPointDist)
-			{
-				closestPoint = point2;
-				closestPointDist = dist;
+				Math::Vector3f point1 = std::get<0>(closestPoints);
+				Math::Vector3f point2 = std::get<1>(closestPoints);
+				closest.Consider(point2, (point1 - point2).LengthSqr(), static_cast<int>(aPolygon));
 			}
-		}
-	}
+		});
 
-	return closestPoint;
+	return closest.point;
 }
 
-// Should be split into a step-function to allow for time-slicing & threading.
 NavMeshPath NavMesh::FindPath(Math::Vector3f aStartingPos, Math::Vector3f aEndPos)
 {
-	std::vector<Math::Vector3f> worldPath;
+	PathSearch search;
+	search.startingPos = aStartingPos;
+	search.endPos = aEndPos;
+
+	unsigned budget = UINT_MAX;
+	while (!AdvancePathSearch(search, budget)) {}
 
-	if (CanPathStraight(aStartingPos, aEndPos))
+	return FinishPathSearch(search, budget);
+}
+
+PathRequestID NavMesh::RequestPath(Math::Vector3f aStartingPos, Math::Vector3f aEndPos, PathCallback aCallback, int aPriority)
+{
+	PathRequest& request = myPathRequests.emplace_back();
+	request.id = myNextPathRequestID++;
+	request.priority = aPriority;
+	request.callback = std::move(aCallback);
+	request.search.startingPos = aStartingPos;
+	request.search.endPos = aEndPos;
+
+	if (myNextPathRequestID == InvalidPathRequest)
 	{
-		worldPath.emplace_back(ClampToNavMesh(aStartingPos));
-		worldPath.emplace_back(ClampToNavMesh(aEndPos));
-		return NavMeshPath(std::move(worldPath));
+		myNextPathRequestID++;
 	}
 
-	int startIndex = GetClosestPolygon(aStartingPos); // can be on own thread
-	int endIndex = GetClosestPolygon(aEndPos); // can be on own thread
+	return request.id;
+}
 
-	// Wait for results before executing
-	std::vector<int> shortestNodePath = GetShortestNodePath(startIndex, endIndex);
+void NavMesh::CancelPathRequest(PathRequestID aRequest)
+{
+	std::erase_if(myPathRequests, [aRequest](const PathRequest& aPathRequest) { return aPathRequest.id == aRequest; });
+	myFinishedPaths.erase(aRequest);
+}
 
-	if (shortestNodePath.empty())
+const PathRequestState NavMesh::GetPathRequestState(PathRequestID aRequest) const
+{
+	if (myFinishedPaths.contains(aRequest)) return PathRequestState::Ready;
+
+	for (const PathRequest& request : myPathRequests)
 	{
-		return NavMeshPath();
+		if (request.id == aRequest) return PathRequestState::Pending;
 	}
 
-	worldPath = FunnelPath(aStartingPos, aEndPos, shortestNodePath);
-	if (!worldPath.empty())
+	return PathRequestState::None;
+}
+
+const bool NavMesh::TakePath(PathRequestID aRequest, NavMeshPath& outPath)
+{
+	auto finishedPath = myFinishedPaths.find(aRequest);
+	if (finishedPath == myFinishedPaths.end()) return false;
+
+	outPath = std::move(finishedPath->second);
+	myFinishedPaths.erase(finishedPath);
+	return true;
+}
+
+void NavMesh::UpdatePathRequests(unsigned aMaxSearchSteps)
+{
+	unsigned budget = aMaxSearchSteps;
+	while (budget > 0 && !myPathRequests.empty())
 	{
-		return NavMeshPath(std::move(worldPath));
-	}
+		// Searches that were interrupted by a more urgent request keep what they've done so far.
+		size_t next = 0;
+		for (size_t i = 1; i < myPathRequests.size(); i++)
+		{
+			const PathRequest& request = myPathRequests[i];
+			const PathRequest& best = myPathRequests[next];
+			if (request.priority > best.priority || (request.priority == best.priority && request.id < best.id))
+			{
+				next = i;
+			}
+		}
 
-	return NavMeshPath();
+		if (!AdvancePathSearch(myPathRequests[next].search, budget)) continue;
+
+		// Taken out before the callback, which may request or cancel paths.
+		PathRequest request = std::move(myPathRequests[next]);
+		myPathRequests.erase(myPathRequests.begin() + next);
+
+		NavMeshPath path = FinishPathSearch(request.search, budget);
+
+		if (request.callback)
+		{
+			request.callback(request.id, path);
+		}
+		else
+		{
+			myFinishedPaths[request.id] = std::move(path);
+		}
+	}
 }
 
 const bool NavMesh::RayCast(Math::Ray<float> aRay, Math::Vector3f& outHitPoint, bool aClampToNavMesh) const
@@ -193,25 +481,31 @@ const bool NavMesh::RayCast(Math::Ray<float> aRay, Math::Vector3f& outHitPoint,
 	}
 
 	// https://gdbooks.gitbooks.io/3dcollisions/content/Chapter4/point_in_triangle.html
+	// Ties go to the lowest polygon index, like going through them in order would.
 	float closestPolygon = FLT_MAX;
+	int closestPolygonIndex = -1;
 	bool hitNavMesh = false;
-	for (auto& polygon : myPolygons)
-	{
-		Math::Plane<float> polygonPlane(polygon.vertexPositions[0], polygon.vertexPositions[1], polygon.vertexPositions[2]);
-
-		Math::Vector3f polyIntersectionPoint;
-		bool polyIntersection = Math::IntersectionPlaneRay(polygonPlane, aRay, polyIntersectionPoint);
-		float intersectionDistance = polyIntersectionPoint.LengthSqr();
-		if (polyIntersection && IsPointInsidePolygon(polygon, polyIntersectionPoint))
+	myPolygonHierarchy.Query([&aRay](const Math::AABB3D<float>& aBounds) { return Math::IntersectionAABBRay(aBounds, aRay); },
+		[this, &aRay, &outHitPoint, &closestPolygon, &closestPolygonIndex, &hitNavMesh](uint32_t aPolygon)
 		{
-			if (intersectionDistance < closestPolygon)
+			const NavPolygon& polygon = myPolygons[aPolygon];
+			Math::Plane<float> polygonPlane(polygon.vertexPositions[0], polygon.vertexPositions[1], polygon.vertexPositions[2]);
+
+			Math::Vector3f polyIntersectionPoint;
+			bool polyIntersection = Math::IntersectionPlaneRay(polygonPlane, aRay, polyIntersectionPoint);
+			float intersectionDistance = polyIntersectionPoint.LengthSqr();
+			if (polyIntersection && IsPointInsidePolygon(polygon, polyIntersectionPoint))
 			{
-				outHitPoint = polyIntersectionPoint;
-				closestPolygon = intersectionDistance;
-				hitNavMesh = true;
+				const int polygonIndex = static_cast<int>(aPolygon);
+				if (intersectionDistance < closestPolygon || (intersectionDistance == closestPolygon && polygonIndex < closestPolygonIndex))
+				{
+					outHitPoint = polyIntersectionPoint;
+					closestPolygon = intersectionDistance;
+					closestPolygonIndex = polygonIndex;
+					hitNavMesh = true;
+				}
 			}
-		}
-	}
+		});
 
 	if (!hitNavMesh && aClampToNavMesh)
 	{
@@ -265,26 +559,39 @@ const bool NavMesh::IsGoalInSameOrNeighbouringPolygon(int aStartPolyIndex, int a
 	return hasConnection;
 }
 
-std::vector<int> NavMesh::GetShortestNodePath(int aStartingNode, int aEndNode) const
+const bool NavMesh::AdvancePathSearch(PathSearch& aSearch, unsigned& inoutBudget) const
 {
-	std::vector<AStarNode> astarNodes;
-	astarNodes.resize(myNodes.size());
+	if (!aSearch.hasStarted)
+	{
+		aSearch.hasStarted = true;
 
-	int startIndex = aStartingNode;
-	int endIndex = aEndNode;
+		unsigned testedPolygons = 0;
+		aSearch.canPathStraight = CanPathStraight(aSearch.startingPos, aSearch.endPos, &testedPolygons);
+		testedPolygons = testedPolygons > 0 ? testedPolygons : 1;
+		inoutBudget -= testedPolygons < inoutBudget ? testedPolygons : inoutBudget;
+		if (aSearch.canPathStraight)
+		{
+			return true;
+		}
 
-	bool foundPath = false;
-	std::priority_queue<std::pair<float, int>, std::vector<std::pair<float, int>>, std::greater<std::pair<float, int>>> nodeHeap;
+		aSearch.startIndex = GetClosestPolygon(aSearch.startingPos);
+		aSearch.endIndex = GetClosestPolygon(aSearch.endPos);
+		aSearch.astarNodes.resize(myNodes.size());
+		aSearch.nodeHeap.push(std::make_pair(0.0f, aSearch.startIndex));
+	}
 
-	nodeHeap.push(std::make_pair(0.0f, startIndex));
+	const int endIndex = aSearch.endIndex;
+	std::vector<AStarNode>& astarNodes = aSearch.astarNodes;
+	auto& nodeHeap = aSearch.nodeHeap;
 
-	while (!nodeHeap.empty() || !foundPath)
+	while (inoutBudget > 0)
 	{
 		if (nodeHeap.empty())
 		{
-			break;
+			return true;
 		}
 
+		inoutBudget--;
 		int currentNodeIndex = nodeHeap.top().second;
 		nodeHeap.pop();
 
@@ -296,10 +603,11 @@ std::vector<int> NavMesh::GetShortestNodePath(int aStartingNode, int aEndNode) c
 		pathNode.hasBeenChecked = true;
 		pathNode.currentDistance = 0;
 
+		// Checked nodes never get a new predecessor, so the path to the end can't change after this.
 		if (currentNodeIndex == endIndex)
 		{
-			foundPath = true;
-			continue;
+			aSearch.foundPath = true;
+			return true;
 		}
 
 		for (int i = 0; i < static_cast<int>(myNodes[currentNodeIndex].portals.size()); i++)
@@ -329,58 +637,96 @@ std::vector<int> NavMesh::GetShortestNodePath(int aStartingNode, int aEndNode) c
 		}
 	}
 
-	std::vector<int> shortestPath;
+	return false;
+}
+
+NavMeshPath NavMesh::FinishPathSearch(PathSearch& aSearch, unsigned& inoutBudget)
+{
+	auto spendBudget = [&inoutBudget](size_t aSteps)
+		{
+			inoutBudget -= aSteps < inoutBudget ? static_cast<unsigned>(aSteps) : inoutBudget;
+		};
+
+	std::vector<Math::Vector3f> worldPath;
 
-	if (foundPath)
+	if (aSearch.canPathStraight)
 	{
-		int pathNodeIndex = endIndex;
+		spendBudget(2);
+		worldPath.emplace_back(ClampToNavMesh(aSearch.startingPos));
+		worldPath.emplace_back(ClampToNavMesh(aSearch.endPos));
+		return NavMeshPath(std::move(worldPath));
+	}
 
-		while (astarNodes[pathNodeIndex].predecessor >= 0)
-		{
-			shortestPath.push_back(pathNodeIndex);
-			pathNodeIndex = astarNodes[pathNodeIndex].predecessor;
-		}
+	if (!aSearch.foundPath)
+	{
+		spendBudget(1);
+		return NavMeshPath();
+	}
 
-		shortestPath.push_back(startIndex);
+	std::vector<int> shortestNodePath;
+	int pathNodeIndex = aSearch.endIndex;
+
+	while (aSearch.astarNodes[pathNodeIndex].predecessor >= 0)
+	{
+		shortestNodePath.push_back(pathNodeIndex);
+		pathNodeIndex = aSearch.astarNodes[pathNodeIndex].predecessor;
 	}
 
-	std::reverse(shortestPath.begin(), shortestPath.end());
+	shortestNodePath.push_back(aSearch.startIndex);
+	std::reverse(shortestNodePath.begin(), shortestNodePath.end());
+
+	// The funnel goes through the portals between the nodes and clamps every point it puts in the path.
+	worldPath = FunnelPath(aSearch.startingPos, aSearch.endPos, shortestNodePath);
+	spendBudget(shortestNodePath.size() + worldPath.size());
+	if (!worldPath.empty())
+	{
+		return NavMeshPath(std::move(worldPath));
+	}
 
-	return shortestPath;
+	return NavMeshPath();
 }
 
 const int NavMesh::GetClosestNode(const Math::Vector3f& aPosition) const
 {
-	// Needs to be optimized lol
-
+	// Ties go to the lowest index, like going through the nodes in order would.
 	int nodeIndex = 0;
 	float smallestDiff = FLT_MAX;
 
-	for (int i = 0; i < static_cast<int>(myNodes.size()); i++)
-	{
-		if (!myNodes[i].isPassable) continue;
-
-		float length = (myNodes[i].position - aPosition).LengthSqr();
-		if (length < smallestDiff)
+	myNodeHierarchy.Query([&aPosition, &smallestDiff](const Math::AABB3D<float>& aBounds)
 		{
-			smallestDiff = length;
-			nodeIndex = i;
-		}
-	}
+			return GetDistanceSqr(aPosition, aBounds) <= smallestDiff;
+		},
+		[this, &aPosition, &nodeIndex, &smallestDiff](uint32_t aNode)
+		{
+			const int i = static_cast<int>(aNode);
+			if (!myNodes[i].isPassable) return;
+
+			float length = (myNodes[i].position - aPosition).LengthSqr();
+			if (length < smallestDiff || (length == smallestDiff && i < nodeIndex))
+			{
+				smallestDiff = length;
+				nodeIndex = i;
+			}
+		});
 
 	return nodeIndex;
 }
 
 const int NavMesh::GetClosestPolygon(const Math::Vector3f& aPosition) const
 {
-	int polyIndex = 0;
-	for (auto& poly : myPolygons)
-	{
-		if (IsPointInsidePolygon(poly, aPosition)) return polyIndex;
-		polyIndex++;
-	}
+	// The first polygon in order that contains the point. Only ones straight above or below it can.
+	int polyIndex = -1;
+	myPolygonHierarchy.Query([&aPosition](const Math::AABB3D<float>& aBounds) { return IsInsideHorizontally(aPosition, aBounds); },
+		[this, &aPosition, &polyIndex](uint32_t aPolygon)
+		{
+			const int i = static_cast<int>(aPolygon);
+			if ((polyIndex < 0 || i < polyIndex) && IsPointInsidePolygon(myPolygons[i], aPosition))
+			{
+				polyIndex = i;
+			}
+		});
 
-	return GetClosestNode(aPosition);
+	return polyIndex >= 0 ? polyIndex : GetClosestNode(aPosition);
 }
 
 const Math::Vector3f NavMesh::GetClosestPointInNavMesh(const Math::Vector3f& aPosition) const
@@ -544,13 +890,9 @@ std::vector<Math::Vector3f> NavMesh::PathStraight(Math::Vector3f aStartingPos, M
 	int intersectedPortals = 0;
 	for (auto& edge : intersectedEdges)
 	{
-		for (auto& portal : myPortals)
+		if (myPortalEdges.contains({ edge[0], edge[1] }))
 		{
-			if (portal.IsSameEdge(edge[0], edge[1]))
-			{
-				intersectedPortals++;
-				break;
-			}
+			intersectedPortals++;
 		}
 	}
 
@@ -609,7 +951,7 @@ std::vector<Math::Vector3f> NavMesh::PathStraight(Math::Vector3f aStartingPos, M
 	return result;
 }
 
-const bool NavMesh::CanPathStraight(const Math::Vector3f& aStartingPos, const Math::Vector3f& aEndPos) const
+const bool NavMesh::CanPathStraight(const Math::Vector3f& aStartingPos, const Math::Vector3f& aEndPos, unsigned* outTestedPolygons) const
 {
 	if (IsGoalInSameOrNeighbouringPolygon(aStartingPos, aEndPos)) return true;
 
@@ -620,37 +962,40 @@ const bool NavMesh::CanPathStraight(const Math::Vector3f& aStartingPos, const Ma
 
 	std::vector<std::array<Math::Vector3f, 2>> intersectedEdges;
 
-
-	for (auto& polygon : myPolygons)
-	{
-		for (int vertexIndex = 0; vertexIndex < polygon.vertexPositions.size(); ++vertexIndex)
+	// Only the polygons close enough to the line can have edges within the tolerance.
+	constexpr float tolerance = 10.0f;
+	myPolygonHierarchy.Query([&aStartingPos, &aEndPos, tolerance](const Math::AABB3D<float>& aBounds)
 		{
-			int nextIndex = vertexIndex + 1 >= polygon.vertexPositions.size() ? 0 : vertexIndex + 1;
-			const Math::Vector3f& vertexPos1 = polygon.vertexPositions[vertexIndex];
-			const Math::Vector3f& vertexPos2 = polygon.vertexPositions[nextIndex];
-			auto closestPoints = Math::Vector3f::ClosestPointsSegmentSegment(aStartingPos, aEndPos, vertexPos1, vertexPos2);
-			float tolerance = 10.0f;
-			Math::Vector3f point1 = std::get<0>(closestPoints);
-			Math::Vector3f point2 = std::get<1>(closestPoints);
-			if ((point1 - point2).LengthSqr() < tolerance)
+			return SegmentIntersectsBounds(aStartingPos, aEndPos, aBounds, std::sqrt(tolerance));
+		},
+		[this, &aStartingPos, &aEndPos, &intersectedEdges, tolerance, outTestedPolygons](uint32_t aPolygon)
+		{
+			if (outTestedPolygons) (*outTestedPolygons)++;
+
+			const NavPolygon& polygon = myPolygons[aPolygon];
+			for (int vertexIndex = 0; vertexIndex < polygon.vertexPositions.size(); ++vertexIndex)
 			{
-				intersectedEdges.push_back({ vertexPos1, vertexPos2 });
+				int nextIndex = vertexIndex + 1 >= polygon.vertexPositions.size() ? 0 : vertexIndex + 1;
+				const Math::Vector3f& vertexPos1 = polygon.vertexPositions[vertexIndex];
+				const Math::Vector3f& vertexPos2 = polygon.vertexPositions[nextIndex];
+				auto closestPoints = Math::Vector3f::ClosestPointsSegmentSegment(aStartingPos, aEndPos, vertexPos1, vertexPos2);
+				Math::Vector3f point1 = std::get<0>(closestPoints);
+				Math::Vector3f point2 = std::get<1>(closestPoints);
+				if ((point1 - point2).LengthSqr() < tolerance)
+				{
+					intersectedEdges.push_back({ vertexPos1, vertexPos2 });
+				}
 			}
-		}
-	}
+		});
 
 	if (intersectedEdges.empty()) return false;
 
 	int intersectedPortals = 0;
 	for (auto& edge : intersectedEdges)
 	{
-		for (auto& portal : myPortals)
+		if (myPortalEdges.contains({ edge[0], edge[1] }))
 		{
-			if (portal.IsSameEdge(edge[0], edge[1]))
-			{
-				intersectedPortals++;
-				break;
-			}
+			intersectedPortals++;
 		}
 	}
 
@@ -4,20 +4,47 @@
 #include "NavPortal.h"
 #include "Math/AABB3D.hpp"
 #include "Math/Ray.hpp"
+#include "Math/BoundingVolumeHierarchy.hpp"
+#include "NavMeshPath.h"
+
+#include <queue>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "DebugDrawer/DebugLine.hpp"
 
-class NavMeshPath;
 class GameObject;
 
 class NavMesh
 {
 public:
 	void Init(std::vector<NavNode> aNavNodeList, std::vector<NavPolygon> aNavPolygonList, std::vector<NavPortal> aNavPortalList);
+	// A portal from every polygon to every other polygon it shares two vertices with, ordered by the first polygon and then
+	// the second. The cost is the distance between the nodes with the same indices as the polygons.
+	static std::vector<NavPortal> CreatePortals(const std::vector<NavPolygon>& aNavPolygonList, const std::vector<NavNode>& aNavNodeList);
 	void SetBoundingBox(Math::Vector3f aCenter, Math::Vector3f aExtents);
 	const Math::AABB3D<float>& GetBoundingBox() const { return myBoundingBox; }
 
 	NavMeshPath FindPath(Math::Vector3f aStartingPos, Math::Vector3f aEndPos);
+
+	// Paths can also be requested and found a bit at a time by UpdatePathRequests, which has to be called on the main
+	// thread. The scene handler calls it every simulation step for the navmeshes the active scene's agents use, see
+	// NavMeshAgent::UpdatePathRequests, other users call it themselves. Higher priorities are searched first, then the
+	// oldest requests. Finished paths are sent to the callback from UpdatePathRequests, or kept for TakePath if there is
+	// none. The paths are the same ones FindPath gives.
+	PathRequestID RequestPath(Math::Vector3f aStartingPos, Math::Vector3f aEndPos, PathCallback aCallback = nullptr, int aPriority = 0);
+	void CancelPathRequest(PathRequestID aRequest);
+	const PathRequestState GetPathRequestState(PathRequestID aRequest) const;
+	// Moves a Ready path to outPath and forgets the request, returns false if it isn't Ready.
+	const bool TakePath(PathRequestID aRequest, NavMeshPath& outPath);
+	// Searches requested paths for up to aMaxSearchSteps steps, where a step is a node expanded, a polygon tested by the
+	// straight line check, or a node or point of a finished path turned into the path. Neither the straight line check nor
+	// finishing a path is split up, so a long one can go over.
+	void UpdatePathRequests(unsigned aMaxSearchSteps = DefaultSearchStepsPerUpdate);
+	const size_t GetPendingPathRequestCount() const { return myPathRequests.size(); }
+
+	static constexpr unsigned DefaultSearchStepsPerUpdate = 2000;
+
 	void SnapGameObjectToNavMesh(GameObject& aGameObject);
 	Math::Vector3f ClampToNavMesh(const Math::Vector3f& aPos) const;
 	Math::Vector3f ClampToNearestEdge(const Math::Vector3f& aStart, const Math::Vector3f& aEnd) const;
@@ -28,6 +55,11 @@ public:
 	void DrawBoundingBox();
 
 private:
+	// Polygon bounds are grown a bit, so points right on an edge are still inside them after rounding.
+	static constexpr float PolygonBoundsMargin = 1.0f;
+
+	void BuildSpatialIndex();
+
 	const bool IsGoalInSameOrNeighbouringPolygon(Math::Vector3f aStartingPos, Math::Vector3f aEndPos) const;
 	const bool IsGoalInSameOrNeighbouringPolygon(int aStartPolyIndex, int aEndPolyIndex, Math::Vector3f aEndPos) const;
 	const int GetClosestNode(const Math::Vector3f& aPosition) const;
@@ -36,18 +68,20 @@ private:
 	const bool IsPointInsidePolygon(NavPolygon aPolygon, Math::Vector3f aPosition) const;
 	const bool NodesAreConnected(int aNodeIndexOne, int aNodeIndexTwo, int& inoutPortalIndex) const;
 
-	std::vector<int> GetShortestNodePath(int aStartingNode, int aEndNode) const;
 	std::vector<Math::Vector3f> ConvertPathIndexToWorldPos(std::vector<int> aPath);
 
 	void ShortenEndNodes(const Math::Vector3f& aStartingPos, const Math::Vector3f& aEndPos, std::vector<Math::Vector3f>& inoutWorldPath);
 	std::vector<Math::Vector3f> PathStraight(Math::Vector3f aStartingPos, Math::Vector3f aEndPos, const std::vector<int>& aNavNodePath) const;
-	const bool CanPathStraight(const Math::Vector3f& aStartingPos, const Math::Vector3f& aEndPos) const;
+	const bool CanPathStraight(const Math::Vector3f& aStartingPos, const Math::Vector3f& aEndPos, unsigned* outTestedPolygons = nullptr) const;
 	std::vector<Math::Vector3f> FunnelPath(const Math::Vector3f& aStartingPos, const Math::Vector3f& aEndPos, const std::vector<int>& aNavNodePath);
 
 	std::vector<NavNode> myNodes;
 	std::vector<NavPolygon> myPolygons;
 	std::vector<NavPortal> myPortals;
 	Math::AABB3D<float> myBoundingBox;
+	// Built in Init, so the closest polygon, node and edge queries only test the ones nearby.
+	Math::BoundingVolumeHierarchy<float> myPolygonHierarchy;
+	Math::BoundingVolumeHierarchy<float> myNodeHierarchy;
 
 	struct AStarNode
 	{
@@ -55,4 +89,55 @@ private:
 		int predecessor = -1;
 		bool hasBeenChecked = false;
 	};
+
+	// A portal's edge, which is the same edge the other way around.
+	struct PortalEdge
+	{
+		Math::Vector3f first;
+		Math::Vector3f second;
+
+		bool operator==(const PortalEdge& aOther) const
+		{
+			return (first == aOther.first && second == aOther.second) || (first == aOther.second && second == aOther.first);
+		}
+	};
+
+	struct PortalEdgeHash
+	{
+		size_t operator()(const PortalEdge& aEdge) const;
+	};
+
+	// Every portal's edge, for checking whether an edge is a portal without going through them all.
+	std::unordered_set<PortalEdge, PortalEdgeHash> myPortalEdges;
+
+	// An A* search between the polygons closest to two positions, which can be stopped and continued.
+	struct PathSearch
+	{
+		Math::Vector3f startingPos;
+		Math::Vector3f endPos;
+		int startIndex = -1;
+		int endIndex = -1;
+		bool hasStarted = false;
+		bool canPathStraight = false;
+		bool foundPath = false;
+		std::vector<AStarNode> astarNodes;
+		std::priority_queue<std::pair<float, int>, std::vector<std::pair<float, int>>, std::greater<std::pair<float, int>>> nodeHeap;
+	};
+
+	struct PathRequest
+	{
+		PathRequestID id = InvalidPathRequest;
+		int priority = 0;
+		PathCallback callback;
+		PathSearch search;
+	};
+
+	// Takes the steps it uses off inoutBudget. Returns true when the search is done, found or not.
+	const bool AdvancePathSearch(PathSearch& aSearch, unsigned& inoutBudget) const;
+	// Takes the steps it uses off inoutBudget as well, and finishes the path even if the budget runs out.
+	NavMeshPath FinishPathSearch(PathSearch& aSearch, unsigned& inoutBudget);
+
+	std::vector<PathRequest> myPathRequests;
+	std::unordered_map<PathRequestID, NavMeshPath> myFinishedPaths;
+	PathRequestID myNextPathRequestID = 1;
 };
\ No newline at end of file
@@ -1,7 +1,25 @@
 #pragma once
 #include <vector>
+#include <cstdint>
+#include <functional>
 #include "Math/Vector.hpp"
 
+class NavMeshPath;
+
+// Ticket for a path requested from a NavMesh, 0 is never handed out.
+using PathRequestID = uint32_t;
+constexpr PathRequestID InvalidPathRequest = 0;
+
+enum class PathRequestState : uint8_t
+{
+	// Unknown, cancelled, or already taken or sent to its callback.
+	None,
+	Pending,
+	// Found and waiting to be taken with NavMesh::TakePath.
+	Ready
+};
+
+using PathCallback = std::function<void(const PathRequestID aRequest, const NavMeshPath& aPath)>;
 
 class NavMeshPath
 {
@@ -0,0 +1,49 @@
+#include "Enginepch.h"
+
+#include "DebugDrawer/DebugDrawer.h"
+
+// Nothing is drawn without a graphics engine, debug drawing calls are accepted and dropped.
+
+void DebugDrawer::InitializeDebugDrawer()
+{
+}
+
+void DebugDrawer::DrawObjects()
+{
+}
+
+void DebugDrawer::ClearObjects()
+{
+}
+
+void DebugDrawer::DrawLine(Math::Vector3f, Math::Vector3f, Math::Vector4f)
+{
+}
+
+void DebugDrawer::DrawLine(DebugLine)
+{
+}
+
+void DebugDrawer::DrawCameraFrustum(std::shared_ptr<Camera>, Math::Vector4f)
+{
+}
+
+void DebugDrawer::DrawBoundingBox(Math::AABB3D<float>, Math::Matrix4x4f, Math::Vector4f)
+{
+}
+
+void DebugDrawer::DrawBoundingBox(std::shared_ptr<Model>, Math::Vector4f)
+{
+}
+
+void DebugDrawer::DrawBoundingBox(std::shared_ptr<AnimatedModel>, Math::Vector4f)
+{
+}
+
+void DebugDrawer::DrawBoundingBox(std::shared_ptr<DebugModel>, Math::Vector4f)
+{
+}
+
+void DebugDrawer::DrawBoundingSphere(Math::Sphere<float>, Math::Matrix4x4f, Math::Vector4f)
+{
+}
@@ -0,0 +1,107 @@
+#include "Enginepch.h"
+
+#include "Engine.h"
+#include "Time/Timer.h"
+#include "Time/FixedTimestep.h"
+#include "GlobalEventHandler/GlobalEventHandler.h"
+#include "DebugDrawer/DebugDrawer.h"
+#include "JobSystem/JobSystem.h"
+
+// Engine for FRAGILE_HEADLESS builds, replaces Engine.cpp. There is no window, graphics, input or audio, and no scene
+// handler since scene loading goes through the asset manager; whoever drives the simulation owns its scenes.
+
+static Engine* sInstance = nullptr;
+
+Engine& Engine::Get()
+{
+    assert(sInstance);
+    return *sInstance;
+}
+
+void Engine::Initialize(unsigned aWorkerThreadCount)
+{
+    assert(!sInstance);
+    sInstance = new Engine();
+    LOG(LogGameEngine, Log, "Initializing headless Game Engine...");
+
+    Engine& instance = *sInstance;
+    instance.myTimer = std::make_unique<Timer>();
+    instance.myFixedTimestep = std::make_unique<FixedTimestep>();
+    instance.myGlobalEventHandler = std::make_unique<GlobalEventHandler>();
+    instance.myDebugDrawer = std::make_unique<DebugDrawer>();
+    instance.myJobSystem = std::make_unique<JobSystem>(aWorkerThreadCount);
+
+    instance.myTitle = "FRAGILE Headless";
+    instance.myContentRoot = std::filesystem::current_path();
+
+    LOG(LogGameEngine, Log, "Headless Game Engine initialized with {} worker threads!", instance.myJobSystem->GetWorkerCount());
+}
+
+void Engine::Shutdown()
+{
+    assert(sInstance);
+    delete sInstance;
+    sInstance = nullptr;
+    LOG(LogGameEngine, Log, "Shut down engine!");
+}
+
+void Engine::Prepare()
+{
+    myDebugDrawer->ClearObjects();
+}
+
+void Engine::Update()
+{
+    myTimer->Update();
+    mySimulationStepCount = myFixedTimestep->Advance(myTimer->GetUnscaledDeltaTime());
+}
+
+void Engine::Render()
+{
+}
+
+void Engine::SetFixedTimestep(float aStepsPerSecond, unsigned aMaxStepsPerFrame)
+{
+    myFixedTimestep->SetStepsPerSecond(aStepsPerSecond);
+    myFixedTimestep->SetMaxStepsPerFrame(aMaxStepsPerFrame);
+    myTimer->SetFixedDeltaTime(myFixedTimestep->GetStepTime());
+    LOG(LogGameEngine, Log, "Simulating at {} steps per second (0 is once per frame).", myFixedTimestep->GetStepsPerSecond());
+}
+
+float Engine::GetInterpolationAlpha() const
+{
+    return myFixedTimestep->GetInterpolationAlpha();
+}
+
+const std::filesystem::path& Engine::GetContentRootPath()
+{
+    return myContentRoot;
+}
+
+const std::string& Engine::GetApplicationTitle()
+{
+    return myTitle;
+}
+
+void Engine::SetResolution(float aWidth, float aHeight)
+{
+    myResolution = { aWidth, aHeight };
+}
+
+void Engine::SetWindowSize(float aWidth, float aHeight)
+{
+    myWindowSize = { aWidth, aHeight };
+}
+
+void Engine::SetWindowPos(float aTop, float aLeft)
+{
+    myWindowPos = { aTop, aLeft };
+}
+
+void Engine::ToggleFullscreen(bool aIsFullscreen)
+{
+    myIsFullscreen = aIsFullscreen;
+}
+
+Engine::Engine() = default;
+Engine::~Engine() = default;
@@ -0,0 +1,7 @@
+#pragma once
+
+// PIX only exists on Windows, profiling scopes compile to nothing in headless builds.
+#define PIX_COLOR_INDEX(aIndex) (aIndex)
+#define PIXScopedEvent(...) do {} while (false)
+#define PIXBeginEvent(...) do {} while (false)
+#define PIXEndEvent(...) do {} while (false)
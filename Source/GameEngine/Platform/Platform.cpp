@@ -0,0 +1,12 @@
+#include "Enginepch.h"
+
+#include "Platform.h"
+
+void Platform::ShowErrorMessage(const std::string& aTitle, const std::string& aMessage)
+{
+#ifndef FRAGILE_HEADLESS
+	MessageBoxA(NULL, aMessage.c_str(), aTitle.c_str(), MB_ICONERROR);
+#else
+	std::cerr << aTitle << ": " << aMessage << std::endl;
+#endif
+}
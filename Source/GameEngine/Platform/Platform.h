@@ -0,0 +1,10 @@
+#pragma once
+#include <string>
+
+// The few operating system calls made outside of the window, graphics and audio code, so that code which only
+// needs these can also build headless (see FRAGILE_HEADLESS).
+namespace Platform
+{
+	// Shows a blocking error dialog, headless builds write the message to stderr instead.
+	void ShowErrorMessage(const std::string& aTitle, const std::string& aMessage);
+}
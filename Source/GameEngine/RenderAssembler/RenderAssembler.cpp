@@ -11,6 +11,7 @@
 #include "Math/AABB3D.hpp"
 #include "Math/Intersection3D.hpp"
 #include "Time/Timer.h"
+#include "CommonUtilities/RadixSort.hpp"
 
 #include "ComponentSystem/Scene.h"
 #include "ComponentSystem/GameObject.h"
@@ -36,6 +37,8 @@ void RenderAssembler::RenderScene(Scene& aScene)
 {
 	PIXScopedEvent(PIX_COLOR_INDEX(6), "Renderer Add Render Commands");
 
+	BuildRenderQueue(aScene);
+
 	if (GraphicsEngine::Get().CurrentDebugMode != DebugMode::None)
 	{
 		RenderForward(aScene);
@@ -48,6 +51,92 @@ void RenderAssembler::RenderScene(Scene& aScene)
 	DrawTestUI();
 }
 
+void RenderAssembler::BuildRenderQueue(Scene& aScene)
+{
+	{
+		PIXScopedEvent(PIX_COLOR_INDEX(8), "Build Render Queue");
+		myRenderQueue.clear();
+
+		// Addresses of unloaded resources stay in the map, so it's emptied before it can run out of IDs.
+		if (mySortKeyIDs.size() >= MaxSortKeyIDs / 2)
+		{
+			mySortKeyIDs.clear();
+		}
+
+		const Math::Vector3f camPos = aScene.myMainCamera->GetComponent<Transform>()->GetTranslation(true);
+		const float farPlane = aScene.myMainCamera->GetComponent<Camera>()->GetFarPlane();
+		const float depthScale = farPlane > 0 ? 1.0f / farPlane : 0.0f;
+
+		for (size_t i = 0; i < aScene.myGameObjects.size(); i++)
+		{
+			const std::shared_ptr<GameObject>& gameObject = aScene.myGameObjects[i];
+			if (!gameObject->GetActive()) continue;
+
+			std::shared_ptr<Material> material;
+			if (std::shared_ptr<Model> model = gameObject->GetComponent<Model>())
+			{
+				material = model->GetMaterialOnSlot(0);
+			}
+			else if (std::shared_ptr<AnimatedModel> animModel = gameObject->GetComponent<AnimatedModel>())
+			{
+				material = animModel->GetMaterialOnSlot(0);
+			}
+			else if (std::shared_ptr<InstancedModel> instancedModel = gameObject->GetComponent<InstancedModel>())
+			{
+				material = instancedModel->GetMaterialOnSlot(0);
+			}
+			else
+			{
+				continue;
+			}
+
+			float depth = 0;
+			if (std::shared_ptr<Transform> transform = gameObject->GetComponent<Transform>())
+			{
+				depth = Math::Vector3f(camPos - transform->GetTranslation(true)).Length() * depthScale;
+			}
+
+			RenderQueueEntry& entry = myRenderQueue.emplace_back();
+			entry.sortKey = CreateSortKey(material, depth);
+			entry.gameObjectIndex = static_cast<uint32_t>(i);
+		}
+	}
+
+	PIXScopedEvent(PIX_COLOR_INDEX(8), "Sort Render Queue");
+	Utilities::RadixSort64(myRenderQueue, myRenderQueueScratch, [](const RenderQueueEntry& aEntry) { return aEntry.sortKey; });
+}
+
+uint64_t RenderAssembler::CreateSortKey(const std::shared_ptr<Material>& aMaterial, float aNormalizedDepth)
+{
+	// Opaque:      [63] 0 | [62..48] PSO | [47..32] material | [31..8] depth, front to back
+	// Transparent: [63] 1 | [62..39] depth, back to front | [38..24] PSO | [23..8] material
+	// The low byte is unused, the radix sort skips it.
+	constexpr uint64_t DepthMask = 0xFFFFFF;
+	constexpr uint64_t PSOMask = 0x7FFF;
+	constexpr uint64_t MaterialMask = 0xFFFF;
+
+	std::shared_ptr<PipelineStateObject> pso = aMaterial ? aMaterial->GetPSO() : nullptr;
+	const bool isTransparent = pso && pso->BlendState != nullptr;
+
+	const uint64_t psoID = pso ? GetSortKeyID(pso.get()) & PSOMask : 0;
+	const uint64_t materialID = aMaterial ? GetSortKeyID(aMaterial.get()) & MaterialMask : 0;
+	const float clampedDepth = aNormalizedDepth < 0 ? 0 : (aNormalizedDepth > 1.0f ? 1.0f : aNormalizedDepth);
+	const uint64_t depth = static_cast<uint64_t>(clampedDepth * static_cast<float>(DepthMask));
+
+	if (isTransparent)
+	{
+		return (1ull << 63) | ((DepthMask - depth) << 39) | (psoID << 24) | (materialID << 8);
+	}
+
+	return (psoID << 48) | (materialID << 32) | (depth << 8);
+}
+
+uint16_t RenderAssembler::GetSortKeyID(const void* aResource)
+{
+	assert(mySortKeyIDs.size() < MaxSortKeyIDs && "More PSOs and materials in one frame than fit in a sort key!");
+	return mySortKeyIDs.try_emplace(aResource, static_cast<uint16_t>(mySortKeyIDs.size())).first->second;
+}
+
 void RenderAssembler::RenderForward(Scene& aScene)
 {
 	GraphicsEngine& gfx = GraphicsEngine::Get();
@@ -258,26 +347,27 @@ void RenderAssembler::RenderDeferred(Scene& aScene)
 	gfxList.Enqueue<BeginEvent>("Render Particle Systems");
 	gfxList.Enqueue<SetRenderTarget>(renderTarget, gfx.GetDepthBuffer(), false, false);
 
-	for (auto& gameObject : aScene.myGameObjects)
-	{
-		std::shared_ptr<ParticleSystem> particleSystem = gameObject->GetComponent<ParticleSystem>();
-		if (particleSystem && particleSystem->GetActive())
+	aScene.Each<ParticleSystem, Transform>([](ParticleSystem& aParticleSystem, Transform& aTransform)
 		{
+			if (!aParticleSystem.GetActive()) return;
+
+			aParticleSystem.UploadVertexBuffers();
 			RenderParticles::RenderParticlesData data;
-			data.emitters = particleSystem->GetEmitters();
-			data.transform = gameObject->GetComponent<Transform>()->GetWorldMatrix();
+			data.emitters = aParticleSystem.GetEmitters();
+			data.transform = aTransform.GetWorldMatrix();
 			GraphicsEngine::Get().GetGraphicsCommandList().Enqueue<RenderParticles>(data);
-		}
+		});
 
-		std::shared_ptr<TrailSystem> trailSystem = gameObject->GetComponent<TrailSystem>();
-		if (trailSystem && trailSystem->GetActive())
+	aScene.Each<TrailSystem, Transform>([](TrailSystem& aTrailSystem, Transform& aTransform)
 		{
+			if (!aTrailSystem.GetActive()) return;
+
+			aTrailSystem.UploadVertexBuffers();
 			RenderTrail::TrailData data;
-			data.emitters = trailSystem->GetEmitters();
-			data.transform = gameObject->GetComponent<Transform>()->GetWorldMatrix();
+			data.emitters = aTrailSystem.GetEmitters();
+			data.transform = aTransform.GetWorldMatrix();
 			GraphicsEngine::Get().GetGraphicsCommandList().Enqueue<RenderTrail>(data);
-		}
-	}
+		});
 	gfxList.Enqueue<EndEvent>();
 
 	if (gfx.BloomEnabled)
@@ -365,18 +455,24 @@ void RenderAssembler::RenderDeferredObjects(Scene& aScene, bool aDisableViewCull
 {
 	std::shared_ptr<Camera> renderCamera = aScene.myMainCamera->GetComponent<Camera>();
 
-	for (auto& gameObject : aScene.myGameObjects)
+	if (!aDisableViewCulling)
+	{
+		CullStaticObjects(aScene, renderCamera->GetFrustumPlaneVolume());
+	}
+
+	for (const RenderQueueEntry& entry : myRenderQueue)
 	{
+		const std::shared_ptr<GameObject>& gameObject = aScene.myGameObjects[entry.gameObjectIndex];
 		if (!gameObject->GetActive()) continue;
 
 		std::shared_ptr<Model> model = gameObject->GetComponent<Model>();
 		if (model && model->GetActive())
 		{
-			if (aDisableViewCulling || !model->GetShouldViewcull() || IsInsideFrustum(renderCamera, gameObject->GetComponent<Transform>(), model->GetBoundingBox()))
+			if (aDisableViewCulling || !model->GetShouldViewcull() || IsInsideFrustum(aScene, renderCamera, gameObject->GetComponent<Transform>(), model->GetBoundingBox()))
 			{
 				if (model->GetMaterialOnSlot(0)->GetPSO()->BlendState == nullptr)
 				{
-					UpdateBoundingBox(gameObject);
+					UpdateBoundingBox(aScene, gameObject);
 
 					RenderMesh::RenderMeshData data;
 					data.mesh = model->GetMesh();
@@ -399,11 +495,11 @@ void RenderAssembler::RenderDeferredObjects(Scene& aScene, bool aDisableViewCull
 		std::shared_ptr<AnimatedModel> animModel = gameObject->GetComponent<AnimatedModel>();
 		if (animModel && animModel->GetActive())
 		{
-			if (aDisableViewCulling || !animModel->GetShouldViewcull() || IsInsideFrustum(renderCamera, gameObject->GetComponent<Transform>(), animModel->GetBoundingBox()))
+			if (aDisableViewCulling || !animModel->GetShouldViewcull() || IsInsideFrustum(aScene, renderCamera, gameObject->GetComponent<Transform>(), animModel->GetBoundingBox()))
 			{
 				if (animModel->GetMaterialOnSlot(0)->GetPSO()->BlendState == nullptr)
 				{
-					UpdateBoundingBox(gameObject);
+					UpdateBoundingBox(aScene, gameObject);
 
 					RenderAnimatedMesh::AnimMeshRenderData data;
 					data.mesh = animModel->GetMesh();
@@ -425,11 +521,11 @@ void RenderAssembler::RenderDeferredObjects(Scene& aScene, bool aDisableViewCull
 		std::shared_ptr<InstancedModel> instancedModel = gameObject->GetComponent<InstancedModel>();
 		if (instancedModel && instancedModel->GetActive())
 		{
-			if (aDisableViewCulling || !instancedModel->GetShouldViewcull() || IsInsideFrustum(renderCamera, gameObject->GetComponent<Transform>(), instancedModel->GetBoundingBox()))
+			if (aDisableViewCulling || !instancedModel->GetShouldViewcull() || IsInsideFrustum(aScene, renderCamera, gameObject->GetComponent<Transform>(), instancedModel->GetBoundingBox()))
 			{
 				if (instancedModel->GetMaterialOnSlot(0)->GetPSO()->BlendState == nullptr)
 				{
-					UpdateBoundingBox(gameObject);
+					UpdateBoundingBox(aScene, gameObject);
 
 					RenderInstancedMesh::InstancedMeshRenderData data;
 					data.mesh = instancedModel->GetMesh();
@@ -455,14 +551,20 @@ void RenderAssembler::RenderForwardObjects(Scene& aScene, bool aDisableViewCulli
 {
 	std::shared_ptr<Camera> renderCamera = aScene.myMainCamera->GetComponent<Camera>();
 
-	for (auto& gameObject : aScene.myGameObjects)
+	if (!aDisableViewCulling)
+	{
+		CullStaticObjects(aScene, renderCamera->GetFrustumPlaneVolume());
+	}
+
+	for (const RenderQueueEntry& entry : myRenderQueue)
 	{
+		const std::shared_ptr<GameObject>& gameObject = aScene.myGameObjects[entry.gameObjectIndex];
 		if (!gameObject->GetActive()) continue;
 
 		std::shared_ptr<Model> model = gameObject->GetComponent<Model>();
 		if (model && model->GetActive())
 		{
-			if (aDisableViewCulling || !model->GetShouldViewcull() || IsInsideFrustum(renderCamera, gameObject->GetComponent<Transform>(), model->GetBoundingBox()))
+			if (aDisableViewCulling || !model->GetShouldViewcull() || IsInsideFrustum(aScene, renderCamera, gameObject->GetComponent<Transform>(), model->GetBoundingBox()))
 			{
 				if (model->GetMaterialOnSlot(0)->GetPSO()->BlendState != nullptr)
 				{
@@ -486,7 +588,7 @@ void RenderAssembler::RenderForwardObjects(Scene& aScene, bool aDisableViewCulli
 		std::shared_ptr<AnimatedModel> animModel = gameObject->GetComponent<AnimatedModel>();
 		if (animModel && animModel->GetActive())
 		{
-			if (aDisableViewCulling || !animModel->GetShouldViewcull() || IsInsideFrustum(renderCamera, gameObject->GetComponent<Transform>(), animModel->GetBoundingBox()))
+			if (aDisableViewCulling || !animModel->GetShouldViewcull() || IsInsideFrustum(aScene, renderCamera, gameObject->GetComponent<Transform>(), animModel->GetBoundingBox()))
 			{
 				if (animModel->GetMaterialOnSlot(0)->GetPSO()->BlendState != nullptr)
 				{
@@ -509,7 +611,7 @@ void RenderAssembler::RenderForwardObjects(Scene& aScene, bool aDisableViewCulli
 		std::shared_ptr<InstancedModel> instancedModel = gameObject->GetComponent<InstancedModel>();
 		if (instancedModel && instancedModel->GetActive())
 		{
-			if (aDisableViewCulling || !instancedModel->GetShouldViewcull() || IsInsideFrustum(renderCamera, gameObject->GetComponent<Transform>(), instancedModel->GetBoundingBox()))
+			if (aDisableViewCulling || !instancedModel->GetShouldViewcull() || IsInsideFrustum(aScene, renderCamera, gameObject->GetComponent<Transform>(), instancedModel->GetBoundingBox()))
 			{
 				if (instancedModel->GetMaterialOnSlot(0)->GetPSO()->BlendState != nullptr)
 				{
@@ -806,18 +908,24 @@ void RenderAssembler::QueueDebugGizmos(Scene& aScene, std::shared_ptr<Camera> aR
 
 void RenderAssembler::QueueGameObjects(Scene& aScene, std::shared_ptr<Camera> aRenderCamera, bool aDisableViewCulling, std::shared_ptr<PipelineStateObject> aPSOoverride)
 {
-	for (auto& gameObject : aScene.myGameObjects)
+	if (!aDisableViewCulling)
+	{
+		CullStaticObjects(aScene, aRenderCamera->GetFrustumPlaneVolume());
+	}
+
+	for (const RenderQueueEntry& entry : myRenderQueue)
 	{
+		const std::shared_ptr<GameObject>& gameObject = aScene.myGameObjects[entry.gameObjectIndex];
 		if (!gameObject->GetActive()) continue;
 
 		std::shared_ptr<Model> model = gameObject->GetComponent<Model>();
 		if (model && model->GetActive())
 		{
-			if (aDisableViewCulling || !model->GetShouldViewcull() || IsInsideFrustum(aRenderCamera, gameObject->GetComponent<Transform>(), model->GetBoundingBox()))
+			if (aDisableViewCulling || !model->GetShouldViewcull() || IsInsideFrustum(aScene, aRenderCamera, gameObject->GetComponent<Transform>(), model->GetBoundingBox()))
 			{
 				if (aRenderCamera->gameObject->GetName() == "MainCamera")
 				{
-					UpdateBoundingBox(gameObject);
+					UpdateBoundingBox(aScene, gameObject);
 				}
 				else
 				{
@@ -838,11 +946,11 @@ void RenderAssembler::QueueGameObjects(Scene& aScene, std::shared_ptr<Camera> aR
 		std::shared_ptr<AnimatedModel> animModel = gameObject->GetComponent<AnimatedModel>();
 		if (animModel && animModel->GetActive())
 		{
-			if (aDisableViewCulling || !animModel->GetShouldViewcull() || IsInsideFrustum(aRenderCamera, gameObject->GetComponent<Transform>(), animModel->GetBoundingBox()))
+			if (aDisableViewCulling || !animModel->GetShouldViewcull() || IsInsideFrustum(aScene, aRenderCamera, gameObject->GetComponent<Transform>(), animModel->GetBoundingBox()))
 			{
 				if (aRenderCamera->gameObject->GetName() == "MainCamera")
 				{
-					UpdateBoundingBox(gameObject);
+					UpdateBoundingBox(aScene, gameObject);
 				}
 				else
 				{
@@ -862,11 +970,11 @@ void RenderAssembler::QueueGameObjects(Scene& aScene, std::shared_ptr<Camera> aR
 		std::shared_ptr<InstancedModel> instancedModel = gameObject->GetComponent<InstancedModel>();
 		if (instancedModel && instancedModel->GetActive())
 		{
-			if (aDisableViewCulling || !instancedModel->GetShouldViewcull() || IsInsideFrustum(aRenderCamera, gameObject->GetComponent<Transform>(), instancedModel->GetBoundingBox()))
+			if (aDisableViewCulling || !instancedModel->GetShouldViewcull() || IsInsideFrustum(aScene, aRenderCamera, gameObject->GetComponent<Transform>(), instancedModel->GetBoundingBox()))
 			{
 				if (aRenderCamera->gameObject->GetName() == "MainCamera")
 				{
-					UpdateBoundingBox(gameObject);
+					UpdateBoundingBox(aScene, gameObject);
 				}
 				else
 				{
@@ -888,8 +996,24 @@ void RenderAssembler::QueueGameObjects(Scene& aScene, std::shared_ptr<Camera> aR
 
 void RenderAssembler::QueueGameObjects(Scene& aScene, std::shared_ptr<PointLight> aPointLight, bool aDisableViewCulling, std::shared_ptr<PipelineStateObject> aPSOoverride)
 {
-	for (auto& gameObject : aScene.myGameObjects)
+	if (!aDisableViewCulling)
 	{
+		std::shared_ptr<Transform> pointLightTransform = aPointLight->gameObject->GetComponent<Transform>();
+		std::shared_ptr<Camera> pointLightCam = aPointLight->gameObject->GetComponent<Camera>();
+		if (pointLightTransform && pointLightCam)
+		{
+			CullStaticObjects(aScene, Math::Sphere<float>(pointLightTransform->GetTranslation(), pointLightCam->GetFarPlane()));
+		}
+		else
+		{
+			// Nothing to cull against, don't let static objects use the previous pass' results.
+			myStaticVisibility.clear();
+		}
+	}
+
+	for (const RenderQueueEntry& entry : myRenderQueue)
+	{
+		const std::shared_ptr<GameObject>& gameObject = aScene.myGameObjects[entry.gameObjectIndex];
 		if (!gameObject->GetActive()) continue;
 
 		std::shared_ptr<Model> model = gameObject->GetComponent<Model>();
@@ -897,7 +1021,7 @@ void RenderAssembler::QueueGameObjects(Scene& aScene, std::shared_ptr<PointLight
 		{
 			if (!model->GetCastShadows()) continue;
 
-			if (aDisableViewCulling || !model->GetShouldViewcull() || IsInsideRadius(aPointLight, gameObject->GetComponent<Transform>(), model->GetBoundingBox()))
+			if (aDisableViewCulling || !model->GetShouldViewcull() || IsInsideRadius(aScene, aPointLight, gameObject->GetComponent<Transform>(), model->GetBoundingBox()))
 			{
 				RenderMesh::RenderMeshData data;
 				data.mesh = model->GetMesh();
@@ -915,7 +1039,7 @@ void RenderAssembler::QueueGameObjects(Scene& aScene, std::shared_ptr<PointLight
 		{
 			if (!animModel->GetCastShadows()) continue;
 
-			if (aDisableViewCulling || !animModel->GetShouldViewcull() || IsInsideRadius(aPointLight, gameObject->GetComponent<Transform>(), animModel->GetBoundingBox()))
+			if (aDisableViewCulling || !animModel->GetShouldViewcull() || IsInsideRadius(aScene, aPointLight, gameObject->GetComponent<Transform>(), animModel->GetBoundingBox()))
 			{
 				RenderAnimatedMesh::AnimMeshRenderData data;
 				data.mesh = animModel->GetMesh();
@@ -932,7 +1056,7 @@ void RenderAssembler::QueueGameObjects(Scene& aScene, std::shared_ptr<PointLight
 		{
 			if (!instancedModel->GetCastShadows()) continue;
 
-			if (aDisableViewCulling || !instancedModel->GetShouldViewcull() || IsInsideRadius(aPointLight, gameObject->GetComponent<Transform>(), instancedModel->GetBoundingBox()))
+			if (aDisableViewCulling || !instancedModel->GetShouldViewcull() || IsInsideRadius(aScene, aPointLight, gameObject->GetComponent<Transform>(), instancedModel->GetBoundingBox()))
 			{
 				RenderInstancedMesh::InstancedMeshRenderData data;
 				data.mesh = instancedModel->GetMesh();
@@ -987,43 +1111,90 @@ void RenderAssembler::QueueDebugLines(Scene& aScene)
 	}
 }
 
-bool RenderAssembler::IsInsideFrustum(std::shared_ptr<Camera> aRenderCamera, std::shared_ptr<Transform> aObjectTransform, Math::AABB3D<float> aObjectAABB)
+void RenderAssembler::CullStaticObjects(Scene& aScene, const Math::PlaneVolume<float>& aFrustum)
+{
+	if (!GraphicsEngine::Get().UseViewCulling) return;
+
+	PIXScopedEvent(PIX_COLOR_INDEX(8), "Cull Static Objects");
+	myStaticCullingPass++;
+	myStaticVisibility.resize(aScene.myStaticIndex.GetEntryCount());
+
+	aScene.myStaticIndex.QueryRenderBounds([&aFrustum](const Math::AABB3D<float>& aBounds) { return Math::IntersectionBetweenPlaneVolumeAABB(aFrustum, aBounds); },
+		[this](uint32_t aIndex, const StaticSceneIndex::Entry&) { myStaticVisibility[aIndex] = myStaticCullingPass; });
+}
+
+void RenderAssembler::CullStaticObjects(Scene& aScene, const Math::Sphere<float>& aSphere)
+{
+	if (!GraphicsEngine::Get().UseViewCulling) return;
+
+	PIXScopedEvent(PIX_COLOR_INDEX(8), "Cull Static Objects");
+	myStaticCullingPass++;
+	myStaticVisibility.resize(aScene.myStaticIndex.GetEntryCount());
+
+	aScene.myStaticIndex.QueryRenderBounds([&aSphere](const Math::AABB3D<float>& aBounds) { return Math::IntersectionSphereAABB(aSphere, aBounds); },
+		[this](uint32_t aIndex, const StaticSceneIndex::Entry&) { myStaticVisibility[aIndex] = myStaticCullingPass; });
+}
+
+bool RenderAssembler::GetStaticVisibility(Scene& aScene, const std::shared_ptr<Transform>& aObjectTransform, bool& outIsVisible) const
+{
+	const uint32_t staticIndex = aScene.GetStaticIndexOf(*aObjectTransform->gameObject);
+
+	// Objects indexed after the last cull are tested like moving ones until the next pass.
+	if (staticIndex >= myStaticVisibility.size()) return false;
+
+	outIsVisible = myStaticVisibility[staticIndex] == myStaticCullingPass;
+	return true;
+}
+
+bool RenderAssembler::IsInsideFrustum(Scene& aScene, std::shared_ptr<Camera> aRenderCamera, std::shared_ptr<Transform> aObjectTransform, Math::AABB3D<float> aObjectAABB)
 {
 	if (!GraphicsEngine::Get().UseViewCulling) return true;
 
+	bool isVisible = false;
+	if (GetStaticVisibility(aScene, aObjectTransform, isVisible)) return isVisible;
+
 	return aRenderCamera->GetViewcullingIntersection(aObjectTransform, aObjectAABB);
 }
 
-bool RenderAssembler::IsInsideRadius(std::shared_ptr<PointLight> aPointLight, std::shared_ptr<Transform> aObjectTransform, Math::AABB3D<float> aObjectAABB)
+bool RenderAssembler::IsInsideRadius(Scene& aScene, std::shared_ptr<PointLight> aPointLight, std::shared_ptr<Transform> aObjectTransform, Math::AABB3D<float> aObjectAABB)
 {
 	if (!GraphicsEngine::Get().UseViewCulling) return true;
 
+	bool isVisible = false;
+	if (GetStaticVisibility(aScene, aObjectTransform, isVisible)) return isVisible;
+
 	std::shared_ptr<Transform> pointLightTransform = aPointLight->gameObject->GetComponent<Transform>();
 	std::shared_ptr<Camera> pointLightCam = aPointLight->gameObject->GetComponent<Camera>();
 	if (!pointLightTransform) return true;
 
-	Math::Matrix4x4f objectMatrix = aObjectTransform->GetWorldMatrix();
-
-	if (aObjectTransform->IsScaled())
-	{
-		objectMatrix = objectMatrix.GetInverse();
-	}
-	else
-	{
-		objectMatrix = objectMatrix.GetFastInverse();
-	}
-
 	Math::Sphere<float> sphere(pointLightTransform->GetTranslation(), pointLightCam->GetFarPlane());
-	sphere = sphere.GetSphereinNewSpace(pointLightTransform->GetWorldMatrix() * objectMatrix);
+	sphere = sphere.GetSphereinNewSpace(pointLightTransform->GetWorldMatrix() * aObjectTransform->GetInverseWorldMatrix());
 	return Math::IntersectionSphereAABB(sphere, aObjectAABB);
 }
 
-void RenderAssembler::UpdateBoundingBox(std::shared_ptr<GameObject> aGameObject)
+void RenderAssembler::UpdateBoundingBox(Scene& aScene, std::shared_ptr<GameObject> aGameObject)
 {
 	if (aGameObject->GetComponent<Transform>())
 	{
 		Math::Vector3f bbMin = myVisibleObjectsBB.GetMin();
 		Math::Vector3f bbMax = myVisibleObjectsBB.GetMax();
+
+		// Static objects already have their world space bounds.
+		const uint32_t staticIndex = aScene.GetStaticIndexOf(*aGameObject);
+		if (staticIndex != StaticSceneIndex::InvalidIndex && aScene.myStaticIndex.GetEntry(staticIndex).hasRenderBounds)
+		{
+			const Math::AABB3D<float>& worldBounds = aScene.myStaticIndex.GetEntry(staticIndex).renderBounds;
+
+			bbMin.x = std::fminf(worldBounds.GetMin().x, bbMin.x);
+			bbMax.x = std::fmaxf(worldBounds.GetMax().x, bbMax.x);
+			bbMin.y = std::fminf(worldBounds.GetMin().y, bbMin.y);
+			bbMax.y = std::fmaxf(worldBounds.GetMax().y, bbMax.y);
+			bbMin.z = std::fminf(worldBounds.GetMin().z, bbMin.z);
+			bbMax.z = std::fmaxf(worldBounds.GetMax().z, bbMax.z);
+
+			myVisibleObjectsBB.InitWithMinAndMax(bbMin, bbMax);
+			return;
+		}
 		std::shared_ptr<Transform> objectTransform = aGameObject->GetComponent<Transform>();
 
 		std::shared_ptr<Model> model = aGameObject->GetComponent<Model>();
@@ -1,5 +1,7 @@
 #pragma once
 #include "Math/AABB3D.hpp"
+#include "Math/PlaneVolume.hpp"
+#include "Math/Sphere.hpp"
 
 
 class GameObject;
@@ -8,6 +10,7 @@ class Camera;
 class Transform;
 class PointLight;
 struct PipelineStateObject;
+class Material;
 
 // TEMP
 class Sprite;
@@ -19,10 +22,24 @@ public:
     RenderAssembler();
     ~RenderAssembler();
     void RenderScene(Scene& aScene);
+    // Forgets the sort key IDs handed out so far, call it when PSOs or materials may have been unloaded.
+    void ClearSortKeyIDs() { mySortKeyIDs.clear(); }
 
     // TEMP
     void Init();
 private:
+    // One entry per renderable game object in the scene, sorted on sortKey once per frame. The draw passes walk this
+    // instead of the scene's object list, so draw order is decided here and the scene keeps its own order.
+    struct RenderQueueEntry
+    {
+        uint64_t sortKey = 0;
+        uint32_t gameObjectIndex = 0;
+    };
+
+    void BuildRenderQueue(Scene& aScene);
+    uint64_t CreateSortKey(const std::shared_ptr<Material>& aMaterial, float aNormalizedDepth);
+    uint16_t GetSortKeyID(const void* aResource);
+
     void RenderForward(Scene& aScene);
     void RenderDeferred(Scene& aScene);
     void RenderDeferredObjects(Scene& aScene, bool aDisableViewCulling = false);
@@ -38,12 +55,30 @@ private:
     void QueueGameObjects(Scene& aScene, std::shared_ptr<PointLight> aPointLight, bool aDisableViewCulling = false, std::shared_ptr<PipelineStateObject> aPSOoverride = nullptr);
     void QueueDebugLines(Scene& aScene);
 
-    bool IsInsideFrustum(std::shared_ptr<Camera> aRenderCamera, std::shared_ptr<Transform> aObjectTransform, Math::AABB3D<float> aObjectAABB);
-    bool IsInsideRadius(std::shared_ptr<PointLight> aPointLight, std::shared_ptr<Transform> aObjectTransform, Math::AABB3D<float> aObjectAABB);
+    // Static objects aren't tested one by one. Each pass first finds the visible ones through the scene's static index,
+    // and IsInsideFrustum/IsInsideRadius then only look up the result.
+    void CullStaticObjects(Scene& aScene, const Math::PlaneVolume<float>& aFrustum);
+    void CullStaticObjects(Scene& aScene, const Math::Sphere<float>& aSphere);
+    bool IsInsideFrustum(Scene& aScene, std::shared_ptr<Camera> aRenderCamera, std::shared_ptr<Transform> aObjectTransform, Math::AABB3D<float> aObjectAABB);
+    bool IsInsideRadius(Scene& aScene, std::shared_ptr<PointLight> aPointLight, std::shared_ptr<Transform> aObjectTransform, Math::AABB3D<float> aObjectAABB);
+    // True if the object is in the static index, with outIsVisible set to whether the last CullStaticObjects found it.
+    bool GetStaticVisibility(Scene& aScene, const std::shared_ptr<Transform>& aObjectTransform, bool& outIsVisible) const;
 
-    void UpdateBoundingBox(std::shared_ptr<GameObject> aGameObject);
+    void UpdateBoundingBox(Scene& aScene, std::shared_ptr<GameObject> aGameObject);
     Math::AABB3D<float> myVisibleObjectsBB;
 
+    // Per static index entry, the value of myStaticCullingPass when the entry was last found visible.
+    std::vector<uint32_t> myStaticVisibility;
+    uint32_t myStaticCullingPass = 0;
+
+    std::vector<RenderQueueEntry> myRenderQueue;
+    std::vector<RenderQueueEntry> myRenderQueueScratch;
+    // Small IDs for PSOs and materials so that they fit in a sort key, handed out the first time each one is seen. They're
+    // keyed by address and only compared within one frame's sort, so the map can be cleared between frames at any time.
+    std::unordered_map<const void*, uint16_t> mySortKeyIDs;
+    // As many as the PSO bits of a sort key hold. The map is cleared at the start of a frame once it's half full.
+    static constexpr size_t MaxSortKeyIDs = 0x8000;
+
     // TEMP
     void DrawTestUI();
     std::shared_ptr<Sprite> myTestSprite;
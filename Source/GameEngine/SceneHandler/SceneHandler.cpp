@@ -6,6 +6,7 @@
 #include "CollisionHandler/CollisionHandler.h"
 #include "ComponentSystem/Scene.h"
 #include "ComponentSystem/GameObject.h"
+#include "Pathfinding/Components/NavMeshAgent.h"
 
 #include "Engine.h"
 
@@ -14,6 +15,8 @@ SceneHandler::SceneHandler()
     mySceneLoader = std::make_unique<SceneLoader>();
     myRenderAssembler = std::make_unique<RenderAssembler>();
     myCollisionHandler = std::make_unique<CollisionHandler>();
+    myPrefabRegistry = std::make_unique<PrefabRegistry>();
+    mySceneUpdateMode = SceneUpdateMode::Serial;
 }
 
 SceneHandler::~SceneHandler()
@@ -31,6 +34,7 @@ void SceneHandler::UpdateActiveScene()
 
     myActiveScene->Update();
     myCollisionHandler->TestCollisions(*myActiveScene);
+    NavMeshAgent::UpdatePathRequests(*myActiveScene);
 }
 
 void SceneHandler::RenderActiveScene()
@@ -47,6 +51,7 @@ void SceneHandler::RenderActiveScene()
 void SceneHandler::CreateEmptyScene()
 {
     std::shared_ptr<Scene> newScene = myLoadedScenes.emplace_back(std::make_shared<Scene>());
+    newScene->SetUpdateMode(mySceneUpdateMode);
 
     if (!myActiveScene)
     {
@@ -57,6 +62,7 @@ void SceneHandler::CreateEmptyScene()
 void SceneHandler::LoadScene(const std::string& aSceneFilePath)
 {
     std::shared_ptr<Scene> newScene = myLoadedScenes.emplace_back(std::make_shared<Scene>());
+    newScene->SetUpdateMode(mySceneUpdateMode);
 
     if (!myActiveScene)
     {
@@ -75,6 +81,8 @@ void SceneHandler::UnloadScene(unsigned aSceneIndex)
     }
 
     myLoadedScenes.erase(myLoadedScenes.begin() + aSceneIndex);
+    // The scene's PSOs and materials may be gone now, and new ones could get their addresses.
+    myRenderAssembler->ClearSortKeyIDs();
     LOG(LogSceneHandler, Log, "Unloaded scene with index {}!", aSceneIndex);
 }
 
@@ -83,6 +91,16 @@ void SceneHandler::ChangeActiveScene(unsigned aSceneIndex)
     myActiveScene = myLoadedScenes[aSceneIndex];
 }
 
+void SceneHandler::SetSceneUpdateMode(SceneUpdateMode aUpdateMode)
+{
+    mySceneUpdateMode = aUpdateMode;
+
+    for (auto& scene : myLoadedScenes)
+    {
+        scene->SetUpdateMode(aUpdateMode);
+    }
+}
+
 std::shared_ptr<GameObject> SceneHandler::FindGameObjectByName(const std::string& aName)
 {
     return myActiveScene->FindGameObjectByName(aName);
@@ -98,15 +116,15 @@ std::shared_ptr<GameObject> SceneHandler::FindGameObjectByNetworkID(const unsign
     return myActiveScene->FindGameObjectByNetworkID(aNetworkID);
 }
 
-void SceneHandler::Instantiate(std::shared_ptr<GameObject> aGameObject)
+EntityHandle SceneHandler::Instantiate(std::shared_ptr<GameObject> aGameObject)
 {
     if (!myActiveScene)
     {
         LOG(LogSceneHandler, Error, "Scenehandler does not contain an active scene!");
-        return;
+        return EntityHandle();
     }
 
-    myActiveScene->Instantiate(aGameObject);
+    return myActiveScene->Instantiate(aGameObject);
 }
 
 void SceneHandler::Destroy(std::shared_ptr<GameObject> aGameObject)
@@ -120,11 +138,111 @@ void SceneHandler::Destroy(std::shared_ptr<GameObject> aGameObject)
     myActiveScene->Destroy(aGameObject);
 }
 
+void SceneHandler::Destroy(const EntityHandle aHandle)
+{
+    if (!myActiveScene)
+    {
+        LOG(LogSceneHandler, Error, "Scenehandler does not contain an active scene!");
+        return;
+    }
+
+    myActiveScene->Destroy(aHandle);
+}
+
+GameObject* SceneHandler::Resolve(const EntityHandle aHandle) const
+{
+    if (!myActiveScene) return nullptr;
+
+    return myActiveScene->Resolve(aHandle);
+}
+
+PrefabID SceneHandler::LoadPrefab(const std::string& aPrefabName, const std::string& aPrefabFilePath)
+{
+    return mySceneLoader->LoadPrefab(*myPrefabRegistry, aPrefabName, Engine::Get().GetContentRootPath() / aPrefabFilePath);
+}
+
+EntityHandle SceneHandler::Instantiate(const PrefabID aPrefabID, const Math::Vector3f& aPosition, const Math::Vector3f& aRotation)
+{
+    if (!myActiveScene)
+    {
+        LOG(LogSceneHandler, Error, "Scenehandler does not contain an active scene!");
+        return EntityHandle();
+    }
+
+    return myPrefabRegistry->Instantiate(*myActiveScene, aPrefabID, aPosition, aRotation);
+}
+
+void SceneHandler::InstantiateMany(const PrefabID aPrefabID, const std::vector<Math::Vector3f>& aPositions, std::vector<EntityHandle>* outHandles)
+{
+    if (!myActiveScene)
+    {
+        LOG(LogSceneHandler, Error, "Scenehandler does not contain an active scene!");
+        return;
+    }
+
+    myPrefabRegistry->InstantiateMany(*myActiveScene, aPrefabID, aPositions, outHandles);
+}
+
 bool SceneHandler::Raycast(Math::Vector3f aOrigin, Math::Vector3f aDirection, Math::Vector3f& aHitPoint)
 {
     return myCollisionHandler->Raycast(*myActiveScene, aOrigin, aDirection, aHitPoint);
 }
 
+bool SceneHandler::RaycastClosest(const Math::Ray<float>& aRay, RaycastHit& outHit, const float aMaxDistance)
+{
+    if (!myActiveScene)
+    {
+        LOG(LogSceneHandler, Error, "Scenehandler does not contain an active scene!");
+        return false;
+    }
+
+    return myCollisionHandler->RaycastClosest(*myActiveScene, aRay, outHit, aMaxDistance);
+}
+
+unsigned SceneHandler::RaycastAll(const Math::Ray<float>& aRay, std::vector<RaycastHit>& outHits, const float aMaxDistance)
+{
+    if (!myActiveScene)
+    {
+        LOG(LogSceneHandler, Error, "Scenehandler does not contain an active scene!");
+        return 0;
+    }
+
+    return myCollisionHandler->RaycastAll(*myActiveScene, aRay, outHits, aMaxDistance);
+}
+
+unsigned SceneHandler::RaycastClosestBatch(const std::vector<Math::Ray<float>>& aRays, std::vector<RaycastHit>& outHits, const float aMaxDistance)
+{
+    if (!myActiveScene)
+    {
+        LOG(LogSceneHandler, Error, "Scenehandler does not contain an active scene!");
+        return 0;
+    }
+
+    return myCollisionHandler->RaycastClosestBatch(*myActiveScene, aRays, outHits, aMaxDistance);
+}
+
+unsigned SceneHandler::OverlapSphere(const Math::Vector3f& aCenter, const float aRadius, std::vector<GameObject*>& outGameObjects)
+{
+    if (!myActiveScene)
+    {
+        LOG(LogSceneHandler, Error, "Scenehandler does not contain an active scene!");
+        return 0;
+    }
+
+    return myCollisionHandler->OverlapSphere(*myActiveScene, aCenter, aRadius, outGameObjects);
+}
+
+unsigned SceneHandler::OverlapBox(const Math::AABB3D<float>& aBox, std::vector<GameObject*>& outGameObjects)
+{
+    if (!myActiveScene)
+    {
+        LOG(LogSceneHandler, Error, "Scenehandler does not contain an active scene!");
+        return 0;
+    }
+
+    return myCollisionHandler->OverlapBox(*myActiveScene, aBox, outGameObjects);
+}
+
 const unsigned SceneHandler::GetObjectAmount() const
 {
     if (!myActiveScene)
@@ -1,10 +1,16 @@
 #pragma once
+#include "ComponentSystem/EntityHandle.h"
+#include "ComponentSystem/PrefabRegistry.h"
+#include "Math/Ray.hpp"
+#include "Math/AABB3D.hpp"
 
 class Scene;
 class GameObject;
 class SceneLoader;
 class RenderAssembler;
 class CollisionHandler;
+struct RaycastHit;
+enum class SceneUpdateMode;
 
 class SceneHandler
 {
@@ -18,14 +24,33 @@ public:
     void UnloadScene(unsigned aLoadedSceneIndex);
     void ChangeActiveScene(unsigned aLoadedSceneIndex);
 
+    // Applies to all loaded scenes and to scenes created or loaded later.
+    void SetSceneUpdateMode(SceneUpdateMode aUpdateMode);
+
     std::shared_ptr<GameObject> FindGameObjectByName(const std::string& aName);
     std::shared_ptr<GameObject> FindGameObjectByID(const unsigned aID);
     std::shared_ptr<GameObject> FindGameObjectByNetworkID(const unsigned aNetworkID);
 
-    void Instantiate(std::shared_ptr<GameObject> aGameObject);
+    EntityHandle Instantiate(std::shared_ptr<GameObject> aGameObject);
     void Destroy(std::shared_ptr<GameObject> aGameObject);
+    void Destroy(const EntityHandle aHandle);
+    // Handles are only valid in the scene that handed them out, this resolves against the active scene.
+    GameObject* Resolve(const EntityHandle aHandle) const;
+
+    // Loads a single game object file as a prefab, spawning through the returned ID skips the JSON and asset lookups.
+    PrefabID LoadPrefab(const std::string& aPrefabName, const std::string& aPrefabFilePath);
+    PrefabRegistry& GetPrefabRegistry() { return *myPrefabRegistry; }
+    // Spawns prefabs into the active scene, see PrefabRegistry.
+    EntityHandle Instantiate(const PrefabID aPrefabID, const Math::Vector3f& aPosition, const Math::Vector3f& aRotation = { 0, 0, 0 });
+    void InstantiateMany(const PrefabID aPrefabID, const std::vector<Math::Vector3f>& aPositions, std::vector<EntityHandle>* outHandles = nullptr);
 
     bool Raycast(Math::Vector3f aOrigin, Math::Vector3f aDirection, Math::Vector3f& aHitPoint);
+    // Collider queries on the active scene, see CollisionHandler.
+    bool RaycastClosest(const Math::Ray<float>& aRay, RaycastHit& outHit, const float aMaxDistance = FLT_MAX);
+    unsigned RaycastAll(const Math::Ray<float>& aRay, std::vector<RaycastHit>& outHits, const float aMaxDistance = FLT_MAX);
+    unsigned RaycastClosestBatch(const std::vector<Math::Ray<float>>& aRays, std::vector<RaycastHit>& outHits, const float aMaxDistance = FLT_MAX);
+    unsigned OverlapSphere(const Math::Vector3f& aCenter, const float aRadius, std::vector<GameObject*>& outGameObjects);
+    unsigned OverlapBox(const Math::AABB3D<float>& aBox, std::vector<GameObject*>& outGameObjects);
 
     const unsigned GetObjectAmount() const;
     const unsigned GetActiveObjectAmount() const;
@@ -33,8 +58,10 @@ private:
     std::unique_ptr<SceneLoader> mySceneLoader;
     std::unique_ptr<RenderAssembler> myRenderAssembler;
     std::unique_ptr<CollisionHandler> myCollisionHandler;
+    std::unique_ptr<PrefabRegistry> myPrefabRegistry;
 
     std::shared_ptr<Scene> myActiveScene;
     std::vector<std::shared_ptr<Scene>> myLoadedScenes;
+    SceneUpdateMode mySceneUpdateMode;
 };
 
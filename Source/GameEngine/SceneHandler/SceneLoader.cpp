@@ -71,9 +71,43 @@ bool SceneLoader::LoadScene(std::shared_ptr<Scene> aScene, std::filesystem::path
     return true;
 }
 
+PrefabID SceneLoader::LoadPrefab(PrefabRegistry& aPrefabRegistry, const std::string& aPrefabName, std::filesystem::path aPrefabFilepath)
+{
+    std::ifstream path(aPrefabFilepath);
+    nl::json data = nl::json();
+
+    try
+    {
+        data = nl::json::parse(path);
+    }
+    catch (nl::json::parse_error e)
+    {
+        LOG(LogSceneLoader, Error, "Couldn't read prefab file, {}!", e.what());
+        return PrefabRegistry::InvalidID;
+    }
+    path.close();
+
+    std::vector<std::shared_ptr<GameObject>> descendants;
+    std::shared_ptr<GameObject> root = BuildGameObject(data, descendants);
+    return aPrefabRegistry.Register(aPrefabName, root, descendants);
+}
+
 std::shared_ptr<GameObject> SceneLoader::LoadGameObject(std::shared_ptr<Scene> aScene, nl::json& aGO)
 {
-    std::shared_ptr<GameObject> newGO = std::make_shared<GameObject>();
+    std::vector<std::shared_ptr<GameObject>> descendants;
+    std::shared_ptr<GameObject> newGO = BuildGameObject(aGO, descendants);
+
+    for (auto& descendant : descendants)
+    {
+        aScene->Instantiate(descendant);
+    }
+
+    return newGO;
+}
+
+std::shared_ptr<GameObject> SceneLoader::BuildGameObject(nl::json& aGO, std::vector<std::shared_ptr<GameObject>>& outDescendants)
+{
+    std::shared_ptr<GameObject> newGO = MakePooled<GameObject>();
 
     if (aGO.contains("Name"))
     {
@@ -102,11 +136,11 @@ std::shared_ptr<GameObject> SceneLoader::LoadGameObject(std::shared_ptr<Scene> a
     {
         for (auto& child : aGO["Children"])
         {
-            std::shared_ptr<GameObject> newChild = LoadGameObject(aScene, child);
+            std::shared_ptr<GameObject> newChild = BuildGameObject(child, outDescendants);
             if (newChild)
             {
                 newGO->GetComponent<Transform>()->AddChild(newChild->GetComponent<Transform>().get());
-                aScene->Instantiate(newChild);
+                outDescendants.emplace_back(newChild);
             }
         }
     }
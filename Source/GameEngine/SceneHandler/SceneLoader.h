@@ -1,5 +1,6 @@
 #pragma once
 #include "Math/Vector.hpp"
+#include "ComponentSystem/PrefabRegistry.h"
 
 
 class Scene;
@@ -12,6 +13,10 @@ public:
     ~SceneLoader();
     bool LoadScene(std::shared_ptr<Scene> aScene, std::filesystem::path aSceneFilepath);
     std::shared_ptr<GameObject> LoadGameObject(std::shared_ptr<Scene> aScene, nl::json& aGO);
+    // Builds the game object and its children without instantiating any of them, the children are added to outDescendants.
+    std::shared_ptr<GameObject> BuildGameObject(nl::json& aGO, std::vector<std::shared_ptr<GameObject>>& outDescendants);
+    // Registers the game object in the file (written like an entry in a scene's GameObjects) as a prefab.
+    PrefabID LoadPrefab(PrefabRegistry& aPrefabRegistry, const std::string& aPrefabName, std::filesystem::path aPrefabFilepath);
     void CreateComponent(std::shared_ptr<GameObject> aGO, nl::json& aComp);
 };
 
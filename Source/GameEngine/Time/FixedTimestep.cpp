@@ -0,0 +1,38 @@
+#include "Enginepch.h"
+
+#include "FixedTimestep.h"
+
+void FixedTimestep::SetStepsPerSecond(float aStepsPerSecond)
+{
+	myStepsPerSecond = aStepsPerSecond > 0 ? aStepsPerSecond : 0;
+	myStepTime = myStepsPerSecond > 0 ? 1.0f / myStepsPerSecond : 0;
+	myAccumulatedTime = 0;
+}
+
+const unsigned FixedTimestep::Advance(float aFrameTime)
+{
+	if (!IsEnabled()) return 1;
+
+	myAccumulatedTime += aFrameTime;
+
+	unsigned steps = 0;
+	while (myAccumulatedTime >= myStepTime && steps < myMaxStepsPerFrame)
+	{
+		myAccumulatedTime -= myStepTime;
+		steps++;
+	}
+
+	if (myAccumulatedTime >= myStepTime)
+	{
+		myAccumulatedTime = std::fmod(myAccumulatedTime, myStepTime);
+	}
+
+	return steps;
+}
+
+const float FixedTimestep::GetInterpolationAlpha() const
+{
+	if (!IsEnabled()) return 1.0f;
+
+	return myAccumulatedTime / myStepTime;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+// Accumulates frame time and hands it out as whole simulation steps of a fixed length, so the simulation runs at the
+// same rate however fast frames are rendered. Disabled (0 steps per second) means one step per frame of the frame's length.
+class FixedTimestep
+{
+public:
+	void SetStepsPerSecond(float aStepsPerSecond);
+	const float GetStepsPerSecond() const { return myStepsPerSecond; }
+	const bool IsEnabled() const { return myStepsPerSecond > 0; }
+
+	// Time that would need more steps than this in a single frame is dropped, so a long frame can't make the next one longer still.
+	void SetMaxStepsPerFrame(unsigned aMaxStepsPerFrame) { myMaxStepsPerFrame = aMaxStepsPerFrame > 0 ? aMaxStepsPerFrame : 1; }
+	const unsigned GetMaxStepsPerFrame() const { return myMaxStepsPerFrame; }
+
+	// Adds a frame's time and returns the number of steps to simulate for it.
+	const unsigned Advance(float aFrameTime);
+
+	const float GetStepTime() const { return myStepTime; }
+	// Fraction of a step accumulated but not yet simulated, for interpolating rendered state between the last two steps.
+	// Always 1 while disabled, the simulation is then up to date every frame.
+	const float GetInterpolationAlpha() const;
+	// Time left until another step is due, for loops that would rather sleep than spin.
+	const float GetTimeUntilNextStep() const { return IsEnabled() ? myStepTime - myAccumulatedTime : 0; }
+
+private:
+	float myStepsPerSecond = 0;
+	float myStepTime = 0;
+	float myAccumulatedTime = 0;
+	unsigned myMaxStepsPerFrame = 5;
+};
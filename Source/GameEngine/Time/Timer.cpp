@@ -16,7 +16,7 @@ void Timer::Update()
 	myCurrentFrameTime = std::chrono::high_resolution_clock::now();
 
 	myCurrentFPSCountFrame++;
-	myTotalFPS += 1 / GetDeltaTime();
+	myTotalFPS += 1 / GetUnscaledDeltaTime();
 
 	if (myCurrentFPSCountFrame >= myMaxFPSCountFrame)
 	{
@@ -38,6 +38,13 @@ float Timer::GetDeltaTime() const
 	return deltaTime.count() * GetTimeScale();
 }
 
+float Timer::GetFixedDeltaTime() const
+{
+	if (myFixedDeltaTime > 0) return myFixedDeltaTime * GetTimeScale();
+
+	return GetDeltaTime();
+}
+
 float Timer::GetUnscaledDeltaTime() const
 {
 	const std::chrono::duration<float, std::ratio<1, 1>> deltaTime = myCurrentFrameTime - myLastFrameTime;
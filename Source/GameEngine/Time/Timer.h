@@ -10,7 +10,14 @@ public:
 	void Update();
 	void SetTimeScale(float aTimeScale) { myTimeScale = aTimeScale; }
 	const float GetTimeScale() const { return myTimeScale; }
+	// Length of a simulation step while the engine runs a fixed timestep, see FixedTimestep. 0 clears it.
+	void SetFixedDeltaTime(float aFixedDeltaTime) { myFixedDeltaTime = aFixedDeltaTime; }
+	// Time between the last two frames, time scaled. For code that runs once per frame, such as rendering.
 	float GetDeltaTime() const;
+	// Time one simulation step advances by, time scaled: the fixed step length while one is set, otherwise the same as
+	// GetDeltaTime. For code that runs once per simulation step, such as component updates.
+	float GetFixedDeltaTime() const;
+	// Real time between the last two frames, ignoring both the time scale and the fixed delta time.
 	float GetUnscaledDeltaTime() const;
 	double GetTimeSinceEpoch() const;
 	double GetTimeSinceProgramStart() const;
@@ -26,4 +33,5 @@ private:
 	float myTotalFPS = 0;
 	int myAverageFPS = 0;
 	float myTimeScale = 1.0f;
+	float myFixedDeltaTime = 0;
 };
\ No newline at end of file
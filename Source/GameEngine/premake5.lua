@@ -27,6 +27,9 @@ project "GameEngine"
 		"**.cpp"
 	}
 
+  -- Replacements for the Windows only parts, built by the headless CMake target instead.
+  removefiles { "Platform/Headless/**" }
+
   dependson {
     "CommonUtilities",
     "Math",
@@ -29,7 +29,10 @@ void ParticleEmitter::Update(float aDeltaTime)
 		
 		UpdateParticle(particle, aDeltaTime);
 	}
+}
 
+void ParticleEmitter::UploadVertexBuffer()
+{
 	myVertexBuffer->UpdateVertexBuffer(myParticles);
 }
 
@@ -15,6 +15,8 @@ class ParticleEmitter
 		ParticleEmitter();
 		virtual ~ParticleEmitter();
 		void Update(float aDeltaTime);
+		// Copies the particles into the vertex buffer, which maps it on the immediate context, so only on the main thread.
+		void UploadVertexBuffer();
 
 		void SetMaterial(std::shared_ptr<Material> aMaterial) { myMaterial = aMaterial; }
 		std::shared_ptr<Material> GetMaterial() { return myMaterial; }
@@ -35,7 +35,10 @@ void TrailEmitter::Update(Math::Vector3f aFollowTarget, float aDeltaTime)
 	{
 		myPreviousPositions[i] = myPreviousPositions[i - 1];
 	}
+}
 
+void TrailEmitter::UploadVertexBuffer()
+{
 	myVertexBuffer->UpdateVertexBuffer(myTrailVertices);
 }
 
@@ -13,6 +13,8 @@ public:
 	TrailEmitter();
 	virtual ~TrailEmitter();
 	void Update(Math::Vector3f aFollowTarget, float aDeltaTime);
+	// Copies the trail into the vertex buffer, which maps it on the immediate context, so only on the main thread.
+	void UploadVertexBuffer();
 
 	void SetMaterial(std::shared_ptr<Material> aMaterial) { myMaterial = aMaterial; }
 	std::shared_ptr<Material> GetMaterial() { return myMaterial; }
@@ -0,0 +1,65 @@
+#pragma once
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+
+namespace Utilities
+{
+	// Stable LSD radix sort on a 64-bit key, one byte per pass. Passes where every element has the same byte are skipped,
+	// so keys that only use part of their bits need fewer passes. aScratch is resized to fit and can be reused between calls.
+	template <typename T, typename KeyFunction>
+	void RadixSort64(std::vector<T>& aItems, std::vector<T>& aScratch, KeyFunction aGetKey)
+	{
+		constexpr unsigned BucketCount = 256;
+		constexpr unsigned PassCount = sizeof(uint64_t);
+
+		const size_t itemCount = aItems.size();
+		if (itemCount < 2) return;
+
+		aScratch.resize(itemCount);
+
+		// Histograms for every pass are built in a single read of the keys.
+		std::array<std::array<size_t, BucketCount>, PassCount> histograms = {};
+		for (const T& item : aItems)
+		{
+			const uint64_t key = aGetKey(item);
+			for (unsigned pass = 0; pass < PassCount; pass++)
+			{
+				histograms[pass][(key >> (pass * 8)) & 0xFF]++;
+			}
+		}
+
+		std::vector<T>* source = &aItems;
+		std::vector<T>* destination = &aScratch;
+
+		for (unsigned pass = 0; pass < PassCount; pass++)
+		{
+			const unsigned shift = pass * 8;
+			std::array<size_t, BucketCount>& histogram = histograms[pass];
+
+			if (histogram[(aGetKey((*source)[0]) >> shift) & 0xFF] == itemCount) continue;
+
+			size_t offset = 0;
+			for (size_t& bucket : histogram)
+			{
+				const size_t count = bucket;
+				bucket = offset;
+				offset += count;
+			}
+
+			for (const T& item : *source)
+			{
+				(*destination)[histogram[(aGetKey(item) >> shift) & 0xFF]++] = item;
+			}
+
+			std::swap(source, destination);
+		}
+
+		if (source != &aItems)
+		{
+			aItems.swap(aScratch);
+		}
+	}
+}
@@ -1,4 +1,5 @@
 #include "Logger.h"
+#ifdef _WIN32
 #pragma region WindowsIncludes
 #define	WIN32_LEAN_AND_MEAN
 
@@ -43,6 +44,10 @@
 #define NOMCX
 #include <Windows.h>  
 #pragma endregion
+#else
+// Console colours are Windows only, elsewhere the messages are written without them.
+#define SetConsoleTextAttribute(aHandle, aAttributes)
+#endif
 
 #include <fstream>
 #include <chrono>
@@ -61,7 +66,11 @@ Logger::LogCategoryBase::LogCategoryBase(const std::string& aName, LogVerbosity:
 {  }
 
 Logger::Logger()
+#ifdef _WIN32
 	: myStdErrHandle(GetStdHandle(STD_ERROR_HANDLE)), myIsRunning(true)
+#else
+	: myStdErrHandle(nullptr), myIsRunning(true)
+#endif
 {
 	myLogThread = std::thread(&Logger::Heartbeat, this);
 }
@@ -81,8 +90,12 @@ std::string Logger::Timestamp(bool aIncludeDate /*= false*/) const
 	const std::time_t time = std::chrono::system_clock::to_time_t(now);
 
 	struct tm timeInfo{};
+#ifdef _WIN32
 	const int error = localtime_s(&timeInfo, &time);
 	error;
+#else
+	localtime_r(&time, &timeInfo);
+#endif
 
 	char buffer[20]{};
 	const size_t wcsTimeErr = strftime(buffer, 20, aIncludeDate ? dateFormat.c_str() : noDateFormat.c_str(), &timeInfo);
@@ -135,6 +148,7 @@ void Logger::LogIntl(const LogCategoryBase& aCategory, LogVerbosity::Type aVerbo
 
 void Logger::Heartbeat()
 {
+#ifdef _WIN32
 	char imagePath[MAX_PATH]{};
 	GetModuleFileNameA(NULL, imagePath, MAX_PATH);
 
@@ -158,6 +172,15 @@ void Logger::Heartbeat()
 		const std::filesystem::path exePath = exeFileName;
 		myLogFilePath = myLogFilePath / (exePath.stem().string() + ".log");
 	}
+#else
+	myLogFilePath = LOGGING_PATH;
+	if(!myLogFilePath.has_filename())
+	{
+		std::error_code error;
+		const std::filesystem::path exePath = std::filesystem::read_symlink("/proc/self/exe", error);
+		myLogFilePath = myLogFilePath / ((error ? std::string("Log") : exePath.stem().string()) + ".log");
+	}
+#endif
 
 	const std::string timeStamp = Timestamp(true);
 
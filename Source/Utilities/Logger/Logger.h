@@ -40,6 +40,12 @@
 #include <string>
 #include <thread>
 #include <mutex>
+#include <atomic>
+#if __has_include(<format>)
+#include <format>
+#else
+#include <sstream>
+#endif
 
 // Define this before including Logger.h to override.
 #ifndef LOGGING_PATH
@@ -47,7 +53,11 @@
 #endif
 
 #ifndef FORCEINLINE
+#ifdef _MSC_VER
 #define FORCEINLINE __forceinline
+#else
+#define FORCEINLINE inline __attribute__((always_inline))
+#endif
 #endif
 
 namespace LogVerbosity
@@ -78,7 +88,7 @@ public:
 	template<uint8_t V>
 	struct LogCategory : public LogCategoryBase
 	{
-		__forceinline LogCategory(const std::string& aName)
+		FORCEINLINE LogCategory(const std::string& aName)
 			: LogCategoryBase(aName, static_cast<LogVerbosity::Type>(V))
 		{  }
 	};
@@ -159,7 +169,11 @@ public:
 	{
 		if(aCategory.Verbosity >= aVerbosity)
 		{
+#if __has_include(<format>)
 			const std::string s = std::vformat(aMessage, std::make_format_args(args...));
+#else
+			const std::string s = Format(aMessage, args...);
+#endif
 			Log(aCategory, aVerbosity, s.c_str());
 		}
 	}
@@ -167,6 +181,30 @@ public:
 	static void Log(const LogCategoryBase& aCategory, LogVerbosity::Type aVerbosity, const char* aMessage);
 
 	static void Flush();
+
+private:
+#if !__has_include(<format>)
+	// Standard libraries without <format> (GCC before 13) only get plain {} placeholders, which is all the engine uses.
+	template<typename... Args>
+	static std::string Format(const char* aMessage, const Args&... args)
+	{
+		std::ostringstream stream;
+		const std::string message(aMessage);
+		size_t position = 0;
+
+		auto appendNext = [&](const auto& aArgument)
+			{
+				const size_t placeholder = message.find("{}", position);
+				if (placeholder == std::string::npos) return;
+				stream << message.substr(position, placeholder - position) << aArgument;
+				position = placeholder + 2;
+			};
+
+		(appendNext(args), ...);
+		stream << message.substr(position);
+		return stream.str();
+	}
+#endif
 };
 
 #define DECLARE_LOG_CATEGORY(CategoryId, DefaultVerbosity) extern struct LoggerCategory##CategoryId : public Logger::LogCategory<LogVerbosity::DefaultVerbosity> \
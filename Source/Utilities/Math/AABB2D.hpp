@@ -8,11 +8,11 @@ namespace Math
 	{
 	public:
 		// Default constructor: there is no AABB, both min and max points are the zero vector.
-		AABB2D<T>();
+		AABB2D();
 		// Copy constructor.
-		AABB2D<T>(const AABB2D<T>& aAABB2D);
+		AABB2D(const AABB2D<T>& aAABB2D);
 		// Constructor taking the positions of the minimum and maximum corners.
-		AABB2D<T>(const Vector2<T>& aMin, const Vector2<T>& aMax);
+		AABB2D(const Vector2<T>& aMin, const Vector2<T>& aMax);
 		// Init the AABB with the positions of the minimum and maximum corners, same as
 		// the constructor above.
 		void InitWithMinAndMax(const Vector2<T>& aMin, const Vector2<T>& aMax);
@@ -10,12 +10,13 @@ namespace Math
 	{
 	public:
 		// Default constructor: there is no AABB, both min and max points are the zero vector.
-		AABB3D<T>();
+		AABB3D();
 		// Copy constructor.
-		AABB3D<T>(const AABB3D<T>& aAABB3D);
+		AABB3D(const AABB3D<T>& aAABB3D);
+		AABB3D<T>& operator=(const AABB3D<T>& aAABB3D) = default;
 		// Constructor taking the positions of the minimum and maximum corners.
-		AABB3D<T>(const Vector3<T>& aMin, const Vector3<T>& aMax);
-		AABB3D<T>(const Vector3<T>& aCenter, const T aWidth, const T aHeight, const T aDepth);
+		AABB3D(const Vector3<T>& aMin, const Vector3<T>& aMax);
+		AABB3D(const Vector3<T>& aCenter, const T aWidth, const T aHeight, const T aDepth);
 		// Init the AABB with the positions of the minimum and maximum corners, same as
 		// the constructor above.
 		void InitWithMinAndMax(const Vector3<T>& aMin, const Vector3<T>& aMax);
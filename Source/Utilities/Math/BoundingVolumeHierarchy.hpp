@@ -0,0 +1,224 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include "Math/Vector.hpp"
+#include "AABB3D.hpp"
+
+namespace Math
+{
+	// Bounding volume hierarchy over a fixed set of AABBs, built top-down by splitting the longest axis at the median.
+	// Items that move can be refitted in place, but adding or removing items means building it again.
+	// Items are identified by their index in the list the hierarchy was built from.
+	template <class T>
+	class BoundingVolumeHierarchy
+	{
+	public:
+		void Build(const std::vector<AABB3D<T>>& aItemBounds);
+		// Takes the same items' new bounds and fits the nodes around them, keeping the tree as it was built. Much cheaper
+		// than building it again, but the further the items move from where they were built, the more the nodes overlap.
+		void Refit(const std::vector<AABB3D<T>>& aItemBounds);
+		void Clear();
+		const bool IsEmpty() const { return myNodes.empty(); }
+
+		// Calls aFunction(itemIndex) for every item whose AABB passes aOverlapTest(const AABB3D<T>&). Subtrees whose bounds
+		// fail the test are skipped, so it has to pass for any AABB that contains one that passes.
+		template <typename OverlapTest, typename Function>
+		void Query(OverlapTest&& aOverlapTest, Function&& aFunction) const;
+
+	private:
+		static constexpr uint32_t MaxItemsPerLeaf = 4;
+		static constexpr uint32_t MaxDepth = 64;
+
+		struct Node
+		{
+			AABB3D<T> bounds;
+			// Leaf: index of the first item in myItems. Inner node: index of the second child, the first child comes right after the node.
+			uint32_t offset = 0;
+			// Number of items in a leaf, 0 for inner nodes.
+			uint32_t itemCount = 0;
+		};
+
+		uint32_t BuildNode(const std::vector<AABB3D<T>>& aItemBounds, uint32_t aBegin, uint32_t aEnd, uint32_t aDepth);
+		static AABB3D<T> GetUnion(const AABB3D<T>& aBoundsA, const AABB3D<T>& aBoundsB);
+		static T GetAxis(const Vector3<T>& aVector, int aAxis) { return aAxis == 0 ? aVector.x : (aAxis == 1 ? aVector.y : aVector.z); }
+
+		std::vector<Node> myNodes;
+		// Item indices grouped by leaf, with the item bounds stored in the same order.
+		std::vector<uint32_t> myItems;
+		std::vector<AABB3D<T>> myItemBounds;
+		std::vector<Vector3<T>> myItemCenters;
+	};
+
+	template<class T>
+	inline void BoundingVolumeHierarchy<T>::Build(const std::vector<AABB3D<T>>& aItemBounds)
+	{
+		Clear();
+		if (aItemBounds.empty()) return;
+
+		const uint32_t itemCount = static_cast<uint32_t>(aItemBounds.size());
+		myItems.reserve(itemCount);
+		myItemCenters.reserve(itemCount);
+		myNodes.reserve(2 * (itemCount / MaxItemsPerLeaf + 1));
+
+		for (uint32_t i = 0; i < itemCount; i++)
+		{
+			myItems.emplace_back(i);
+			myItemCenters.emplace_back((aItemBounds[i].GetMin() + aItemBounds[i].GetMax()) * static_cast<T>(0.5));
+		}
+
+		BuildNode(aItemBounds, 0, itemCount, 0);
+
+		myItemBounds.reserve(itemCount);
+		for (const uint32_t item : myItems)
+		{
+			myItemBounds.emplace_back(aItemBounds[item]);
+		}
+
+		// Only needed while building.
+		myItemCenters.clear();
+		myItemCenters.shrink_to_fit();
+	}
+
+	template<class T>
+	inline void BoundingVolumeHierarchy<T>::Refit(const std::vector<AABB3D<T>>& aItemBounds)
+	{
+		for (size_t i = 0; i < myItems.size(); i++)
+		{
+			myItemBounds[i] = aItemBounds[myItems[i]];
+		}
+
+		// Nodes are stored parents first, so going backwards fits every node's children before the node itself.
+		for (size_t nodeIndex = myNodes.size(); nodeIndex > 0; nodeIndex--)
+		{
+			Node& node = myNodes[nodeIndex - 1];
+			if (node.itemCount > 0)
+			{
+				node.bounds = myItemBounds[node.offset];
+				for (uint32_t i = node.offset + 1; i < node.offset + node.itemCount; i++)
+				{
+					node.bounds = GetUnion(node.bounds, myItemBounds[i]);
+				}
+			}
+			else
+			{
+				node.bounds = GetUnion(myNodes[nodeIndex].bounds, myNodes[node.offset].bounds);
+			}
+		}
+	}
+
+	template<class T>
+	inline AABB3D<T> BoundingVolumeHierarchy<T>::GetUnion(const AABB3D<T>& aBoundsA, const AABB3D<T>& aBoundsB)
+	{
+		const Vector3<T> minA = aBoundsA.GetMin();
+		const Vector3<T> maxA = aBoundsA.GetMax();
+		const Vector3<T> minB = aBoundsB.GetMin();
+		const Vector3<T> maxB = aBoundsB.GetMax();
+
+		return AABB3D<T>(
+			Vector3<T>(minB.x < minA.x ? minB.x : minA.x, minB.y < minA.y ? minB.y : minA.y, minB.z < minA.z ? minB.z : minA.z),
+			Vector3<T>(maxB.x > maxA.x ? maxB.x : maxA.x, maxB.y > maxA.y ? maxB.y : maxA.y, maxB.z > maxA.z ? maxB.z : maxA.z));
+	}
+
+	template<class T>
+	inline void BoundingVolumeHierarchy<T>::Clear()
+	{
+		myNodes.clear();
+		myItems.clear();
+		myItemBounds.clear();
+		myItemCenters.clear();
+	}
+
+	template<class T>
+	inline uint32_t BoundingVolumeHierarchy<T>::BuildNode(const std::vector<AABB3D<T>>& aItemBounds, uint32_t aBegin, uint32_t aEnd, uint32_t aDepth)
+	{
+		Vector3<T> boundsMin = aItemBounds[myItems[aBegin]].GetMin();
+		Vector3<T> boundsMax = aItemBounds[myItems[aBegin]].GetMax();
+		Vector3<T> centerMin = myItemCenters[myItems[aBegin]];
+		Vector3<T> centerMax = centerMin;
+
+		for (uint32_t i = aBegin + 1; i < aEnd; i++)
+		{
+			const AABB3D<T>& itemBounds = aItemBounds[myItems[i]];
+			const Vector3<T>& center = myItemCenters[myItems[i]];
+
+			boundsMin.x = itemBounds.GetMin().x < boundsMin.x ? itemBounds.GetMin().x : boundsMin.x;
+			boundsMin.y = itemBounds.GetMin().y < boundsMin.y ? itemBounds.GetMin().y : boundsMin.y;
+			boundsMin.z = itemBounds.GetMin().z < boundsMin.z ? itemBounds.GetMin().z : boundsMin.z;
+			boundsMax.x = itemBounds.GetMax().x > boundsMax.x ? itemBounds.GetMax().x : boundsMax.x;
+			boundsMax.y = itemBounds.GetMax().y > boundsMax.y ? itemBounds.GetMax().y : boundsMax.y;
+			boundsMax.z = itemBounds.GetMax().z > boundsMax.z ? itemBounds.GetMax().z : boundsMax.z;
+
+			centerMin.x = center.x < centerMin.x ? center.x : centerMin.x;
+			centerMin.y = center.y < centerMin.y ? center.y : centerMin.y;
+			centerMin.z = center.z < centerMin.z ? center.z : centerMin.z;
+			centerMax.x = center.x > centerMax.x ? center.x : centerMax.x;
+			centerMax.y = center.y > centerMax.y ? center.y : centerMax.y;
+			centerMax.z = center.z > centerMax.z ? center.z : centerMax.z;
+		}
+
+		const uint32_t nodeIndex = static_cast<uint32_t>(myNodes.size());
+		myNodes.emplace_back();
+		myNodes[nodeIndex].bounds.InitWithMinAndMax(boundsMin, boundsMax);
+
+		if (aEnd - aBegin <= MaxItemsPerLeaf || aDepth + 1 >= MaxDepth)
+		{
+			myNodes[nodeIndex].offset = aBegin;
+			myNodes[nodeIndex].itemCount = aEnd - aBegin;
+			return nodeIndex;
+		}
+
+		// Split on the axis the item centers are spread out the most along.
+		const Vector3<T> centerSpread = centerMax - centerMin;
+		int axis = 0;
+		if (centerSpread.y > GetAxis(centerSpread, axis)) axis = 1;
+		if (centerSpread.z > GetAxis(centerSpread, axis)) axis = 2;
+
+		const uint32_t middle = aBegin + (aEnd - aBegin) / 2;
+		std::nth_element(myItems.begin() + aBegin, myItems.begin() + middle, myItems.begin() + aEnd, [this, axis](uint32_t aItemA, uint32_t aItemB)
+			{
+				return GetAxis(myItemCenters[aItemA], axis) < GetAxis(myItemCenters[aItemB], axis);
+			});
+
+		BuildNode(aItemBounds, aBegin, middle, aDepth + 1);
+		const uint32_t secondChild = BuildNode(aItemBounds, middle, aEnd, aDepth + 1);
+		myNodes[nodeIndex].offset = secondChild;
+		return nodeIndex;
+	}
+
+	template<class T>
+	template<typename OverlapTest, typename Function>
+	inline void BoundingVolumeHierarchy<T>::Query(OverlapTest&& aOverlapTest, Function&& aFunction) const
+	{
+		if (myNodes.empty()) return;
+
+		// Depth is capped at MaxDepth while building, and every level down adds at most one node to the stack.
+		uint32_t stack[MaxDepth + 1];
+		uint32_t stackSize = 0;
+		stack[stackSize++] = 0;
+
+		while (stackSize > 0)
+		{
+			const uint32_t nodeIndex = stack[--stackSize];
+			const Node& node = myNodes[nodeIndex];
+			if (!aOverlapTest(node.bounds)) continue;
+
+			if (node.itemCount > 0)
+			{
+				// A single item's bounds are the leaf's bounds, which already passed.
+				for (uint32_t i = node.offset; i < node.offset + node.itemCount; i++)
+				{
+					if (node.itemCount == 1 || aOverlapTest(myItemBounds[i]))
+					{
+						aFunction(myItems[i]);
+					}
+				}
+			}
+			else
+			{
+				stack[stackSize++] = node.offset;
+				stack[stackSize++] = nodeIndex + 1;
+			}
+		}
+	}
+}
@@ -9,13 +9,13 @@ namespace Math
 	public:
 		// Default constructor: there is no circle, the radius is zero and the position is
 		// the zero vector.
-		Circle<T>();
+		Circle();
 
 		// Copy constructor.
-		Circle<T>(const Circle<T>& aCircle);
+		Circle(const Circle<T>& aCircle);
 
 		// Constructor that takes the center position and radius of the circle.
-		Circle<T>(const Vector2<T>& aCenter, T aRadius);
+		Circle(const Vector2<T>& aCenter, T aRadius);
 
 		// Init the circle with a center and a radius, the same as the constructor above.
 		void InitWithCenterAndRadius(const Vector2<T>& aCenter, T aRadius);
@@ -247,6 +247,38 @@ namespace Math
 		return true;
 	}
 
+	// Same as above, but a ray starting inside the sphere intersects it too. The first point the ray touches the sphere
+	// at is stored in outIntersectionPoint, or the ray's origin if it starts inside.
+	template <class T>
+	bool IntersectionSphereRay(const Sphere<T>& aSphere, const Ray<T>& aRay, Vector3<T>& outIntersectionPoint)
+	{
+		const Vector3<T> rayOriginToCenter = aSphere.GetPoint() - aRay.GetOrigin();
+		const T distanceProjectedOntoRay = rayOriginToCenter.Dot(aRay.GetDirection());
+		const T centerToRaySqr = rayOriginToCenter.LengthSqr() - distanceProjectedOntoRay * distanceProjectedOntoRay;
+
+		if (centerToRaySqr > aSphere.GetRadiusSqr())
+		{
+			return false;
+		}
+
+		const T halfChord = static_cast<T>(std::sqrt(aSphere.GetRadiusSqr() - centerToRaySqr));
+		T distance = distanceProjectedOntoRay - halfChord;
+
+		if (distance < 0)
+		{
+			// Either the sphere is behind the ray or the ray starts inside it.
+			if (distanceProjectedOntoRay + halfChord < 0)
+			{
+				return false;
+			}
+
+			distance = 0;
+		}
+
+		outIntersectionPoint = aRay.GetOrigin() + aRay.GetDirection() * distance;
+		return true;
+	}
+
 	template<class T>
 	bool IntersectionBetweenAABBS(const AABB3D<T>& aBoundingBoxOne, const AABB3D<T>& aBoundingBoxTwo)
 	{
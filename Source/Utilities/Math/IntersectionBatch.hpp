@@ -0,0 +1,379 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <cmath>
+#include <cfloat>
+#include "Math/Vector3.hpp"
+#include "Sphere.hpp"
+#include "AABB3D.hpp"
+#include "Ray.hpp"
+
+// The batch tests use SSE2, which every x64 CPU has, and fall back to plain loops elsewhere or with FRAGILE_NO_SIMD.
+#if !defined(FRAGILE_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define FRAGILE_INTERSECTION_BATCH_SSE 1
+#include <emmintrin.h>
+#else
+#define FRAGILE_INTERSECTION_BATCH_SSE 0
+#endif
+
+namespace Math
+{
+	// AABBs stored as one array per coordinate, so one shape can be tested against several of them at once.
+	class AABBBatch
+	{
+	public:
+		void Clear();
+		void Reserve(const size_t aSize);
+		void Add(const AABB3D<float>& aAABB);
+		void Add(const Vector3<float>& aMin, const Vector3<float>& aMax);
+		const size_t GetSize() const { return myMinX.size(); }
+
+		const float* GetMinX() const { return myMinX.data(); }
+		const float* GetMinY() const { return myMinY.data(); }
+		const float* GetMinZ() const { return myMinZ.data(); }
+		const float* GetMaxX() const { return myMaxX.data(); }
+		const float* GetMaxY() const { return myMaxY.data(); }
+		const float* GetMaxZ() const { return myMaxZ.data(); }
+	private:
+		std::vector<float> myMinX;
+		std::vector<float> myMinY;
+		std::vector<float> myMinZ;
+		std::vector<float> myMaxX;
+		std::vector<float> myMaxY;
+		std::vector<float> myMaxZ;
+	};
+
+	// Spheres stored as one array per coordinate and one for the radii.
+	class SphereBatch
+	{
+	public:
+		void Clear();
+		void Reserve(const size_t aSize);
+		void Add(const Sphere<float>& aSphere);
+		const size_t GetSize() const { return myX.size(); }
+
+		const float* GetX() const { return myX.data(); }
+		const float* GetY() const { return myY.data(); }
+		const float* GetZ() const { return myZ.data(); }
+		const float* GetRadius() const { return myRadius.data(); }
+	private:
+		std::vector<float> myX;
+		std::vector<float> myY;
+		std::vector<float> myZ;
+		std::vector<float> myRadius;
+	};
+
+	// Batch versions of the tests in Intersection3D.hpp, giving the same results as them.
+	// Each one tests a shape against the batch entries in [aBegin, aEnd), writes the indices of the ones it intersects to
+	// outIndices in ascending order and returns how many it wrote. outIndices needs room for aEnd - aBegin indices.
+
+	uint32_t IntersectionBetweenAABBSBatch(const AABB3D<float>& aAABB, const AABBBatch& aBatch, uint32_t aBegin, uint32_t aEnd, uint32_t* outIndices);
+	uint32_t IntersectionSphereAABBBatch(const Sphere<float>& aSphere, const AABBBatch& aBatch, uint32_t aBegin, uint32_t aEnd, uint32_t* outIndices);
+	uint32_t IntersectionBetweenSpheresBatch(const Sphere<float>& aSphere, const SphereBatch& aBatch, uint32_t aBegin, uint32_t aEnd, uint32_t* outIndices);
+	uint32_t IntersectionAABBRayBatch(const Ray<float>& aRay, const AABBBatch& aBatch, uint32_t aBegin, uint32_t aEnd, uint32_t* outIndices);
+
+	// Name of the instruction set the batch tests were built for.
+	inline const char* GetIntersectionBatchInstructionSet() { return FRAGILE_INTERSECTION_BATCH_SSE ? "SSE2" : "Scalar"; }
+
+	inline void AABBBatch::Clear()
+	{
+		myMinX.clear();
+		myMinY.clear();
+		myMinZ.clear();
+		myMaxX.clear();
+		myMaxY.clear();
+		myMaxZ.clear();
+	}
+
+	inline void AABBBatch::Reserve(const size_t aSize)
+	{
+		myMinX.reserve(aSize);
+		myMinY.reserve(aSize);
+		myMinZ.reserve(aSize);
+		myMaxX.reserve(aSize);
+		myMaxY.reserve(aSize);
+		myMaxZ.reserve(aSize);
+	}
+
+	inline void AABBBatch::Add(const AABB3D<float>& aAABB)
+	{
+		Add(aAABB.GetMin(), aAABB.GetMax());
+	}
+
+	inline void AABBBatch::Add(const Vector3<float>& aMin, const Vector3<float>& aMax)
+	{
+		myMinX.emplace_back(aMin.x);
+		myMinY.emplace_back(aMin.y);
+		myMinZ.emplace_back(aMin.z);
+		myMaxX.emplace_back(aMax.x);
+		myMaxY.emplace_back(aMax.y);
+		myMaxZ.emplace_back(aMax.z);
+	}
+
+	inline void SphereBatch::Clear()
+	{
+		myX.clear();
+		myY.clear();
+		myZ.clear();
+		myRadius.clear();
+	}
+
+	inline void SphereBatch::Reserve(const size_t aSize)
+	{
+		myX.reserve(aSize);
+		myY.reserve(aSize);
+		myZ.reserve(aSize);
+		myRadius.reserve(aSize);
+	}
+
+	inline void SphereBatch::Add(const Sphere<float>& aSphere)
+	{
+		myX.emplace_back(aSphere.GetPoint().x);
+		myY.emplace_back(aSphere.GetPoint().y);
+		myZ.emplace_back(aSphere.GetPoint().z);
+		myRadius.emplace_back(aSphere.GetRadius());
+	}
+
+	namespace IntersectionBatchDetail
+	{
+		// The scalar tests, on a single batch entry. Used for the whole range without SSE and for what's left after the
+		// last full group of four with it.
+
+		inline bool AABBAABB(const Vector3<float>& aMin, const Vector3<float>& aMax, const AABBBatch& aBatch, uint32_t aIndex)
+		{
+			return aMin.x <= aBatch.GetMaxX()[aIndex] && aMax.x >= aBatch.GetMinX()[aIndex]
+				&& aMin.y <= aBatch.GetMaxY()[aIndex] && aMax.y >= aBatch.GetMinY()[aIndex]
+				&& aMin.z <= aBatch.GetMaxZ()[aIndex] && aMax.z >= aBatch.GetMinZ()[aIndex];
+		}
+
+		inline float ClosestOnAxis(const float aCenter, const float aMin, const float aMax)
+		{
+			return aCenter <= aMin ? aMin : (aCenter >= aMax ? aMax : aCenter);
+		}
+
+		inline bool SphereAABB(const Vector3<float>& aCenter, const float aRadiusSqr, const AABBBatch& aBatch, uint32_t aIndex)
+		{
+			const float dx = ClosestOnAxis(aCenter.x, aBatch.GetMinX()[aIndex], aBatch.GetMaxX()[aIndex]) - aCenter.x;
+			const float dy = ClosestOnAxis(aCenter.y, aBatch.GetMinY()[aIndex], aBatch.GetMaxY()[aIndex]) - aCenter.y;
+			const float dz = ClosestOnAxis(aCenter.z, aBatch.GetMinZ()[aIndex], aBatch.GetMaxZ()[aIndex]) - aCenter.z;
+			return dx * dx + dy * dy + dz * dz <= aRadiusSqr;
+		}
+
+		inline bool SphereSphere(const Vector3<float>& aCenter, const float aRadius, const SphereBatch& aBatch, uint32_t aIndex)
+		{
+			const float dx = aCenter.x - aBatch.GetX()[aIndex];
+			const float dy = aCenter.y - aBatch.GetY()[aIndex];
+			const float dz = aCenter.z - aBatch.GetZ()[aIndex];
+			const float radiusSum = aRadius + aBatch.GetRadius()[aIndex];
+			return dx * dx + dy * dy + dz * dz <= radiusSum * radiusSum;
+		}
+
+		inline bool RayAABB(const Vector3<float>& aOrigin, const Vector3<float>& aDirection, const AABBBatch& aBatch, uint32_t aIndex)
+		{
+			float tMin = 0;
+			float tMax = FLT_MAX;
+
+			const float x1 = (aBatch.GetMinX()[aIndex] - aOrigin.x) / aDirection.x;
+			const float x2 = (aBatch.GetMaxX()[aIndex] - aOrigin.x) / aDirection.x;
+			tMin = std::fmin(std::fmax(x1, tMin), std::fmax(x2, tMin));
+			tMax = std::fmax(std::fmin(x1, tMax), std::fmin(x2, tMax));
+
+			const float y1 = (aBatch.GetMinY()[aIndex] - aOrigin.y) / aDirection.y;
+			const float y2 = (aBatch.GetMaxY()[aIndex] - aOrigin.y) / aDirection.y;
+			tMin = std::fmin(std::fmax(y1, tMin), std::fmax(y2, tMin));
+			tMax = std::fmax(std::fmin(y1, tMax), std::fmin(y2, tMax));
+
+			const float z1 = (aBatch.GetMinZ()[aIndex] - aOrigin.z) / aDirection.z;
+			const float z2 = (aBatch.GetMaxZ()[aIndex] - aOrigin.z) / aDirection.z;
+			tMin = std::fmin(std::fmax(z1, tMin), std::fmax(z2, tMin));
+			tMax = std::fmax(std::fmin(z1, tMax), std::fmin(z2, tMax));
+
+			return tMin <= tMax;
+		}
+
+#if FRAGILE_INTERSECTION_BATCH_SSE
+		// Writes aFirstIndex plus the lane of every bit set in the 4 bit aMask to outIndices, returns how many it wrote.
+		inline uint32_t WriteIndices(int aMask, const uint32_t aFirstIndex, uint32_t* outIndices)
+		{
+			uint32_t count = 0;
+			for (uint32_t lane = 0; aMask != 0; lane++, aMask >>= 1)
+			{
+				if (aMask & 1)
+				{
+					outIndices[count++] = aFirstIndex + lane;
+				}
+			}
+
+			return count;
+		}
+
+		// Per lane: aMask ? aA : aB.
+		inline __m128 Select(const __m128 aMask, const __m128 aA, const __m128 aB)
+		{
+			return _mm_or_ps(_mm_and_ps(aMask, aA), _mm_andnot_ps(aMask, aB));
+		}
+
+		inline __m128 ClosestOnAxis(const __m128 aCenter, const __m128 aMin, const __m128 aMax)
+		{
+			return Select(_mm_cmple_ps(aCenter, aMin), aMin, Select(_mm_cmpge_ps(aCenter, aMax), aMax, aCenter));
+		}
+
+		// One slab of the ray test. The ray's terms go first in max and min, which return their second argument when either
+		// is NaN, the same as fmax and fmin ignoring NaN.
+		inline void RaySlab(const __m128 aMin, const __m128 aMax, const __m128 aOrigin, const __m128 aDirection, __m128& aTMin, __m128& aTMax)
+		{
+			const __m128 t1 = _mm_div_ps(_mm_sub_ps(aMin, aOrigin), aDirection);
+			const __m128 t2 = _mm_div_ps(_mm_sub_ps(aMax, aOrigin), aDirection);
+			aTMin = _mm_min_ps(_mm_max_ps(t1, aTMin), _mm_max_ps(t2, aTMin));
+			aTMax = _mm_max_ps(_mm_min_ps(t1, aTMax), _mm_min_ps(t2, aTMax));
+		}
+#endif
+	}
+
+	inline uint32_t IntersectionBetweenAABBSBatch(const AABB3D<float>& aAABB, const AABBBatch& aBatch, uint32_t aBegin, uint32_t aEnd, uint32_t* outIndices)
+	{
+		const Vector3<float> aabbMin = aAABB.GetMin();
+		const Vector3<float> aabbMax = aAABB.GetMax();
+
+		uint32_t count = 0;
+		uint32_t index = aBegin;
+
+#if FRAGILE_INTERSECTION_BATCH_SSE
+		const __m128 minX = _mm_set1_ps(aabbMin.x);
+		const __m128 minY = _mm_set1_ps(aabbMin.y);
+		const __m128 minZ = _mm_set1_ps(aabbMin.z);
+		const __m128 maxX = _mm_set1_ps(aabbMax.x);
+		const __m128 maxY = _mm_set1_ps(aabbMax.y);
+		const __m128 maxZ = _mm_set1_ps(aabbMax.z);
+
+		for (; index + 4 <= aEnd; index += 4)
+		{
+			__m128 overlaps = _mm_and_ps(_mm_cmple_ps(minX, _mm_loadu_ps(aBatch.GetMaxX() + index)), _mm_cmpge_ps(maxX, _mm_loadu_ps(aBatch.GetMinX() + index)));
+			overlaps = _mm_and_ps(overlaps, _mm_and_ps(_mm_cmple_ps(minY, _mm_loadu_ps(aBatch.GetMaxY() + index)), _mm_cmpge_ps(maxY, _mm_loadu_ps(aBatch.GetMinY() + index))));
+			overlaps = _mm_and_ps(overlaps, _mm_and_ps(_mm_cmple_ps(minZ, _mm_loadu_ps(aBatch.GetMaxZ() + index)), _mm_cmpge_ps(maxZ, _mm_loadu_ps(aBatch.GetMinZ() + index))));
+			count += IntersectionBatchDetail::WriteIndices(_mm_movemask_ps(overlaps), index, outIndices + count);
+		}
+#endif
+
+		for (; index < aEnd; index++)
+		{
+			if (IntersectionBatchDetail::AABBAABB(aabbMin, aabbMax, aBatch, index))
+			{
+				outIndices[count++] = index;
+			}
+		}
+
+		return count;
+	}
+
+	inline uint32_t IntersectionSphereAABBBatch(const Sphere<float>& aSphere, const AABBBatch& aBatch, uint32_t aBegin, uint32_t aEnd, uint32_t* outIndices)
+	{
+		const Vector3<float> center = aSphere.GetPoint();
+		const float radiusSqr = aSphere.GetRadiusSqr();
+
+		uint32_t count = 0;
+		uint32_t index = aBegin;
+
+#if FRAGILE_INTERSECTION_BATCH_SSE
+		const __m128 centerX = _mm_set1_ps(center.x);
+		const __m128 centerY = _mm_set1_ps(center.y);
+		const __m128 centerZ = _mm_set1_ps(center.z);
+		const __m128 radiusSqrs = _mm_set1_ps(radiusSqr);
+
+		for (; index + 4 <= aEnd; index += 4)
+		{
+			using IntersectionBatchDetail::ClosestOnAxis;
+			const __m128 dx = _mm_sub_ps(ClosestOnAxis(centerX, _mm_loadu_ps(aBatch.GetMinX() + index), _mm_loadu_ps(aBatch.GetMaxX() + index)), centerX);
+			const __m128 dy = _mm_sub_ps(ClosestOnAxis(centerY, _mm_loadu_ps(aBatch.GetMinY() + index), _mm_loadu_ps(aBatch.GetMaxY() + index)), centerY);
+			const __m128 dz = _mm_sub_ps(ClosestOnAxis(centerZ, _mm_loadu_ps(aBatch.GetMinZ() + index), _mm_loadu_ps(aBatch.GetMaxZ() + index)), centerZ);
+			const __m128 distanceSqr = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+			count += IntersectionBatchDetail::WriteIndices(_mm_movemask_ps(_mm_cmple_ps(distanceSqr, radiusSqrs)), index, outIndices + count);
+		}
+#endif
+
+		for (; index < aEnd; index++)
+		{
+			if (IntersectionBatchDetail::SphereAABB(center, radiusSqr, aBatch, index))
+			{
+				outIndices[count++] = index;
+			}
+		}
+
+		return count;
+	}
+
+	inline uint32_t IntersectionBetweenSpheresBatch(const Sphere<float>& aSphere, const SphereBatch& aBatch, uint32_t aBegin, uint32_t aEnd, uint32_t* outIndices)
+	{
+		const Vector3<float> center = aSphere.GetPoint();
+		const float radius = aSphere.GetRadius();
+
+		uint32_t count = 0;
+		uint32_t index = aBegin;
+
+#if FRAGILE_INTERSECTION_BATCH_SSE
+		const __m128 centerX = _mm_set1_ps(center.x);
+		const __m128 centerY = _mm_set1_ps(center.y);
+		const __m128 centerZ = _mm_set1_ps(center.z);
+		const __m128 radii = _mm_set1_ps(radius);
+
+		for (; index + 4 <= aEnd; index += 4)
+		{
+			const __m128 dx = _mm_sub_ps(centerX, _mm_loadu_ps(aBatch.GetX() + index));
+			const __m128 dy = _mm_sub_ps(centerY, _mm_loadu_ps(aBatch.GetY() + index));
+			const __m128 dz = _mm_sub_ps(centerZ, _mm_loadu_ps(aBatch.GetZ() + index));
+			const __m128 radiusSum = _mm_add_ps(radii, _mm_loadu_ps(aBatch.GetRadius() + index));
+			const __m128 distanceSqr = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+			count += IntersectionBatchDetail::WriteIndices(_mm_movemask_ps(_mm_cmple_ps(distanceSqr, _mm_mul_ps(radiusSum, radiusSum))), index, outIndices + count);
+		}
+#endif
+
+		for (; index < aEnd; index++)
+		{
+			if (IntersectionBatchDetail::SphereSphere(center, radius, aBatch, index))
+			{
+				outIndices[count++] = index;
+			}
+		}
+
+		return count;
+	}
+
+	inline uint32_t IntersectionAABBRayBatch(const Ray<float>& aRay, const AABBBatch& aBatch, uint32_t aBegin, uint32_t aEnd, uint32_t* outIndices)
+	{
+		const Vector3<float> origin = aRay.GetOrigin();
+		const Vector3<float> direction = aRay.GetDirection();
+
+		uint32_t count = 0;
+		uint32_t index = aBegin;
+
+#if FRAGILE_INTERSECTION_BATCH_SSE
+		const __m128 originX = _mm_set1_ps(origin.x);
+		const __m128 originY = _mm_set1_ps(origin.y);
+		const __m128 originZ = _mm_set1_ps(origin.z);
+		const __m128 directionX = _mm_set1_ps(direction.x);
+		const __m128 directionY = _mm_set1_ps(direction.y);
+		const __m128 directionZ = _mm_set1_ps(direction.z);
+
+		for (; index + 4 <= aEnd; index += 4)
+		{
+			using IntersectionBatchDetail::RaySlab;
+			__m128 tMin = _mm_setzero_ps();
+			__m128 tMax = _mm_set1_ps(FLT_MAX);
+			RaySlab(_mm_loadu_ps(aBatch.GetMinX() + index), _mm_loadu_ps(aBatch.GetMaxX() + index), originX, directionX, tMin, tMax);
+			RaySlab(_mm_loadu_ps(aBatch.GetMinY() + index), _mm_loadu_ps(aBatch.GetMaxY() + index), originY, directionY, tMin, tMax);
+			RaySlab(_mm_loadu_ps(aBatch.GetMinZ() + index), _mm_loadu_ps(aBatch.GetMaxZ() + index), originZ, directionZ, tMin, tMax);
+			count += IntersectionBatchDetail::WriteIndices(_mm_movemask_ps(_mm_cmple_ps(tMin, tMax)), index, outIndices + count);
+		}
+#endif
+
+		for (; index < aEnd; index++)
+		{
+			if (IntersectionBatchDetail::RayAABB(origin, direction, aBatch, index))
+			{
+				outIndices[count++] = index;
+			}
+		}
+
+		return count;
+	}
+}
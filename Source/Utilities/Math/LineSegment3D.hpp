@@ -8,7 +8,7 @@ namespace Math
 	class LineSegment3D
 	{
 	public:
-		LineSegment3D<T>(Vector3<T> aPointOne, Vector3<T> aPointTwo);
+		LineSegment3D(Vector3<T> aPointOne, Vector3<T> aPointTwo);
 
 		Vector3<T> ToVector();
 		T Length();
@@ -13,19 +13,19 @@ namespace Math
 	{
 	public:
 		// Creates the identity matrix.
-		Matrix3x3<T>();
+		Matrix3x3();
 
 		// Initializes the matrix with a list of elements.
-		Matrix3x3<T>(const T a11, const T a12, const T a13, const T a21, const T a22, const T a23, const T a31, const T a32, const T a33);
+		Matrix3x3(const T a11, const T a12, const T a13, const T a21, const T a22, const T a23, const T a31, const T a32, const T a33);
 
 		//Initializes the matrix with a number of vectors.
-		Matrix3x3<T>(const Vector3<T> vectorA, const Vector3<T> vectorB, const Vector3<T> vectorC);
+		Matrix3x3(const Vector3<T> vectorA, const Vector3<T> vectorB, const Vector3<T> vectorC);
 
 		// Copy Constructor.
-		Matrix3x3<T>(const Matrix3x3<T>& aMatrix);
+		Matrix3x3(const Matrix3x3<T>& aMatrix);
 
 		// Copies the top left 3x3 part of the Matrix4x4.
-		Matrix3x3<T>(const Matrix4x4<T>& aMatrix);
+		Matrix3x3(const Matrix4x4<T>& aMatrix);
 
 		// () operator for accessing element (row, column) for read/write or read, respectively.
 		T& operator()(const int aRow, const int aColumn);
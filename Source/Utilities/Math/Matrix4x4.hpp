@@ -13,10 +13,10 @@ namespace Math
 	class Matrix4x4
 	{
 	public:
-		Matrix4x4<T>();
-		Matrix4x4<T>(const T a11, const T a12, const T a13, const T a14, const T a21, const T a22, const T a23, const T a24, const T a31, const T a32, const T a33, const T a34, const T a41, const T a42, const T a43, const T a44);
-		Matrix4x4<T>(const Vector4<T> vectorA, const Vector4<T> vectorB, const Vector4<T> vectorC, const Vector4<T> vectorD);
-		Matrix4x4<T>(const Matrix4x4<T>& aMatrix);
+		Matrix4x4();
+		Matrix4x4(const T a11, const T a12, const T a13, const T a14, const T a21, const T a22, const T a23, const T a24, const T a31, const T a32, const T a33, const T a34, const T a41, const T a42, const T a43, const T a44);
+		Matrix4x4(const Vector4<T> vectorA, const Vector4<T> vectorB, const Vector4<T> vectorC, const Vector4<T> vectorD);
+		Matrix4x4(const Matrix4x4<T>& aMatrix);
 		Matrix4x4(const Matrix3x3<T>& aMatrix);
 
 		T& operator()(const int aRow, const int aColumn);
@@ -50,6 +50,9 @@ namespace Math
 		static Matrix4x4<T> CreateTranslationMatrix(Vector3<T> aTranslationVector);
 		static Vector3<T> CreateTranslationVector(Matrix4x4<T> aMatrix);
 
+		// aMatrix0 * aMatrix1 for affine matrices (last column 0, 0, 0, 1), skipping the terms that are known to be 0 or 1.
+		static Matrix4x4<T> MultiplyAffine(const Matrix4x4<T>& aMatrix0, const Matrix4x4<T>& aMatrix1);
+
 	private:
 		std::array<std::array<T, 4>, 4> myMatrix;
 	};
@@ -500,6 +503,21 @@ namespace Math
 		return result;
 	}
 
+	template<class T>
+	inline Matrix4x4<T> Matrix4x4<T>::MultiplyAffine(const Matrix4x4<T>& aMatrix0, const Matrix4x4<T>& aMatrix1)
+	{
+		auto element = [&aMatrix0, &aMatrix1](const int aRow, const int aColumn)
+			{
+				return aMatrix0(aRow, 1) * aMatrix1(1, aColumn) + aMatrix0(aRow, 2) * aMatrix1(2, aColumn) + aMatrix0(aRow, 3) * aMatrix1(3, aColumn);
+			};
+
+		return Matrix4x4<T>(
+			element(1, 1), element(1, 2), element(1, 3), T(0),
+			element(2, 1), element(2, 2), element(2, 3), T(0),
+			element(3, 1), element(3, 2), element(3, 3), T(0),
+			element(4, 1) + aMatrix1(4, 1), element(4, 2) + aMatrix1(4, 2), element(4, 3) + aMatrix1(4, 3), T(1));
+	}
+
 	template<class T>
 	inline Matrix4x4<T> Matrix4x4<T>::CreateScaleMatrix(Vector3<T> aScaleVector)
 	{
@@ -23,12 +23,12 @@ namespace Math
 		T z;
 		T w;
 
-		Quaternion<T>();
-		Quaternion<T>(const T& aW, const T& aX, const T& aY, const T& aZ);
-		Quaternion<T>(const T& aPitch, const T& aYaw, const T& aRoll);
-		Quaternion<T>(const Vector3<T>& aPitchYawRoll);
-		Quaternion<T>(const Vector3<T>& aVector, const T aAngle);
-		Quaternion<T>(const Matrix4x4<T>& aMatrix);
+		Quaternion();
+		Quaternion(const T& aW, const T& aX, const T& aY, const T& aZ);
+		Quaternion(const T& aPitch, const T& aYaw, const T& aRoll);
+		Quaternion(const Vector3<T>& aPitchYawRoll);
+		Quaternion(const Vector3<T>& aVector, const T aAngle);
+		Quaternion(const Matrix4x4<T>& aMatrix);
 
 		void RotateWithEuler(const Vector3<T>& aEuler);
 
@@ -1,5 +1,6 @@
 #pragma once
 #include "Math/Vector.hpp"
+#include "Math/Matrix4x4.hpp"
 
 namespace Math
 {
@@ -7,9 +8,9 @@ namespace Math
 	class Ray
 	{
 	public:
-		Ray<T>();
-		Ray<T>(const Ray<T>& aRay);
-		Ray<T>(const Vector3<T>& aOrigin, const Vector3<T>& aDirection);
+		Ray();
+		Ray(const Ray<T>& aRay);
+		Ray(const Vector3<T>& aOrigin, const Vector3<T>& aDirection);
 		void InitWith2Points(const Vector3<T>& aOrigin, const Vector3<T>& aPoint);
 		void InitWithOriginAndDirection(const Vector3<T>& aOrigin, const Vector3<T>& aDirection);
 		Ray<T> GetRayinNewSpace(const Matrix4x4<T>& aMatrix) const;
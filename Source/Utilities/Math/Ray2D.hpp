@@ -7,9 +7,9 @@ namespace Math
 	class Ray2D
 	{
 	public:
-		Ray2D<T>();
-		Ray2D<T>(const Ray2D<T>& aRay);
-		Ray2D<T>(const Vector2<T>& aOrigin, const Vector2<T>& aDirection);
+		Ray2D();
+		Ray2D(const Ray2D<T>& aRay);
+		Ray2D(const Vector2<T>& aOrigin, const Vector2<T>& aDirection);
 		void InitWith2Points(const Vector2<T>& aOrigin, const Vector2<T>& aPoint);
 		void InitWithOriginAndDirection(const Vector2<T>& aOrigin, const Vector2<T>& aDirection);
 		const Vector2<T> GetDirection() const;
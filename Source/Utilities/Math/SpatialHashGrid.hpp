@@ -0,0 +1,308 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <cmath>
+#include <unordered_map>
+#include "Math/Vector.hpp"
+#include "AABB3D.hpp"
+
+namespace Math
+{
+	// Uniform grid over points that only stores the cells something is in, looked up by hashing their coordinates.
+	// Items are ids picked by the caller, meant to be small and dense like indices into the caller's own arrays, and are
+	// inserted, moved and removed one at a time. Moving inside a cell only updates the position, and cells that empty out
+	// are kept for items moving back in. Queries don't change the grid, so several threads can query it while nothing moves.
+	// Pick a cell size around the usual query radius: much smaller visits lots of cells, much larger tests lots of items.
+	template <class T>
+	class SpatialHashGrid
+	{
+	public:
+		SpatialHashGrid(const T aCellSize = static_cast<T>(1));
+
+		// Changing the cell size removes every item.
+		void SetCellSize(const T aCellSize);
+		const T GetCellSize() const { return myCellSize; }
+		void Clear();
+
+		// Moving an item that isn't in the grid inserts it, and inserting one that is moves it.
+		void Insert(const uint32_t aItem, const Vector3<T>& aPosition);
+		void Move(const uint32_t aItem, const Vector3<T>& aPosition);
+		void Remove(const uint32_t aItem);
+		const bool Contains(const uint32_t aItem) const { return aItem < mySlots.size() && mySlots[aItem].cell != InvalidCell; }
+		const size_t GetItemCount() const { return myItemCount; }
+
+		// Append the items within aRadius of aCenter, or inside aBox, to outItems. Return the amount found.
+		unsigned QueryRadius(const Vector3<T>& aCenter, const T aRadius, std::vector<uint32_t>& outItems) const;
+		unsigned QueryBox(const AABB3D<T>& aBox, std::vector<uint32_t>& outItems) const;
+		// Call aFunction(item, position) for the same items instead.
+		template <typename Function>
+		void ForEachInRadius(const Vector3<T>& aCenter, const T aRadius, Function&& aFunction) const;
+		template <typename Function>
+		void ForEachInBox(const AABB3D<T>& aBox, Function&& aFunction) const;
+
+	private:
+		static constexpr uint32_t InvalidCell = UINT32_MAX;
+		// Cell coordinates are clamped to 21 bits each so they pack into one key.
+		static constexpr int32_t MaxCellCoordinate = (1 << 20) - 1;
+
+		// The items in a cell and their positions, in the same order.
+		struct Cell
+		{
+			int32_t x = 0;
+			int32_t y = 0;
+			int32_t z = 0;
+			std::vector<uint32_t> items;
+			std::vector<Vector3<T>> positions;
+		};
+
+		struct Slot
+		{
+			uint32_t cell = InvalidCell;
+			uint32_t indexInCell = 0;
+		};
+
+		const int32_t GetCellCoordinate(const T aValue) const;
+		static uint64_t GetCellKey(const int32_t aX, const int32_t aY, const int32_t aZ);
+		uint32_t GetOrAddCell(const int32_t aX, const int32_t aY, const int32_t aZ);
+		void AddToCell(const uint32_t aItem, const uint32_t aCell, const Vector3<T>& aPosition);
+		void RemoveFromCell(const uint32_t aItem);
+
+		// Calls aFunction(item, position) for items in the cells from aMin to aMax (inclusive) whose position passes aItemTest.
+		template <typename ItemTest, typename Function>
+		void ForEachInCells(const Vector3<T>& aMin, const Vector3<T>& aMax, ItemTest&& aItemTest, Function&& aFunction) const;
+
+		T myCellSize = static_cast<T>(1);
+		T myInverseCellSize = static_cast<T>(1);
+		std::vector<Cell> myCells;
+		std::unordered_map<uint64_t, uint32_t> myCellLookup;
+		// Where each item is, indexed by item.
+		std::vector<Slot> mySlots;
+		size_t myItemCount = 0;
+	};
+
+	template<class T>
+	inline SpatialHashGrid<T>::SpatialHashGrid(const T aCellSize)
+	{
+		SetCellSize(aCellSize);
+	}
+
+	template<class T>
+	inline void SpatialHashGrid<T>::SetCellSize(const T aCellSize)
+	{
+		Clear();
+		myCellSize = aCellSize > 0 ? aCellSize : static_cast<T>(1);
+		myInverseCellSize = static_cast<T>(1) / myCellSize;
+	}
+
+	template<class T>
+	inline void SpatialHashGrid<T>::Clear()
+	{
+		myCells.clear();
+		myCellLookup.clear();
+		mySlots.clear();
+		myItemCount = 0;
+	}
+
+	template<class T>
+	inline void SpatialHashGrid<T>::Insert(const uint32_t aItem, const Vector3<T>& aPosition)
+	{
+		Move(aItem, aPosition);
+	}
+
+	template<class T>
+	inline void SpatialHashGrid<T>::Move(const uint32_t aItem, const Vector3<T>& aPosition)
+	{
+		const int32_t x = GetCellCoordinate(aPosition.x);
+		const int32_t y = GetCellCoordinate(aPosition.y);
+		const int32_t z = GetCellCoordinate(aPosition.z);
+
+		if (Contains(aItem))
+		{
+			const Slot& slot = mySlots[aItem];
+			Cell& cell = myCells[slot.cell];
+			if (cell.x == x && cell.y == y && cell.z == z)
+			{
+				cell.positions[slot.indexInCell] = aPosition;
+				return;
+			}
+
+			RemoveFromCell(aItem);
+		}
+		else
+		{
+			if (aItem >= mySlots.size())
+			{
+				mySlots.resize(aItem + 1);
+			}
+
+			myItemCount++;
+		}
+
+		AddToCell(aItem, GetOrAddCell(x, y, z), aPosition);
+	}
+
+	template<class T>
+	inline void SpatialHashGrid<T>::Remove(const uint32_t aItem)
+	{
+		if (!Contains(aItem)) return;
+
+		RemoveFromCell(aItem);
+		mySlots[aItem].cell = InvalidCell;
+		myItemCount--;
+	}
+
+	template<class T>
+	inline unsigned SpatialHashGrid<T>::QueryRadius(const Vector3<T>& aCenter, const T aRadius, std::vector<uint32_t>& outItems) const
+	{
+		const size_t countBefore = outItems.size();
+		ForEachInRadius(aCenter, aRadius, [&outItems](uint32_t aItem, const Vector3<T>&) { outItems.emplace_back(aItem); });
+		return static_cast<unsigned>(outItems.size() - countBefore);
+	}
+
+	template<class T>
+	inline unsigned SpatialHashGrid<T>::QueryBox(const AABB3D<T>& aBox, std::vector<uint32_t>& outItems) const
+	{
+		const size_t countBefore = outItems.size();
+		ForEachInBox(aBox, [&outItems](uint32_t aItem, const Vector3<T>&) { outItems.emplace_back(aItem); });
+		return static_cast<unsigned>(outItems.size() - countBefore);
+	}
+
+	template<class T>
+	template<typename Function>
+	inline void SpatialHashGrid<T>::ForEachInRadius(const Vector3<T>& aCenter, const T aRadius, Function&& aFunction) const
+	{
+		const Vector3<T> extents(aRadius, aRadius, aRadius);
+		const T radiusSqr = aRadius * aRadius;
+
+		ForEachInCells(aCenter - extents, aCenter + extents, [&aCenter, radiusSqr](const Vector3<T>& aPosition)
+			{
+				return (aPosition - aCenter).LengthSqr() <= radiusSqr;
+			}, aFunction);
+	}
+
+	template<class T>
+	template<typename Function>
+	inline void SpatialHashGrid<T>::ForEachInBox(const AABB3D<T>& aBox, Function&& aFunction) const
+	{
+		const Vector3<T> boxMin = aBox.GetMin();
+		const Vector3<T> boxMax = aBox.GetMax();
+
+		ForEachInCells(boxMin, boxMax, [&boxMin, &boxMax](const Vector3<T>& aPosition)
+			{
+				return aPosition.x >= boxMin.x && aPosition.x <= boxMax.x
+					&& aPosition.y >= boxMin.y && aPosition.y <= boxMax.y
+					&& aPosition.z >= boxMin.z && aPosition.z <= boxMax.z;
+			}, aFunction);
+	}
+
+	template<class T>
+	template<typename ItemTest, typename Function>
+	inline void SpatialHashGrid<T>::ForEachInCells(const Vector3<T>& aMin, const Vector3<T>& aMax, ItemTest&& aItemTest, Function&& aFunction) const
+	{
+		const int32_t minX = GetCellCoordinate(aMin.x);
+		const int32_t minY = GetCellCoordinate(aMin.y);
+		const int32_t minZ = GetCellCoordinate(aMin.z);
+		const int32_t maxX = GetCellCoordinate(aMax.x);
+		const int32_t maxY = GetCellCoordinate(aMax.y);
+		const int32_t maxZ = GetCellCoordinate(aMax.z);
+
+		auto visitCell = [&aItemTest, &aFunction](const Cell& aCell)
+			{
+				for (size_t i = 0; i < aCell.items.size(); i++)
+				{
+					if (aItemTest(aCell.positions[i]))
+					{
+						aFunction(aCell.items[i], aCell.positions[i]);
+					}
+				}
+			};
+
+		// Areas covering more cells than are in use are cheaper to handle by going through the ones in use.
+		const uint64_t cellsInRange = static_cast<uint64_t>(maxX - minX + 1) * static_cast<uint64_t>(maxY - minY + 1) * static_cast<uint64_t>(maxZ - minZ + 1);
+		if (cellsInRange > myCells.size())
+		{
+			for (const Cell& cell : myCells)
+			{
+				if (cell.x >= minX && cell.x <= maxX && cell.y >= minY && cell.y <= maxY && cell.z >= minZ && cell.z <= maxZ)
+				{
+					visitCell(cell);
+				}
+			}
+
+			return;
+		}
+
+		for (int32_t z = minZ; z <= maxZ; z++)
+		{
+			for (int32_t y = minY; y <= maxY; y++)
+			{
+				for (int32_t x = minX; x <= maxX; x++)
+				{
+					auto cell = myCellLookup.find(GetCellKey(x, y, z));
+					if (cell != myCellLookup.end())
+					{
+						visitCell(myCells[cell->second]);
+					}
+				}
+			}
+		}
+	}
+
+	template<class T>
+	inline const int32_t SpatialHashGrid<T>::GetCellCoordinate(const T aValue) const
+	{
+		const T coordinate = std::floor(aValue * myInverseCellSize);
+		if (!(coordinate > -MaxCellCoordinate)) return -MaxCellCoordinate;
+		if (coordinate > MaxCellCoordinate) return MaxCellCoordinate;
+		return static_cast<int32_t>(coordinate);
+	}
+
+	template<class T>
+	inline uint64_t SpatialHashGrid<T>::GetCellKey(const int32_t aX, const int32_t aY, const int32_t aZ)
+	{
+		const uint64_t x = static_cast<uint64_t>(aX + MaxCellCoordinate);
+		const uint64_t y = static_cast<uint64_t>(aY + MaxCellCoordinate);
+		const uint64_t z = static_cast<uint64_t>(aZ + MaxCellCoordinate);
+		return (x << 42) | (y << 21) | z;
+	}
+
+	template<class T>
+	inline uint32_t SpatialHashGrid<T>::GetOrAddCell(const int32_t aX, const int32_t aY, const int32_t aZ)
+	{
+		auto [lookup, isNew] = myCellLookup.try_emplace(GetCellKey(aX, aY, aZ), static_cast<uint32_t>(myCells.size()));
+		if (isNew)
+		{
+			Cell& cell = myCells.emplace_back();
+			cell.x = aX;
+			cell.y = aY;
+			cell.z = aZ;
+		}
+
+		return lookup->second;
+	}
+
+	template<class T>
+	inline void SpatialHashGrid<T>::AddToCell(const uint32_t aItem, const uint32_t aCell, const Vector3<T>& aPosition)
+	{
+		Cell& cell = myCells[aCell];
+		mySlots[aItem].cell = aCell;
+		mySlots[aItem].indexInCell = static_cast<uint32_t>(cell.items.size());
+		cell.items.emplace_back(aItem);
+		cell.positions.emplace_back(aPosition);
+	}
+
+	template<class T>
+	inline void SpatialHashGrid<T>::RemoveFromCell(const uint32_t aItem)
+	{
+		// The cell's last item takes the removed one's place.
+		const Slot& slot = mySlots[aItem];
+		Cell& cell = myCells[slot.cell];
+		const uint32_t lastItem = cell.items.back();
+
+		cell.items[slot.indexInCell] = lastItem;
+		cell.positions[slot.indexInCell] = cell.positions.back();
+		mySlots[lastItem].indexInCell = slot.indexInCell;
+		cell.items.pop_back();
+		cell.positions.pop_back();
+	}
+}
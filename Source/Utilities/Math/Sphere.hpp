@@ -10,11 +10,11 @@ namespace Math
 	public:
 		// Default constructor: there is no sphere, the radius is zero and the position is
 		// the zero vector.
-		Sphere<T>();
+		Sphere();
 		// Copy constructor.
-		Sphere<T>(const Sphere<T>& aSphere);
+		Sphere(const Sphere<T>& aSphere);
 		// Constructor that takes the center position and radius of the sphere.
-		Sphere<T>(const Vector3<T>& aCenter, T aRadius);
+		Sphere(const Vector3<T>& aCenter, T aRadius);
 		// Init the sphere with a center and a radius, the same as the constructor above.
 		void InitWithCenterAndRadius(const Vector3<T>& aCenter, T aRadius);
 		Sphere<T> GetSphereinNewSpace(const Matrix4x4<T> aMatrix) const;
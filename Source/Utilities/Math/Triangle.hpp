@@ -11,7 +11,7 @@ namespace Math
 	class Triangle
 	{
 	public:
-		Triangle<T>(Vector3<T> aPointOne, Vector3<T> aPointTwo, Vector3<T> aPointThree);
+		Triangle(Vector3<T> aPointOne, Vector3<T> aPointTwo, Vector3<T> aPointThree);
 		const std::array<Vector3<T>, 3>& GetPoints() const;
 
 		Vector3<T> ClosestPointOnTriangle(Vector3<T> aPoint);
@@ -10,11 +10,11 @@ namespace Math
 		T x;
 		T y;
 
-		Vector2<T>();
-		Vector2<T>(const T& aX, const T& aY);
-		Vector2<T>(const Vector2<T>& aVector) = default;
+		Vector2();
+		Vector2(const T& aX, const T& aY);
+		Vector2(const Vector2<T>& aVector) = default;
 		Vector2<T>& operator=(const Vector2<T>& aVector2) = default;
-		~Vector2<T>() = default;
+		~Vector2() = default;
 
 		//Explicit Type operator, create a different vector with the same values.
 		//Example creates a Tga::Vector2<T> from this CommonUtillities::Vector2<T>
@@ -75,7 +75,7 @@ namespace Math
 	Vector2<T> Vector2<T>::GetNormalized() const
 	{
 		T length = Length();
-		length = max(length, (T)0.0001);
+		length = length > (T)0.0001 ? length : (T)0.0001;
 		Vector2<T> newVector(x / length, y / length);
 		return newVector;
 	}
@@ -14,11 +14,11 @@ namespace Math
 		T y;
 		T z;
 
-		Vector3<T>();
-		Vector3<T>(const T& aX, const T& aY, const T& aZ);
-		Vector3<T>(const Vector3<T>& aVector) = default;
+		Vector3();
+		Vector3(const T& aX, const T& aY, const T& aZ);
+		Vector3(const Vector3<T>& aVector) = default;
 		Vector3<T>& operator=(const Vector3<T>& aVector3) = default;
-		~Vector3<T>() = default;
+		~Vector3() = default;
 
 		//Explicit Type operator, create a different vector with the same values.
 		//Example creates a Tga::Vector3<T> from this CommonUtillities::Vector3<T>
@@ -89,7 +89,7 @@ namespace Math
 	Vector3<T> Vector3<T>::GetNormalized() const
 	{
 		T length = Length();
-		length = max(length, (T)0.0001);
+		length = length > (T)0.0001 ? length : (T)0.0001;
 		Vector3<T> newVector(x / length, y / length, z / length);
 		return newVector;
 	}
@@ -12,11 +12,11 @@ namespace Math
 		T z;
 		T w;
 
-		Vector4<T>();
-		Vector4<T>(const T& aX, const T& aY, const T& aZ, const T& aW);
-		Vector4<T>(const Vector4<T>& aVector) = default;
+		Vector4();
+		Vector4(const T& aX, const T& aY, const T& aZ, const T& aW);
+		Vector4(const Vector4<T>& aVector) = default;
 		Vector4<T>& operator=(const Vector4<T>& aVector4) = default;
-		~Vector4<T>() = default;
+		~Vector4() = default;
 
 		//Explicit Type operator, create a different vector with the same values.
 		//Example creates a Tga::Vector4<T> from this CommonUtillities::Vector4<T>
@@ -81,7 +81,7 @@ namespace Math
 	Vector4<T> Vector4<T>::GetNormalized() const
 	{
 		T length = Length();
-		length = max(length, (T)0.0001);
+		length = length > (T)0.0001 ? length : (T)0.0001;
 		Vector4<T> newVector(x / length, y / length, z / length, w / length);
 		return newVector;
 	}